@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace uprotocol::benchmarks {
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency) noexcept {
+	const auto value =
+	    static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+	++counts_[bucketFor(value)];
+	++count_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(
+    double percent) const noexcept {
+	if (count_ == 0) {
+		return std::chrono::nanoseconds(0);
+	}
+	constexpr double HUNDRED = 100.0;
+	const auto rank = std::max<uint64_t>(
+	    1, static_cast<uint64_t>(
+	           std::ceil(percent / HUNDRED * static_cast<double>(count_))));
+	uint64_t seen = 0;
+	for (size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+		seen += counts_[bucket];
+		if (seen >= rank) {
+			return std::chrono::nanoseconds(
+			    static_cast<int64_t>(highestValueIn(bucket)));
+		}
+	}
+	return std::chrono::nanoseconds(
+	    static_cast<int64_t>(highestValueIn(NUM_BUCKETS - 1)));
+}
+
+void LatencyHistogram::report(benchmark::State& state) const {
+	constexpr double NS_PER_US = 1000.0;
+	auto micros = [this](double percent) {
+		return static_cast<double>(percentile(percent).count()) / NS_PER_US;
+	};
+	constexpr double P50 = 50.0;
+	constexpr double P99 = 99.0;
+	constexpr double P999 = 99.9;
+	state.counters["p50_us"] = micros(P50);
+	state.counters["p99_us"] = micros(P99);
+	state.counters["p999_us"] = micros(P999);
+}
+
+// Values below SUB_BUCKETS each get their own bucket. Above that, the
+// bucket is chosen by the value's highest set bit (the shift) and the next
+// SUB_BUCKET_BITS - 1 bits below it.
+size_t LatencyHistogram::bucketFor(uint64_t value) noexcept {
+	if (value < SUB_BUCKETS) {
+		return static_cast<size_t>(value);
+	}
+	uint32_t shift = 0;
+	while ((value >> shift) >= SUB_BUCKETS) {
+		++shift;
+	}
+	return static_cast<size_t>((shift * HALF_SUB_BUCKETS) + (value >> shift));
+}
+
+uint64_t LatencyHistogram::highestValueIn(size_t bucket) noexcept {
+	if (bucket < SUB_BUCKETS) {
+		return bucket;
+	}
+	const auto shift = (bucket / HALF_SUB_BUCKETS) - 1;
+	const auto top = (bucket % HALF_SUB_BUCKETS) + HALF_SUB_BUCKETS;
+	return ((top + 1) << shift) - 1;
+}
+
+}  // namespace uprotocol::benchmarks
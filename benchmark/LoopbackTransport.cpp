@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "LoopbackTransport.h"
+
+#include <utility>
+
+namespace uprotocol::benchmarks {
+
+LoopbackBus::LoopbackBus() : receiver_([this]() { deliverAll(); }) {}
+
+LoopbackBus::~LoopbackBus() {
+	{
+		std::lock_guard lock(queue_mtx_);
+		stop_ = true;
+	}
+	queue_cv_.notify_one();
+	receiver_.join();
+}
+
+void LoopbackBus::post(const v1::UMessage& message) {
+	{
+		std::lock_guard lock(queue_mtx_);
+		queue_.push_back(message);
+	}
+	queue_cv_.notify_one();
+}
+
+void LoopbackBus::addListener(CallableConn&& listener,
+                              const v1::UUri& source_filter,
+                              const std::optional<v1::UUri>& sink_filter) {
+	Filter filter{datamodel::PackedUUri(source_filter), std::nullopt};
+	if (sink_filter) {
+		filter.sink = datamodel::PackedUUri(*sink_filter);
+	}
+	std::lock_guard lock(listeners_mtx_);
+	listeners_.emplace(std::move(listener), filter);
+}
+
+void LoopbackBus::removeListener(const CallableConn& listener) {
+	std::lock_guard lock(listeners_mtx_);
+	listeners_.erase(listener);
+}
+
+size_t LoopbackBus::listenerCount() const {
+	std::lock_guard lock(listeners_mtx_);
+	return listeners_.size();
+}
+
+bool LoopbackBus::matches(const Filter& filter,
+                          const datamodel::PackedUUri& source,
+                          const std::optional<datamodel::PackedUUri>& sink) {
+	if (!filter.source.matches(source)) {
+		return false;
+	}
+	if (!filter.sink) {
+		return true;
+	}
+	return sink && filter.sink->matches(*sink);
+}
+
+void LoopbackBus::deliverAll() {
+	std::vector<CallableConn> matched;
+	while (true) {
+		v1::UMessage message;
+		{
+			std::unique_lock lock(queue_mtx_);
+			queue_cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+			if (stop_) {
+				return;
+			}
+			message = std::move(queue_.front());
+			queue_.pop_front();
+		}
+
+		const auto& attributes = message.attributes();
+		const datamodel::PackedUUri source(attributes.source());
+		std::optional<datamodel::PackedUUri> sink;
+		if (attributes.has_sink()) {
+			sink = datamodel::PackedUUri(attributes.sink());
+		}
+
+		{
+			std::lock_guard lock(listeners_mtx_);
+			for (const auto& [listener, filter] : listeners_) {
+				if (matches(filter, source, sink)) {
+					matched.push_back(listener);
+				}
+			}
+		}
+
+		for (auto& listener : matched) {
+			listener(message);
+		}
+		matched.clear();
+	}
+}
+
+v1::UStatus LoopbackTransport::sendImpl(const v1::UMessage& message) {
+	bus_->post(message);
+	return {};
+}
+
+v1::UStatus LoopbackTransport::registerListenerImpl(
+    CallableConn&& listener, const v1::UUri& source_filter,
+    std::optional<v1::UUri>&& sink_filter) {
+	bus_->addListener(std::move(listener), source_filter, sink_filter);
+	return {};
+}
+
+void LoopbackTransport::cleanupListener(const CallableConn& listener) {
+	bus_->removeListener(listener);
+}
+
+}  // namespace uprotocol::benchmarks
@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/communication/NotificationSink.h>
+#include <up-cpp/communication/NotificationSource.h>
+#include <up-cpp/communication/Publisher.h>
+#include <up-cpp/communication/Subscriber.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "LatencyHistogram.h"
+#include "LoopbackTransport.h"
+#include "ProcessCpuTimer.h"
+
+namespace {
+
+using uprotocol::benchmarks::LatencyHistogram;
+using uprotocol::benchmarks::LoopbackBus;
+using uprotocol::benchmarks::LoopbackTransport;
+using uprotocol::benchmarks::ProcessCpuTimer;
+using uprotocol::communication::NotificationSink;
+using uprotocol::communication::NotificationSource;
+using uprotocol::communication::Publisher;
+using uprotocol::communication::Subscriber;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UUri;
+using Clock = std::chrono::steady_clock;
+
+constexpr auto FORMAT = UPayloadFormat::UPAYLOAD_FORMAT_RAW;
+
+UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	UUri uri;
+	uri.set_authority_name("loopback");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+constexpr uint32_t SOURCE_UE_ID = 0x10001;
+constexpr uint32_t FIRST_RECEIVER_UE_ID = 0x20001;
+constexpr uint32_t TOPIC_RESOURCE_ID = 0x8001;
+
+// Send time is carried in the first bytes of every payload so that
+// receivers can measure latency
+Payload stampedPayload(std::string& body) {
+	const auto now = Clock::now().time_since_epoch().count();
+	std::memcpy(body.data(), &now, sizeof(now));
+	return Payload(body, FORMAT);
+}
+
+Clock::duration elapsedSince(const UMessage& message) {
+	Clock::rep sent = 0;
+	std::memcpy(&sent, message.payload().data(), sizeof(sent));
+	return Clock::now().time_since_epoch() - Clock::duration(sent);
+}
+
+// Counts deliveries and records latency from any receiver thread
+struct Receivers {
+	explicit Receivers(size_t expected_per_burst)
+	    : expected_(expected_per_burst) {}
+
+	void onMessage(const UMessage& message) {
+		const auto elapsed = elapsedSince(message);
+		std::lock_guard lock(mtx_);
+		latency_.record(elapsed);
+		if (++received_ == expected_) {
+			cv_.notify_one();
+		}
+	}
+
+	void startBurst() {
+		std::lock_guard lock(mtx_);
+		received_ = 0;
+	}
+
+	void waitForBurst() {
+		std::unique_lock lock(mtx_);
+		cv_.wait(lock, [this]() { return received_ == expected_; });
+	}
+
+	void report(benchmark::State& state, const ProcessCpuTimer& cpu) const {
+		const auto total =
+		    static_cast<uint64_t>(state.iterations()) * expected_;
+		state.SetItemsProcessed(static_cast<int64_t>(total));
+		cpu.report(state, total);
+		latency_.report(state);
+	}
+
+private:
+	const size_t expected_;
+	std::mutex mtx_;
+	std::condition_variable cv_;
+	size_t received_{0};
+	LatencyHistogram latency_;
+};
+
+// Each iteration publishes a burst of messages back to back, then waits
+// until every subscriber has received all of them.
+//
+// Args: messages per burst, payload size in bytes (at least 8), subscribers
+//
+// Counters:
+//   * items_per_second - messages received per second, across subscribers
+//   * p50_us, p99_us, p999_us - publish to receive latency
+//   * cpu_us/msg - process CPU time per message received
+void publishBurst(benchmark::State& state) {
+	const auto burst = static_cast<size_t>(state.range(0));
+	std::string body(static_cast<size_t>(state.range(1)), 'x');
+	const auto num_subscribers = static_cast<size_t>(state.range(2));
+
+	auto bus = std::make_shared<LoopbackBus>();
+	const auto topic = makeUri(SOURCE_UE_ID, TOPIC_RESOURCE_ID);
+	Publisher publisher(
+	    std::make_shared<LoopbackTransport>(bus, makeUri(SOURCE_UE_ID, 0)),
+	    UUri(topic), FORMAT);
+
+	Receivers receivers(burst * num_subscribers);
+	std::vector<std::unique_ptr<Subscriber>> subscribers;
+	for (size_t i = 0; i < num_subscribers; ++i) {
+		auto subscriber = Subscriber::subscribe(
+		    std::make_shared<LoopbackTransport>(
+		        bus, makeUri(FIRST_RECEIVER_UE_ID + static_cast<uint32_t>(i),
+		                     0)),
+		    topic,
+		    [&receivers](const UMessage& message) {
+			    receivers.onMessage(message);
+		    });
+		if (!subscriber) {
+			state.SkipWithError("Failed to subscribe");
+			return;
+		}
+		subscribers.push_back(std::move(subscriber).value());
+	}
+
+	ProcessCpuTimer cpu;
+	for (auto _ : state) {
+		receivers.startBurst();
+		for (size_t i = 0; i < burst; ++i) {
+			std::ignore = publisher.publish(stampedPayload(body));
+		}
+		receivers.waitForBurst();
+	}
+	receivers.report(state, cpu);
+}
+
+// As publishBurst(), with a NotificationSource sending to NotificationSinks.
+// Each sink is a separate uEntity.
+void notifyBurst(benchmark::State& state) {
+	const auto burst = static_cast<size_t>(state.range(0));
+	std::string body(static_cast<size_t>(state.range(1)), 'x');
+	const auto num_sinks = static_cast<size_t>(state.range(2));
+
+	auto bus = std::make_shared<LoopbackBus>();
+	const auto source = makeUri(SOURCE_UE_ID, TOPIC_RESOURCE_ID);
+	auto source_transport =
+	    std::make_shared<LoopbackTransport>(bus, makeUri(SOURCE_UE_ID, 0));
+
+	Receivers receivers(burst * num_sinks);
+	std::vector<NotificationSource> sources;
+	std::vector<std::unique_ptr<NotificationSink>> sinks;
+	sources.reserve(num_sinks);
+	for (size_t i = 0; i < num_sinks; ++i) {
+		auto sink_uri =
+		    makeUri(FIRST_RECEIVER_UE_ID + static_cast<uint32_t>(i), 0);
+		sources.emplace_back(source_transport, UUri(source), UUri(sink_uri),
+		                     FORMAT);
+		auto sink = NotificationSink::create(
+		    std::make_shared<LoopbackTransport>(bus, sink_uri),
+		    [&receivers](const UMessage& message) {
+			    receivers.onMessage(message);
+		    },
+		    source);
+		if (!sink) {
+			state.SkipWithError("Failed to create NotificationSink");
+			return;
+		}
+		sinks.push_back(std::move(sink).value());
+	}
+
+	ProcessCpuTimer cpu;
+	for (auto _ : state) {
+		receivers.startBurst();
+		for (size_t i = 0; i < burst; ++i) {
+			for (const auto& notification_source : sources) {
+				std::ignore = notification_source.notify(stampedPayload(body));
+			}
+		}
+		receivers.waitForBurst();
+	}
+	receivers.report(state, cpu);
+}
+
+constexpr int64_t MIN_PAYLOAD = 8;
+constexpr int64_t MEDIUM_PAYLOAD = 1024;
+constexpr int64_t LARGE_PAYLOAD = 64 * 1024;
+constexpr int64_t MAX_BURST = 10000;
+constexpr int BURST_MULTIPLIER = 10;
+constexpr int64_t FAN_OUT_BURST = 100;
+constexpr int64_t MAX_RECEIVERS = 64;
+constexpr int RECEIVER_MULTIPLIER = 4;
+
+BENCHMARK(publishBurst)
+    ->ArgNames({"burst", "bytes", "subscribers"})
+    ->ArgsProduct({benchmark::CreateRange(1, MAX_BURST, BURST_MULTIPLIER),
+                   {MIN_PAYLOAD, MEDIUM_PAYLOAD, LARGE_PAYLOAD},
+                   {1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(publishBurst)
+    ->ArgNames({"burst", "bytes", "subscribers"})
+    ->ArgsProduct({{FAN_OUT_BURST},
+                   {MIN_PAYLOAD},
+                   benchmark::CreateRange(RECEIVER_MULTIPLIER, MAX_RECEIVERS,
+                                          RECEIVER_MULTIPLIER)})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(notifyBurst)
+    ->ArgNames({"burst", "bytes", "sinks"})
+    ->ArgsProduct({benchmark::CreateRange(1, MAX_BURST, BURST_MULTIPLIER),
+                   {MIN_PAYLOAD, LARGE_PAYLOAD},
+                   {1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(notifyBurst)
+    ->ArgNames({"burst", "bytes", "sinks"})
+    ->ArgsProduct({{FAN_OUT_BURST},
+                   {MIN_PAYLOAD},
+                   benchmark::CreateRange(RECEIVER_MULTIPLIER, MAX_RECEIVERS,
+                                          RECEIVER_MULTIPLIER)})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/RpcServer.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "LatencyHistogram.h"
+#include "LoopbackTransport.h"
+#include "ProcessCpuTimer.h"
+
+namespace {
+
+using uprotocol::benchmarks::LatencyHistogram;
+using uprotocol::benchmarks::LoopbackBus;
+using uprotocol::benchmarks::LoopbackTransport;
+using uprotocol::benchmarks::ProcessCpuTimer;
+using uprotocol::communication::RpcClient;
+using uprotocol::communication::RpcServer;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UUri;
+
+constexpr auto FORMAT = UPayloadFormat::UPAYLOAD_FORMAT_RAW;
+
+UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	UUri uri;
+	uri.set_authority_name("loopback");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+const UUri& serverUri() {
+	static const auto URI = makeUri(0x10001, 0);
+	return URI;
+}
+
+const UUri& methodUri() {
+	static const auto URI = makeUri(0x10001, 0x0001);
+	return URI;
+}
+
+const UUri& clientUri() {
+	static const auto URI = makeUri(0x10002, 0);
+	return URI;
+}
+
+// Each iteration invokes a burst of requests back to back, so all of them
+// are in flight at once, then waits for every response (or timeout). The
+// server echoes the request payload.
+//
+// Args: requests in flight per burst, payload size in bytes, request TTL in
+//       milliseconds
+//
+// Counters:
+//   * items_per_second - completed requests per second
+//   * p50_us, p99_us, p999_us - request to response (or timeout) latency
+//   * cpu_us/msg - process CPU time per completed request
+//   * failed - requests that did not get an OK response
+//   * listeners - transport listeners still registered after the run
+void rpcBurst(benchmark::State& state) {
+	const auto in_flight = static_cast<size_t>(state.range(0));
+	const std::string body(static_cast<size_t>(state.range(1)), 'x');
+	const std::chrono::milliseconds ttl(state.range(2));
+
+	auto bus = std::make_shared<LoopbackBus>();
+	auto server_transport =
+	    std::make_shared<LoopbackTransport>(bus, serverUri());
+	auto client_transport =
+	    std::make_shared<LoopbackTransport>(bus, clientUri());
+
+	auto server = RpcServer::create(
+	    server_transport, methodUri(),
+	    [](const uprotocol::v1::UMessage& request) {
+		    return Payload(request.payload(), FORMAT);
+	    },
+	    FORMAT);
+	if (!server) {
+		state.SkipWithError("Failed to create RpcServer");
+		return;
+	}
+
+	std::mutex completion_mtx;
+	std::condition_variable completion_cv;
+	size_t completed = 0;
+	size_t failed = 0;
+	LatencyHistogram latency;
+
+	RpcClient client(client_transport, uprotocol::v1::UPRIORITY_CS4, ttl,
+	                 FORMAT);
+	// Declared after everything the callbacks reference so that the
+	// callbacks are disconnected first
+	std::vector<RpcClient::InvokeHandle> handles;
+	handles.reserve(in_flight);
+
+	ProcessCpuTimer cpu;
+	for (auto _ : state) {
+		{
+			std::lock_guard lock(completion_mtx);
+			completed = 0;
+		}
+		handles.clear();
+
+		for (size_t i = 0; i < in_flight; ++i) {
+			const auto start = std::chrono::steady_clock::now();
+			handles.push_back(client.invokeMethod(
+			    methodUri(), Payload(body, FORMAT),
+			    [&, start](const RpcClient::MessageOrStatus& response) {
+				    const auto elapsed =
+				        std::chrono::steady_clock::now() - start;
+				    std::lock_guard lock(completion_mtx);
+				    latency.record(elapsed);
+				    if (!response) {
+					    ++failed;
+				    }
+				    if (++completed == in_flight) {
+					    completion_cv.notify_one();
+				    }
+			    }));
+		}
+
+		std::unique_lock lock(completion_mtx);
+		completion_cv.wait(lock, [&]() { return completed == in_flight; });
+	}
+
+	const auto total = static_cast<uint64_t>(state.iterations()) * in_flight;
+	state.SetItemsProcessed(static_cast<int64_t>(total));
+	cpu.report(state, total);
+	latency.report(state);
+	state.counters["failed"] = static_cast<double>(failed);
+	state.counters["listeners"] = static_cast<double>(bus->listenerCount());
+}
+
+constexpr int64_t SMALL_PAYLOAD = 64;
+constexpr int64_t LARGE_PAYLOAD = 64 * 1024;
+constexpr int64_t SHORT_TTL_MS = 100;
+constexpr int64_t DEFAULT_TTL_MS = 1000;
+constexpr int64_t LONG_TTL_MS = 10000;
+constexpr int64_t MAX_IN_FLIGHT = 100000;
+constexpr int IN_FLIGHT_MULTIPLIER = 10;
+constexpr int64_t PAYLOAD_SWEEP_IN_FLIGHT = 10;
+constexpr int64_t TTL_SWEEP_IN_FLIGHT = 100;
+
+// Scaling with requests in flight. Every request registers its own response
+// listener, which is only released by the ExpireWorker when the request's
+// TTL passes, so the transport checks every response against every
+// outstanding listener.
+BENCHMARK(rpcBurst)
+    ->ArgNames({"in_flight", "bytes", "ttl_ms"})
+    ->ArgsProduct({benchmark::CreateRange(1, MAX_IN_FLIGHT,
+                                          IN_FLIGHT_MULTIPLIER),
+                   {SMALL_PAYLOAD},
+                   {DEFAULT_TTL_MS}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// Payload size
+BENCHMARK(rpcBurst)
+    ->ArgNames({"in_flight", "bytes", "ttl_ms"})
+    ->Args({PAYLOAD_SWEEP_IN_FLIGHT, 0, DEFAULT_TTL_MS})
+    ->Args({PAYLOAD_SWEEP_IN_FLIGHT, LARGE_PAYLOAD, DEFAULT_TTL_MS})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// TTL. Longer TTLs keep completed requests' listeners registered longer.
+BENCHMARK(rpcBurst)
+    ->ArgNames({"in_flight", "bytes", "ttl_ms"})
+    ->Args({TTL_SWEEP_IN_FLIGHT, SMALL_PAYLOAD, SHORT_TTL_MS})
+    ->Args({TTL_SWEEP_IN_FLIGHT, SMALL_PAYLOAD, LONG_TTL_MS})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
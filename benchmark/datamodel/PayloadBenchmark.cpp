@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/Payload.h>
+#include <uprotocol/v1/uri.pb.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::v1::UPayloadFormat;
+
+constexpr auto TEXT = UPayloadFormat::UPAYLOAD_FORMAT_TEXT;
+constexpr auto RAW = UPayloadFormat::UPAYLOAD_FORMAT_RAW;
+
+constexpr int64_t SMALL_PAYLOAD = 16;
+constexpr int64_t MEDIUM_PAYLOAD = 1024;
+constexpr int64_t LARGE_PAYLOAD = 64 * 1024;
+
+std::string makeText(const benchmark::State& state) {
+	return std::string(static_cast<size_t>(state.range(0)), 'x');
+}
+
+void fromStringCopy(benchmark::State& state) {
+	const auto text = makeText(state);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload payload(text, TEXT);
+		benchmark::DoNotOptimize(payload);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Includes the cost of creating the string being moved in
+void fromStringMove(benchmark::State& state) {
+	const auto text = makeText(state);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto value = text;
+		Payload payload(std::move(value), TEXT);
+		benchmark::DoNotOptimize(payload);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void fromBytesCopy(benchmark::State& state) {
+	const std::vector<uint8_t> bytes(static_cast<size_t>(state.range(0)));
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload payload(bytes, RAW);
+		benchmark::DoNotOptimize(payload);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void fromSharedBuffer(benchmark::State& state) {
+	const auto buffer = std::make_shared<const std::string>(makeText(state));
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload payload(buffer, TEXT);
+		benchmark::DoNotOptimize(payload);
+	}
+}
+
+void fromProtobuf(benchmark::State& state) {
+	uprotocol::v1::UUri uri;
+	uri.set_authority_name("vehicle-ecu-1.example.com");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(0x8001);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload payload(uri);
+		benchmark::DoNotOptimize(payload);
+	}
+}
+
+void moveConstruct(benchmark::State& state) {
+	Payload payload(makeText(state), TEXT);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload moved(std::move(payload));
+		benchmark::DoNotOptimize(moved);
+		payload = std::move(moved);
+	}
+}
+
+void moveAssign(benchmark::State& state) {
+	Payload first(makeText(state), TEXT);
+	Payload second(makeText(state), TEXT);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		first = std::move(second);
+		second = std::move(first);
+		benchmark::DoNotOptimize(second);
+	}
+}
+
+void buildMove(benchmark::State& state) {
+	const auto text = makeText(state);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		Payload payload(text, TEXT);
+		auto serialized = std::move(payload).buildMove();
+		benchmark::DoNotOptimize(serialized);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void buildInto(benchmark::State& state) {
+	const auto text = makeText(state);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		uprotocol::v1::UMessage message;
+		Payload payload(text, TEXT);
+		std::move(payload).buildInto(message);
+		benchmark::DoNotOptimize(message);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(fromStringCopy)
+    ->Arg(SMALL_PAYLOAD)
+    ->Arg(MEDIUM_PAYLOAD)
+    ->Arg(LARGE_PAYLOAD);
+BENCHMARK(fromStringMove)
+    ->Arg(SMALL_PAYLOAD)
+    ->Arg(MEDIUM_PAYLOAD)
+    ->Arg(LARGE_PAYLOAD);
+BENCHMARK(fromBytesCopy)
+    ->Arg(SMALL_PAYLOAD)
+    ->Arg(MEDIUM_PAYLOAD)
+    ->Arg(LARGE_PAYLOAD);
+BENCHMARK(fromSharedBuffer)->Arg(LARGE_PAYLOAD);
+BENCHMARK(fromProtobuf);
+BENCHMARK(moveConstruct)->Arg(SMALL_PAYLOAD)->Arg(LARGE_PAYLOAD);
+BENCHMARK(moveAssign)->Arg(SMALL_PAYLOAD)->Arg(LARGE_PAYLOAD);
+BENCHMARK(buildMove)->Arg(SMALL_PAYLOAD)->Arg(LARGE_PAYLOAD);
+BENCHMARK(buildInto)->Arg(SMALL_PAYLOAD)->Arg(LARGE_PAYLOAD);
+
+}  // namespace
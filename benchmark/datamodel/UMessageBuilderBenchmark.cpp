@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/Payload.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+
+#include <chrono>
+#include <string>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UUri;
+
+UUri makeUri(uint32_t resource_id) {
+	UUri uri;
+	uri.set_authority_name("vehicle-ecu-1.example.com");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+constexpr std::chrono::milliseconds TTL(1000);
+
+UMessageBuilder publishBuilder() {
+	return UMessageBuilder::publish(makeUri(0x8001));
+}
+
+UMessageBuilder notificationBuilder() {
+	return UMessageBuilder::notification(makeUri(0x8001), makeUri(0));
+}
+
+UMessageBuilder requestBuilder() {
+	return UMessageBuilder::request(makeUri(0x0001), makeUri(0),
+	                                uprotocol::v1::UPRIORITY_CS4, TTL);
+}
+
+UMessageBuilder responseBuilder() {
+	static const auto REQUEST = requestBuilder().build();
+	return UMessageBuilder::response(REQUEST);
+}
+
+template <UMessageBuilder (*MakeBuilder)()>
+void build(benchmark::State& state) {
+	const auto builder = MakeBuilder();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto message = builder.build();
+		benchmark::DoNotOptimize(message);
+	}
+}
+
+// Payload construction is part of the measurement, as it is for a caller
+template <UMessageBuilder (*MakeBuilder)()>
+void buildWithPayload(benchmark::State& state) {
+	const auto builder = MakeBuilder();
+	const std::string text(static_cast<size_t>(state.range(0)), 'x');
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto message =
+		    builder.build(Payload(text, UPayloadFormat::UPAYLOAD_FORMAT_TEXT));
+		benchmark::DoNotOptimize(message);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <UMessageBuilder (*MakeBuilder)()>
+void buildAttributesFor(benchmark::State& state) {
+	const auto builder = MakeBuilder();
+	const Payload payload(std::string("payload"),
+	                      UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto message = builder.buildAttributesFor(payload);
+		benchmark::DoNotOptimize(message);
+	}
+}
+
+// Request builder reused across several methods of the same service
+void buildForMethod(benchmark::State& state) {
+	const auto builder = requestBuilder();
+	const auto method = makeUri(0x0002);
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto message = builder.build(method);
+		benchmark::DoNotOptimize(message);
+	}
+}
+
+constexpr int64_t SMALL_PAYLOAD = 64;
+constexpr int64_t LARGE_PAYLOAD = 64 * 1024;
+
+BENCHMARK_TEMPLATE(build, publishBuilder);
+BENCHMARK_TEMPLATE(build, notificationBuilder);
+BENCHMARK_TEMPLATE(build, requestBuilder);
+BENCHMARK_TEMPLATE(build, responseBuilder);
+BENCHMARK_TEMPLATE(buildWithPayload, publishBuilder)
+    ->Arg(SMALL_PAYLOAD)
+    ->Arg(LARGE_PAYLOAD);
+BENCHMARK_TEMPLATE(buildWithPayload, requestBuilder)
+    ->Arg(SMALL_PAYLOAD)
+    ->Arg(LARGE_PAYLOAD);
+BENCHMARK_TEMPLATE(buildAttributesFor, publishBuilder);
+BENCHMARK(buildForMethod);
+
+}  // namespace
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/validator/UMessage.h>
+
+#include <chrono>
+#include <vector>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::datamodel::builder::UMessageBuilder;
+namespace message_validator = uprotocol::datamodel::validator::message;
+
+uprotocol::v1::UUri makeUri(uint32_t resource_id) {
+	uprotocol::v1::UUri uri;
+	uri.set_authority_name("vehicle.example");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+constexpr std::chrono::hours LONG_TTL(1);
+
+const uprotocol::v1::UMessage& publishMessage() {
+	static const auto MESSAGE =
+	    UMessageBuilder::publish(makeUri(0x8001)).build();
+	return MESSAGE;
+}
+
+const uprotocol::v1::UMessage& requestMessage() {
+	static const auto MESSAGE =
+	    UMessageBuilder::request(makeUri(0x0001), makeUri(0),
+	                             uprotocol::v1::UPRIORITY_CS4,
+	                             std::chrono::milliseconds(LONG_TTL))
+	        .build();
+	return MESSAGE;
+}
+
+const uprotocol::v1::UMessage& responseMessage() {
+	static const auto MESSAGE =
+	    UMessageBuilder::response(requestMessage())
+	        .withTtl(std::chrono::milliseconds(LONG_TTL))
+	        .build();
+	return MESSAGE;
+}
+
+template <const uprotocol::v1::UMessage& (*GetMessage)()>
+void isValid(benchmark::State& state) {
+	const auto& message = GetMessage();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = message_validator::isValid(message);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+// One clock read shared by every message, as a batch receiver would do
+template <const uprotocol::v1::UMessage& (*GetMessage)()>
+void isValidAtTime(benchmark::State& state) {
+	const auto& message = GetMessage();
+	const auto now = std::chrono::system_clock::now();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = message_validator::isValid(message, now);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+template <const uprotocol::v1::UMessage& (*GetMessage)()>
+void allFailures(benchmark::State& state) {
+	const auto& message = GetMessage();
+	const auto now = std::chrono::system_clock::now();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = message_validator::allFailures(message, now);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+const uprotocol::v1::UMessage& notificationMessage() {
+	static const auto MESSAGE =
+	    UMessageBuilder::notification(makeUri(0x8001), makeUri(0)).build();
+	return MESSAGE;
+}
+
+using MessageCheck =
+    message_validator::ValidationResult (*)(const uprotocol::v1::UMessage&);
+
+template <MessageCheck Check, const uprotocol::v1::UMessage& (*GetMessage)()>
+void validate(benchmark::State& state) {
+	const auto& message = GetMessage();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = Check(message);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+void isValidRpcResponseFor(benchmark::State& state) {
+	const auto& request = requestMessage();
+	const auto& response = responseMessage();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result =
+		    message_validator::isValidRpcResponseFor(request, response);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+// A burst of mixed messages, as a transport might receive
+std::vector<uprotocol::v1::UMessage> makeBurst() {
+	constexpr size_t BURST_SIZE = 64;
+	std::vector<uprotocol::v1::UMessage> burst;
+	burst.reserve(BURST_SIZE);
+	while (burst.size() < BURST_SIZE) {
+		burst.push_back(publishMessage());
+		burst.push_back(requestMessage());
+		burst.push_back(responseMessage());
+		burst.push_back(publishMessage());
+	}
+	return burst;
+}
+
+void isValidEach(benchmark::State& state) {
+	const auto burst = makeBurst();
+	std::vector<message_validator::BatchResult> results(burst.size());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		for (size_t i = 0; i < burst.size(); ++i) {
+			results[i] = std::get<1>(message_validator::isValid(burst[i]));
+		}
+		benchmark::DoNotOptimize(results.data());
+	}
+	state.SetItemsProcessed(
+	    static_cast<int64_t>(state.iterations() * burst.size()));
+}
+
+void validateBatch(benchmark::State& state) {
+	const auto burst = makeBurst();
+	std::vector<message_validator::BatchResult> results(burst.size());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto num_valid = message_validator::validateBatch(burst, results);
+		benchmark::DoNotOptimize(num_valid);
+	}
+	state.SetItemsProcessed(
+	    static_cast<int64_t>(state.iterations() * burst.size()));
+}
+
+BENCHMARK_TEMPLATE(isValid, publishMessage);
+BENCHMARK_TEMPLATE(isValid, requestMessage);
+BENCHMARK_TEMPLATE(isValid, responseMessage);
+BENCHMARK_TEMPLATE(isValidAtTime, publishMessage);
+BENCHMARK_TEMPLATE(isValidAtTime, requestMessage);
+BENCHMARK_TEMPLATE(isValidAtTime, responseMessage);
+BENCHMARK_TEMPLATE(allFailures, publishMessage);
+BENCHMARK_TEMPLATE(allFailures, requestMessage);
+BENCHMARK_TEMPLATE(allFailures, responseMessage);
+BENCHMARK_TEMPLATE(isValid, notificationMessage);
+BENCHMARK_TEMPLATE(validate, message_validator::areCommonAttributesValid,
+                   publishMessage);
+BENCHMARK_TEMPLATE(validate, message_validator::isValidRpcRequest,
+                   requestMessage);
+BENCHMARK_TEMPLATE(validate, message_validator::isValidRpcResponse,
+                   responseMessage);
+BENCHMARK_TEMPLATE(validate, message_validator::isValidPublish,
+                   publishMessage);
+BENCHMARK_TEMPLATE(validate, message_validator::isValidNotification,
+                   notificationMessage);
+BENCHMARK(isValidRpcResponseFor);
+BENCHMARK(isValidEach);
+BENCHMARK(validateBatch);
+
+}  // namespace
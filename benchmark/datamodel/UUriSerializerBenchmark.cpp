@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/serializer/UUri.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::datamodel::serializer::uri::AsString;
+
+uprotocol::v1::UUri makeUri(const std::string& authority, uint32_t ue_id,
+                            uint32_t version, uint32_t resource_id) {
+	uprotocol::v1::UUri uri;
+	uri.set_authority_name(authority);
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(version);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+const uprotocol::v1::UUri& localUri() {
+	static const auto URI = makeUri("", 0x10010001, 0xFE, 0x7500);
+	return URI;
+}
+
+const uprotocol::v1::UUri& remoteUri() {
+	static const auto URI =
+	    makeUri("vehicle-ecu-1.example.com", 0x10010001, 0xFE, 0x8001);
+	return URI;
+}
+
+const uprotocol::v1::UUri& wildcardUri() {
+	static const auto URI = makeUri("*", 0xFFFFFFFF, 0xFF, 0xFFFF);
+	return URI;
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void serializeToNewString(benchmark::State& state) {
+	const auto& uri = GetUri();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto str = AsString::serialize(uri);
+		benchmark::DoNotOptimize(str);
+	}
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void serializeToReusedString(benchmark::State& state) {
+	const auto& uri = GetUri();
+	std::string str;
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		AsString::serialize(uri, str);
+		benchmark::DoNotOptimize(str.data());
+	}
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void serializeToBuffer(benchmark::State& state) {
+	const auto& uri = GetUri();
+	AsString::Buffer buffer{};
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto length = AsString::serialize(uri, buffer);
+		benchmark::DoNotOptimize(length);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void deserialize(benchmark::State& state) {
+	const auto str = AsString::serialize(GetUri());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto uri = AsString::deserialize(str);
+		benchmark::DoNotOptimize(uri);
+	}
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void tryDeserialize(benchmark::State& state) {
+	const auto str = AsString::serialize(GetUri());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto uri = AsString::tryDeserialize(str);
+		benchmark::DoNotOptimize(uri);
+	}
+}
+
+void deserializeInvalid(benchmark::State& state) {
+	const std::string str = "//192.168.1.10/10010001/FE/FE/7500";
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		try {
+			auto uri = AsString::deserialize(str);
+			benchmark::DoNotOptimize(uri);
+		} catch (const std::invalid_argument& e) {
+			benchmark::DoNotOptimize(e);
+		}
+	}
+}
+
+void tryDeserializeInvalid(benchmark::State& state) {
+	const std::string str = "//192.168.1.10/10010001/FE/FE/7500";
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto uri = AsString::tryDeserialize(str);
+		benchmark::DoNotOptimize(uri);
+	}
+}
+
+// UUri has no dedicated byte serializer. Its byte form is the protobuf wire
+// encoding.
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void serializeToBytes(benchmark::State& state) {
+	const auto& uri = GetUri();
+	std::string bytes;
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		uri.SerializeToString(&bytes);
+		benchmark::DoNotOptimize(bytes.data());
+	}
+}
+
+template <const uprotocol::v1::UUri& (*GetUri)()>
+void deserializeFromBytes(benchmark::State& state) {
+	const auto bytes = GetUri().SerializeAsString();
+	uprotocol::v1::UUri uri;
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto ok = uri.ParseFromString(bytes);
+		benchmark::DoNotOptimize(ok);
+		benchmark::DoNotOptimize(uri);
+	}
+}
+
+BENCHMARK_TEMPLATE(serializeToNewString, localUri);
+BENCHMARK_TEMPLATE(serializeToNewString, remoteUri);
+BENCHMARK_TEMPLATE(serializeToNewString, wildcardUri);
+BENCHMARK_TEMPLATE(serializeToReusedString, localUri);
+BENCHMARK_TEMPLATE(serializeToReusedString, remoteUri);
+BENCHMARK_TEMPLATE(serializeToReusedString, wildcardUri);
+BENCHMARK_TEMPLATE(serializeToBuffer, localUri);
+BENCHMARK_TEMPLATE(serializeToBuffer, remoteUri);
+BENCHMARK_TEMPLATE(serializeToBuffer, wildcardUri);
+BENCHMARK_TEMPLATE(deserialize, localUri);
+BENCHMARK_TEMPLATE(deserialize, remoteUri);
+BENCHMARK_TEMPLATE(deserialize, wildcardUri);
+BENCHMARK_TEMPLATE(tryDeserialize, localUri);
+BENCHMARK_TEMPLATE(tryDeserialize, remoteUri);
+BENCHMARK_TEMPLATE(tryDeserialize, wildcardUri);
+BENCHMARK_TEMPLATE(serializeToBytes, localUri);
+BENCHMARK_TEMPLATE(serializeToBytes, remoteUri);
+BENCHMARK_TEMPLATE(deserializeFromBytes, localUri);
+BENCHMARK_TEMPLATE(deserializeFromBytes, remoteUri);
+BENCHMARK(deserializeInvalid);
+BENCHMARK(tryDeserializeInvalid);
+
+}  // namespace
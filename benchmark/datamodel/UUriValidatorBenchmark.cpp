@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::v1::UUri;
+namespace uri_validator = uprotocol::datamodel::validator::uri;
+
+UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	UUri uri;
+	uri.set_authority_name("vehicle-ecu-1.example.com");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+const UUri& topicUri() {
+	static const auto URI = makeUri(0x10010001, 0x8001);
+	return URI;
+}
+
+const UUri& methodUri() {
+	static const auto URI = makeUri(0x10010001, 0x0001);
+	return URI;
+}
+
+const UUri& entityUri() {
+	static const auto URI = makeUri(0x10010001, 0);
+	return URI;
+}
+
+const UUri& wildcardUri() {
+	static const auto URI = makeUri(0xFFFFFFFF, 0xFFFF);
+	return URI;
+}
+
+using UriCheck = uri_validator::ValidationResult (*)(const UUri&);
+using ClassificationCheck =
+    uri_validator::ValidationResult (*)(const uri_validator::Classification&);
+using UriPredicate = bool (*)(const UUri&);
+
+template <UriCheck Check, const UUri& (*GetUri)()>
+void validate(benchmark::State& state) {
+	const auto& uri = GetUri();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = Check(uri);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+// Checks against a Classification computed once, as a caller checking
+// several forms of the same UUri would do
+template <ClassificationCheck Check, const UUri& (*GetUri)()>
+void validateClassified(benchmark::State& state) {
+	const auto classification = uri_validator::classify(GetUri());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = Check(classification);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+template <UriPredicate Check, const UUri& (*GetUri)()>
+void predicate(benchmark::State& state) {
+	const auto& uri = GetUri();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto result = Check(uri);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+template <const UUri& (*GetUri)()>
+void classify(benchmark::State& state) {
+	const auto& uri = GetUri();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto classification = uri_validator::classify(uri);
+		benchmark::DoNotOptimize(classification);
+	}
+}
+
+BENCHMARK_TEMPLATE(classify, topicUri);
+BENCHMARK_TEMPLATE(classify, wildcardUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidFilter, wildcardUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidRpcMethod, methodUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidRpcResponse, entityUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidDefaultEntity, entityUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidPublishTopic, topicUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidNotificationSource,
+                   topicUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidNotificationSink,
+                   entityUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isValidSubscription,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(validate, uri_validator::isEmpty, topicUri);
+BENCHMARK_TEMPLATE(validateClassified, uri_validator::isValidRpcMethod,
+                   methodUri);
+BENCHMARK_TEMPLATE(validateClassified, uri_validator::isValidPublishTopic,
+                   topicUri);
+BENCHMARK_TEMPLATE(validateClassified, uri_validator::isValidSubscription,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::isLocal, topicUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::verify_no_wildcards,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::has_wildcard_authority,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::has_wildcard_service_id,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::has_wildcard_service_instance_id,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::has_wildcard_version,
+                   wildcardUri);
+BENCHMARK_TEMPLATE(predicate, uri_validator::has_wildcard_resource_id,
+                   wildcardUri);
+
+}  // namespace
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/Uuid.h>
+#include <up-cpp/datamodel/serializer/Uuid.h>
+
+#include <string>
+#include <vector>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::datamodel::builder::UuidBuilder;
+namespace uuid_serializer = uprotocol::datamodel::serializer::uuid;
+
+const uprotocol::v1::UUID& uuid() {
+	static const auto UUID = UuidBuilder::getBuilder().build();
+	return UUID;
+}
+
+void uuidBuild(benchmark::State& state) {
+	auto builder = UuidBuilder::getBuilder();
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto id = builder.build();
+		benchmark::DoNotOptimize(id);
+	}
+}
+
+void uuidStringSerializeToNewString(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto str = uuid_serializer::AsString::serialize(uuid());
+		benchmark::DoNotOptimize(str);
+	}
+}
+
+void uuidStringSerializeToReusedString(benchmark::State& state) {
+	std::string str;
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		uuid_serializer::AsString::serialize(uuid(), str);
+		benchmark::DoNotOptimize(str.data());
+	}
+}
+
+void uuidStringSerializeToBuffer(benchmark::State& state) {
+	uuid_serializer::AsString::Buffer buffer{};
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		uuid_serializer::AsString::serialize(uuid(), buffer);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+}
+
+void uuidStringDeserialize(benchmark::State& state) {
+	const auto str = uuid_serializer::AsString::serialize(uuid());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto id = uuid_serializer::AsString::deserialize(str);
+		benchmark::DoNotOptimize(id);
+	}
+}
+
+void uuidStringTryDeserialize(benchmark::State& state) {
+	const auto str = uuid_serializer::AsString::serialize(uuid());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto id = uuid_serializer::AsString::tryDeserialize(str);
+		benchmark::DoNotOptimize(id);
+	}
+}
+
+void uuidBytesSerializeToVector(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto bytes = uuid_serializer::AsBytes::serialize(uuid());
+		benchmark::DoNotOptimize(bytes);
+	}
+}
+
+void uuidBytesSerializeToBuffer(benchmark::State& state) {
+	uuid_serializer::AsBytes::Buffer buffer{};
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		uuid_serializer::AsBytes::serialize(uuid(), buffer);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+}
+
+void uuidBytesDeserialize(benchmark::State& state) {
+	const auto bytes = uuid_serializer::AsBytes::serialize(uuid());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto id = uuid_serializer::AsBytes::deserialize(bytes);
+		benchmark::DoNotOptimize(id);
+	}
+}
+
+void uuidBytesTryDeserialize(benchmark::State& state) {
+	const auto bytes = uuid_serializer::AsBytes::serialize(uuid());
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto id = uuid_serializer::AsBytes::tryDeserialize(bytes);
+		benchmark::DoNotOptimize(id);
+	}
+}
+
+BENCHMARK(uuidBuild);
+BENCHMARK(uuidStringSerializeToNewString);
+BENCHMARK(uuidStringSerializeToReusedString);
+BENCHMARK(uuidStringSerializeToBuffer);
+BENCHMARK(uuidStringDeserialize);
+BENCHMARK(uuidStringTryDeserialize);
+BENCHMARK(uuidBytesSerializeToVector);
+BENCHMARK(uuidBytesSerializeToBuffer);
+BENCHMARK(uuidBytesDeserialize);
+BENCHMARK(uuidBytesTryDeserialize);
+
+}  // namespace
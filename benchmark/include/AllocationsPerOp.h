@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_BENCHMARK_ALLOCATIONSPEROP_H
+#define UP_CPP_BENCHMARK_ALLOCATIONSPEROP_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "AllocationCounter.h"
+
+namespace uprotocol::benchmarks {
+
+/// @brief Reports the heap allocations made by the benchmark thread as an
+///        "allocs/op" counter, averaged over the benchmark's iterations.
+///
+/// Counts come from the test allocation counter, which the benchmark
+/// executable links to replace the global operator new.
+///
+/// Construct immediately before the benchmark loop, after any setup:
+///
+///     AllocationsPerOp allocations(state);
+///     for (auto _ : state) { ... }
+class AllocationsPerOp {
+public:
+	explicit AllocationsPerOp(benchmark::State& state)
+	    : state_(state), start_(allocations()) {}
+
+	~AllocationsPerOp() {
+		state_.counters["allocs/op"] = benchmark::Counter(
+		    static_cast<double>(allocations() - start_),
+		    benchmark::Counter::kAvgIterations);
+	}
+
+	AllocationsPerOp(const AllocationsPerOp&) = delete;
+	AllocationsPerOp& operator=(const AllocationsPerOp&) = delete;
+	AllocationsPerOp(AllocationsPerOp&&) = delete;
+	AllocationsPerOp& operator=(AllocationsPerOp&&) = delete;
+
+private:
+	static size_t allocations() noexcept {
+		return test::threadAllocations().allocations;
+	}
+
+	benchmark::State& state_;
+	const size_t start_;
+};
+
+}  // namespace uprotocol::benchmarks
+
+#endif  // UP_CPP_BENCHMARK_ALLOCATIONSPEROP_H
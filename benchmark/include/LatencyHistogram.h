@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_BENCHMARK_LATENCYHISTOGRAM_H
+#define UP_CPP_BENCHMARK_LATENCYHISTOGRAM_H
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace uprotocol::benchmarks {
+
+/// @brief High dynamic range latency histogram.
+///
+/// Values are recorded in log-linear buckets in the style of HdrHistogram:
+/// each power of two is split into 64 equal sub-buckets, so any recorded
+/// value is reported within 1/64 (about 1.6%) of its true value, from 1ns up
+/// to hundreds of years, in a fixed 30KiB of counters.
+///
+/// @remarks Not thread safe. Record from one thread at a time.
+class LatencyHistogram {
+public:
+	void record(std::chrono::nanoseconds latency) noexcept;
+
+	/// @brief Gets the number of values recorded.
+	[[nodiscard]] uint64_t count() const noexcept { return count_; }
+
+	/// @brief Gets the value at a given percentile (0 to 100).
+	///
+	/// @returns The highest value equivalent to the bucket containing the
+	///          percentile, or zero if nothing has been recorded.
+	[[nodiscard]] std::chrono::nanoseconds percentile(
+	    double percent) const noexcept;
+
+	/// @brief Adds p50, p99 and p999 counters (in microseconds) to a
+	///        benchmark's results.
+	void report(benchmark::State& state) const;
+
+private:
+	static constexpr uint32_t SUB_BUCKET_BITS = 7;
+	static constexpr uint64_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;
+	static constexpr uint64_t HALF_SUB_BUCKETS = SUB_BUCKETS / 2;
+	static constexpr size_t NUM_BUCKETS =
+	    (64 - SUB_BUCKET_BITS + 2) * HALF_SUB_BUCKETS;
+
+	static size_t bucketFor(uint64_t value) noexcept;
+	static uint64_t highestValueIn(size_t bucket) noexcept;
+
+	std::array<uint64_t, NUM_BUCKETS> counts_{};
+	uint64_t count_{0};
+};
+
+}  // namespace uprotocol::benchmarks
+
+#endif  // UP_CPP_BENCHMARK_LATENCYHISTOGRAM_H
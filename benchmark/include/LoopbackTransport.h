@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_BENCHMARK_LOOPBACKTRANSPORT_H
+#define UP_CPP_BENCHMARK_LOOPBACKTRANSPORT_H
+
+#include <up-cpp/datamodel/PackedUUri.h>
+#include <up-cpp/transport/UTransport.h>
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace uprotocol::benchmarks {
+
+/// @brief In-process message bus shared by a set of LoopbackTransports.
+///
+/// Messages sent on any attached transport are queued and delivered in order
+/// by a single receive thread, as a network transport would deliver them.
+/// Every registered listener is checked against every message, and matching
+/// listeners are called without any bus lock held so they may send messages
+/// or register and reset listeners themselves.
+class LoopbackBus {
+public:
+	using CallableConn =
+	    utils::callbacks::CallerHandle<void, const v1::UMessage&>;
+
+	LoopbackBus();
+	~LoopbackBus();
+
+	LoopbackBus(const LoopbackBus&) = delete;
+	LoopbackBus& operator=(const LoopbackBus&) = delete;
+	LoopbackBus(LoopbackBus&&) = delete;
+	LoopbackBus& operator=(LoopbackBus&&) = delete;
+
+	/// @brief Queues a message for delivery.
+	void post(const v1::UMessage&);
+
+	void addListener(CallableConn&& listener, const v1::UUri& source_filter,
+	                 const std::optional<v1::UUri>& sink_filter);
+
+	void removeListener(const CallableConn& listener);
+
+	/// @brief Gets the number of listeners currently registered.
+	[[nodiscard]] size_t listenerCount() const;
+
+private:
+	struct Filter {
+		datamodel::PackedUUri source;
+		std::optional<datamodel::PackedUUri> sink;
+	};
+
+	/// @brief Checks a message's source and sink against a listener's
+	///        filters. A listener without a sink filter matches any sink.
+	static bool matches(const Filter&, const datamodel::PackedUUri& source,
+	                    const std::optional<datamodel::PackedUUri>& sink);
+
+	void deliverAll();
+
+	mutable std::mutex listeners_mtx_;
+	std::map<CallableConn, Filter> listeners_;
+
+	std::mutex queue_mtx_;
+	std::condition_variable queue_cv_;
+	std::deque<v1::UMessage> queue_;
+	bool stop_{false};
+
+	std::thread receiver_;
+};
+
+/// @brief UTransport for a single uEntity attached to a LoopbackBus.
+class LoopbackTransport : public transport::UTransport {
+public:
+	LoopbackTransport(std::shared_ptr<LoopbackBus> bus, v1::UUri entity_uri)
+	    : UTransport(std::move(entity_uri)), bus_(std::move(bus)) {}
+
+protected:
+	[[nodiscard]] v1::UStatus sendImpl(const v1::UMessage& message) override;
+
+	[[nodiscard]] v1::UStatus registerListenerImpl(
+	    CallableConn&& listener, const v1::UUri& source_filter,
+	    std::optional<v1::UUri>&& sink_filter) override;
+
+	void cleanupListener(const CallableConn& listener) override;
+
+private:
+	std::shared_ptr<LoopbackBus> bus_;
+};
+
+}  // namespace uprotocol::benchmarks
+
+#endif  // UP_CPP_BENCHMARK_LOOPBACKTRANSPORT_H
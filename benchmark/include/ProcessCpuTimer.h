@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_BENCHMARK_PROCESSCPUTIMER_H
+#define UP_CPP_BENCHMARK_PROCESSCPUTIMER_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <ctime>
+
+namespace uprotocol::benchmarks {
+
+/// @brief Measures CPU time used by every thread in the process (including
+///        transport and library worker threads) while a benchmark runs.
+class ProcessCpuTimer {
+public:
+	ProcessCpuTimer() : start_(std::clock()) {}
+
+	/// @brief Adds a "cpu_us/msg" counter to a benchmark's results.
+	void report(benchmark::State& state, uint64_t messages) const {
+		constexpr double US_PER_S = 1e6;
+		const auto elapsed_us = static_cast<double>(std::clock() - start_) *
+		                        US_PER_S / static_cast<double>(CLOCKS_PER_SEC);
+		state.counters["cpu_us/msg"] =
+		    (messages == 0) ? 0.0 : elapsed_us / static_cast<double>(messages);
+	}
+
+private:
+	std::clock_t start_;
+};
+
+}  // namespace uprotocol::benchmarks
+
+#endif  // UP_CPP_BENCHMARK_PROCESSCPUTIMER_H
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <google/protobuf/any.pb.h>
+#include <up-cpp/utils/ProtoConverter.h>
+
+#include <chrono>
+#include <string>
+
+#include "AllocationsPerOp.h"
+
+namespace {
+
+using uprotocol::benchmarks::AllocationsPerOp;
+using uprotocol::core::usubscription::v3::SubscriptionRequest;
+using uprotocol::utils::ProtoConverter;
+
+const SubscriptionRequest& request() {
+	static const auto REQUEST = [] {
+		uprotocol::v1::UUri topic;
+		topic.set_authority_name("vehicle-ecu-1.example.com");
+		topic.set_ue_id(0x10010001);
+		topic.set_ue_version_major(1);
+		topic.set_resource_id(0x8001);
+		return ProtoConverter::BuildSubscriptionRequest(
+		    topic, ProtoConverter::BuildSubscribeAttributes(
+		               std::chrono::system_clock::now(), std::nullopt,
+		               std::chrono::milliseconds(100)));
+	}();
+	return REQUEST;
+}
+
+const uprotocol::v1::UMessage& wrappedRequest() {
+	static const auto MESSAGE = [] {
+		uprotocol::v1::UMessage message;
+		ProtoConverter::protoToPayload(request()).value().buildInto(message);
+		return message;
+	}();
+	return MESSAGE;
+}
+
+// The previous approach: serialize into an Any, then serialize the Any
+void packWithAny(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		google::protobuf::Any any;
+		any.PackFrom(request());
+		auto serialized = any.SerializeAsString();
+		benchmark::DoNotOptimize(serialized);
+	}
+}
+
+void protoToPayload(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto payload = ProtoConverter::protoToPayload(request());
+		benchmark::DoNotOptimize(payload);
+	}
+}
+
+// The previous approach: parse an Any, then unpack it
+void unpackWithAny(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		google::protobuf::Any any;
+		any.ParseFromString(wrappedRequest().payload());
+		SubscriptionRequest unpacked;
+		any.UnpackTo(&unpacked);
+		benchmark::DoNotOptimize(unpacked);
+	}
+}
+
+void extractFromProtobuf(benchmark::State& state) {
+	AllocationsPerOp allocations(state);
+	for (auto _ : state) {
+		auto unpacked =
+		    ProtoConverter::extractFromProtobuf<SubscriptionRequest>(
+		        wrappedRequest());
+		benchmark::DoNotOptimize(unpacked);
+	}
+}
+
+BENCHMARK(packWithAny);
+BENCHMARK(protoToPayload);
+BENCHMARK(unpackWithAny);
+BENCHMARK(extractFromProtobuf);
+
+}  // namespace
@@ -120,6 +120,17 @@ private:
 	/// @brief  Build UnsubscriptionRequest for unsubscription request
 	UnsubscribeRequest buildUnsubscriptionRequest();
 
+	/// @brief Checks if the topic in a payload received from uSubscription is
+	///        the topic this consumer subscribed to.
+	///
+	/// The topic is read directly from the serialized payload so that
+	/// payloads for other topics can be dropped without being parsed.
+	///
+	/// @param payload Serialized Update or SubscriptionResponse.
+	/// @param topic_field Field number of the topic in the payload's type.
+	[[nodiscard]] bool isSubscriptionTopic(std::string_view payload,
+	                                       uint32_t topic_field) const;
+
 	/// @brief Create a notification sink to receive subscription updates
 	v1::UStatus createNotificationSink();
 
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_COMMUNICATION_EXPIRYFILTER_H
+#define UP_CPP_COMMUNICATION_EXPIRYFILTER_H
+
+#include <uprotocol/v1/umessage.pb.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace uprotocol::communication {
+
+/// @brief Drops received messages whose TTL has elapsed before they reach a
+///        listener.
+///
+/// Subscriber, NotificationSink, and RpcServer each place one of these in
+/// front of their callback, so that a backlog of stale messages is shed
+/// without running callbacks (or, for RpcServer, computing responses that
+/// the caller has already given up on).
+///
+/// Messages without a TTL never expire, and are passed through without
+/// reading the clock. Other messages are checked against the process-wide
+/// CoarseClock, so expiry is detected with millisecond resolution. Messages
+/// with IDs that cannot be interpreted are also passed through, leaving them
+/// to be rejected by message validation.
+///
+/// Copies of a filter, and the listeners it has wrapped, share one count of
+/// dropped messages.
+struct ExpiryFilter {
+	ExpiryFilter() : dropped_(std::make_shared<std::atomic<uint64_t>>(0)) {}
+
+	/// @brief Wraps a listener so that expired messages are dropped and
+	///        counted instead of being passed to it.
+	///
+	/// Empty listeners are returned empty so that they are still rejected
+	/// when registered.
+	template <typename Listener>
+	[[nodiscard]] std::function<void(const v1::UMessage&)> wrap(
+	    Listener listener) const {
+		if constexpr (std::is_constructible_v<bool, const Listener&>) {
+			if (!listener) {
+				return {};
+			}
+		}
+		return [filter = *this,
+		        listener = std::move(listener)](const v1::UMessage& message) {
+			if (!filter.drop(message)) {
+				listener(message);
+			}
+		};
+	}
+
+	/// @brief Checks if a message has expired, counting it as dropped if so.
+	///
+	/// @returns True if the message should be dropped.
+	[[nodiscard]] bool drop(const v1::UMessage& message) const;
+
+	/// @brief Gets the number of messages dropped by this filter.
+	[[nodiscard]] uint64_t dropped() const {
+		return dropped_->load(std::memory_order_relaxed);
+	}
+
+	/// @brief Checks if a message's TTL has elapsed.
+	[[nodiscard]] static bool isExpired(const v1::UMessage& message);
+
+private:
+	std::shared_ptr<std::atomic<uint64_t>> dropped_;
+};
+
+}  // namespace uprotocol::communication
+
+#endif  // UP_CPP_COMMUNICATION_EXPIRYFILTER_H
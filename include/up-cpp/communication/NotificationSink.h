@@ -12,12 +12,14 @@
 #ifndef UP_CPP_COMMUNICATION_NOTIFICATIONSINK_H
 #define UP_CPP_COMMUNICATION_NOTIFICATIONSINK_H
 
+#include <up-cpp/communication/ExpiryFilter.h>
 #include <up-cpp/transport/UTransport.h>
 #include <up-cpp/utils/Expected.h>
 #include <uprotocol/v1/umessage.pb.h>
 #include <uprotocol/v1/uri.pb.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -82,6 +84,12 @@ struct NotificationSink {
 
 	~NotificationSink() = default;
 
+	/// @brief Gets the number of received messages that were dropped
+	///        because their TTL had elapsed before the callback could run.
+	[[nodiscard]] uint64_t expiredDropped() const {
+		return expiry_filter_.dropped();
+	}
+
 	/// @brief Constructs a notification listener connected to a given
 	///        transport.
 	///
@@ -96,6 +104,7 @@ struct NotificationSink {
 private:
 	std::shared_ptr<transport::UTransport> transport_;
 	ListenHandle listener_;
+	ExpiryFilter expiry_filter_;
 
 	// Allow the protected constructor for this class to be used in make_unique
 	// inside of subscribe()
@@ -13,6 +13,7 @@
 #define UP_CPP_COMMUNICATION_RPCCLIENT_H
 
 #include <spdlog/spdlog.h>
+#include <up-cpp/communication/RpcLatency.h>
 #include <up-cpp/datamodel/builder/Payload.h>
 #include <up-cpp/datamodel/builder/UMessage.h>
 #include <up-cpp/transport/UTransport.h>
@@ -198,6 +199,7 @@ struct RpcClient {
 	[[nodiscard]] InvokeHandle invokeMethodFromProto(const v1::UUri& method,
 	                                                 const R& request_message,
 	                                                 Callback&& callback) {
+		const auto started = latencyStart();
 		auto payload_or_status =
 		    uprotocol::utils::ProtoConverter::protoToPayload(request_message);
 
@@ -205,10 +207,11 @@ struct RpcClient {
 			return {};
 		}
 
-		datamodel::builder::Payload tmp_payload(payload_or_status.value());
+		datamodel::builder::Payload tmp_payload(
+		    std::move(payload_or_status).value());
 		auto handle = invokeMethod(
 		    builder_.withMethod(method).build(std::move(tmp_payload)),
-		    std::move(callback));
+		    std::move(callback), started);
 
 		return handle;
 	}
@@ -298,6 +301,20 @@ struct RpcClient {
 		return {std::move(future), std::move(handle)};
 	}
 
+	/// @brief Enables recording of per-stage timestamps for each request.
+	///
+	/// Every call started after this is passed to the recorder once its
+	/// callback returns. The same recorder can be shared by several clients.
+	///
+	/// @param recorder Recorder to use, or nullptr to stop recording.
+	///
+	/// @note Must not be called concurrently with invokeMethod().
+	void setLatencyRecorder(std::shared_ptr<RpcLatencyRecorder> recorder);
+
+	/// @brief Gets the recorder set with setLatencyRecorder(), if any.
+	[[nodiscard]] const std::shared_ptr<RpcLatencyRecorder>& latencyRecorder()
+	    const;
+
 	/// @brief Default move constructor (defined in RpcClient.cpp)
 	RpcClient(RpcClient&&) noexcept;
 
@@ -307,7 +324,20 @@ struct RpcClient {
 private:
 	/// @brief Internal implementation of invokeMethod that handles all the
 	///        shared logic for the public invokeMethod() methods.
-	InvokeHandle invokeMethod(v1::UMessage&&, Callback&&);
+	///
+	/// @param started Time at which the public invokeMethod() was called,
+	///                from latencyStart(). Only used when recording latency.
+	InvokeHandle invokeMethod(
+	    v1::UMessage&&, Callback&&,
+	    std::chrono::steady_clock::time_point started = {});
+
+	/// @brief Gets the current time if latency is being recorded.
+	[[nodiscard]] std::chrono::steady_clock::time_point latencyStart() const {
+		if (latency_recorder_) {
+			return std::chrono::steady_clock::now();
+		}
+		return {};
+	}
 
 	/// @brief Handle to a shared worker that monitors for and cancels expired
 	///        requests.
@@ -317,6 +347,7 @@ private:
 	std::chrono::milliseconds ttl_;
 	datamodel::builder::UMessageBuilder builder_;
 	std::unique_ptr<ExpireService> expire_service_;
+	std::shared_ptr<RpcLatencyRecorder> latency_recorder_;
 };
 
 }  // namespace uprotocol::communication
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_COMMUNICATION_RPCLATENCY_H
+#define UP_CPP_COMMUNICATION_RPCLATENCY_H
+
+#include <up-cpp/utils/Metrics.h>
+#include <uprotocol/v1/uri.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+#include <uprotocol/v1/uuid.pb.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace uprotocol::communication {
+
+/// @brief Timestamps for each stage of a single RPC made through an
+///        RpcClient.
+struct RpcCallTiming {
+	using TimePoint = std::chrono::steady_clock::time_point;
+
+	/// @brief Method that was invoked
+	v1::UUri method;
+	/// @brief ID of the request message
+	v1::UUID request_id;
+	/// @brief invokeMethod() was called, before the request was built
+	TimePoint build;
+	/// @brief The request was built and the response listener registered.
+	///        UTransport::send() is about to be called.
+	TimePoint send_start;
+	/// @brief UTransport::send() returned
+	TimePoint send_end;
+	/// @brief A response was received, or the request expired or failed
+	TimePoint response;
+	/// @brief The invokeMethod() callback returned
+	TimePoint callback_done;
+	/// @brief The response's commstatus, or the code of the error passed to
+	///        the callback in place of a response.
+	v1::UCode code{v1::UCode::OK};
+
+	[[nodiscard]] std::chrono::nanoseconds total() const {
+		return callback_done - build;
+	}
+};
+
+/// @brief Collects RpcCallTimings from one or more RpcClients.
+///
+/// Keeps aggregate per-stage histograms for each method, and a bounded ring
+/// of the most recent calls that took at least a configured threshold from
+/// start to finish. Both can be queried at any time while calls are being
+/// recorded.
+///
+/// The stages are:
+///   * BUILD - build to send_start (building the request and registering
+///     the response listener)
+///   * SEND - send_start to send_end
+///   * WAIT - send_end to response (time on the network and in the server)
+///   * CALLBACK - response to callback_done
+///   * TOTAL - build to callback_done
+struct RpcLatencyRecorder {
+	enum class Stage : uint8_t { BUILD, SEND, WAIT, CALLBACK, TOTAL };
+	static constexpr size_t STAGES = static_cast<size_t>(Stage::TOTAL) + 1;
+
+	static constexpr size_t DEFAULT_SLOW_CALL_CAPACITY = 64;
+
+	/// @brief Aggregate statistics for a single method.
+	struct MethodStats {
+		/// @brief Number of calls recorded
+		uint64_t calls{0};
+		/// @brief Number of calls that did not end with an OK response
+		uint64_t failed{0};
+		/// @brief Distribution of each stage's duration, indexed by Stage
+		std::array<utils::metrics::Histogram::Snapshot, STAGES> stages{};
+
+		[[nodiscard]] const utils::metrics::Histogram::Snapshot& operator[](
+		    Stage stage) const {
+			return stages[static_cast<size_t>(stage)];
+		}
+	};
+
+	/// @param slow_threshold Calls taking at least this long in total are
+	///                       kept in the slow call ring.
+	/// @param slow_call_capacity Number of slow calls kept. Once full, the
+	///                           oldest are overwritten.
+	///
+	/// @throws std::invalid_argument if slow_call_capacity is zero.
+	explicit RpcLatencyRecorder(
+	    std::chrono::nanoseconds slow_threshold,
+	    size_t slow_call_capacity = DEFAULT_SLOW_CALL_CAPACITY);
+
+	/// @brief Adds a completed call. Called by RpcClient.
+	void record(const RpcCallTiming& timing);
+
+	/// @brief Gets the most recent slow calls, oldest first.
+	[[nodiscard]] std::vector<RpcCallTiming> slowCalls() const;
+
+	/// @brief Gets the aggregate statistics for each method, keyed by the
+	///        method's serialized URI.
+	[[nodiscard]] std::map<std::string, MethodStats> methodStats() const;
+
+	[[nodiscard]] std::chrono::nanoseconds slowThreshold() const {
+		return slow_threshold_;
+	}
+
+	/// @brief Discards all recorded statistics and slow calls.
+	void reset();
+
+private:
+	struct MethodHistograms {
+		std::atomic<uint64_t> calls{0};
+		std::atomic<uint64_t> failed{0};
+		std::array<utils::metrics::Histogram, STAGES> stages;
+	};
+
+	MethodHistograms& histogramsFor(const v1::UUri& method);
+
+	const std::chrono::nanoseconds slow_threshold_;
+	const size_t slow_call_capacity_;
+
+	mutable std::mutex methods_mtx_;
+	std::map<std::string, std::unique_ptr<MethodHistograms>, std::less<>>
+	    methods_;
+
+	mutable std::mutex slow_calls_mtx_;
+	std::vector<RpcCallTiming> slow_calls_;
+	size_t next_slow_call_{0};
+};
+
+}  // namespace uprotocol::communication
+
+#endif  // UP_CPP_COMMUNICATION_RPCLATENCY_H
@@ -12,6 +12,7 @@
 #ifndef UP_CPP_COMMUNICATION_RPCSERVER_H
 #define UP_CPP_COMMUNICATION_RPCSERVER_H
 
+#include <up-cpp/communication/ExpiryFilter.h>
 #include <up-cpp/datamodel/builder/Payload.h>
 #include <up-cpp/datamodel/builder/UMessage.h>
 #include <up-cpp/datamodel/validator/UMessage.h>
@@ -77,6 +78,12 @@ struct RpcServer {
 
 	~RpcServer() = default;
 
+	/// @brief Gets the number of requests that were dropped because their
+	///        TTL had elapsed before the callback could run.
+	[[nodiscard]] uint64_t expiredDropped() const {
+		return expiry_filter_.dropped();
+	}
+
 protected:
 	/// @brief Constructs an RPC server connected to a given transport.
 	///
@@ -130,6 +137,9 @@ private:
 	/// @brief Format of the payload that will be expected in responses
 	std::optional<v1::UPayloadFormat> expected_payload_format_;
 
+	/// @brief Drops requests that expired before reaching the callback
+	ExpiryFilter expiry_filter_;
+
 	/// @brief Handle to the connected callback for the RPC method wrapper
 	transport::UTransport::ListenHandle callback_handle_;
 };
@@ -12,11 +12,13 @@
 #ifndef UP_CPP_COMMUNICATION_SUBSCRIBER_H
 #define UP_CPP_COMMUNICATION_SUBSCRIBER_H
 
+#include <up-cpp/communication/ExpiryFilter.h>
 #include <up-cpp/transport/UTransport.h>
 #include <up-cpp/utils/Expected.h>
 #include <uprotocol/v1/uri.pb.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
+#include <cstdint>
 #include <memory>
 
 namespace uprotocol::communication {
@@ -50,6 +52,12 @@ struct Subscriber {
 	    std::shared_ptr<transport::UTransport> transport, const v1::UUri& topic,
 	    ListenCallback&& callback);
 
+	/// @brief Gets the number of received messages that were dropped
+	///        because their TTL had elapsed before the callback could run.
+	[[nodiscard]] uint64_t expiredDropped() const {
+		return expiry_filter_.dropped();
+	}
+
 protected:
 	/// @brief Constructor
 	///
@@ -61,6 +69,7 @@ protected:
 private:
 	std::shared_ptr<transport::UTransport> transport_;
 	ListenHandle subscription_;
+	ExpiryFilter expiry_filter_;
 	// Allow the protected constructor for this class to be used in make_unique
 	// inside of subscribe()
 	friend std::unique_ptr<Subscriber> std::make_unique<
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_COMMUNICATION_TYPEDPUBLISHER_H
+#define UP_CPP_COMMUNICATION_TYPEDPUBLISHER_H
+
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/serializer/Protobuf.h>
+#include <up-cpp/transport/UTransport.h>
+#include <uprotocol/v1/uattributes.pb.h>
+#include <uprotocol/v1/uri.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace uprotocol::communication {
+
+/// @brief Publisher for values of a single type T, with the payload format
+///        and serializer fixed at compile time.
+///
+/// Unlike Publisher, values are serialized directly into the payload field
+/// of the outgoing UMessage. No intermediate Payload is created.
+///
+/// @tparam T Type of the values to publish.
+/// @tparam Serializer Payload serializer for T. See
+///         datamodel::serializer::protobuf for the requirements. Defaults to
+///         serializing T as a protobuf message.
+template <typename T,
+          typename Serializer = datamodel::serializer::protobuf::AsProtobuf<T>>
+struct TypedPublisher {
+	/// @brief Payload format of all messages published.
+	static constexpr v1::UPayloadFormat FORMAT = Serializer::FORMAT;
+
+	/// @brief Constructs a publisher connected to a given transport.
+	///
+	/// @param transport Transport to publish messages on.
+	/// @param topic URI representing the topic messages will be published to.
+	/// @param priority All published messages will be assigned this priority.
+	/// @param ttl How long published messages will be valid from the time
+	///            publish() is called.
+	///
+	/// @throws transport::NullTransport if the transport is null.
+	/// @throws datamodel::validator::uri::InvalidUUri if the topic is not a
+	///         valid publish topic.
+	TypedPublisher(std::shared_ptr<transport::UTransport> transport,
+	               v1::UUri&& topic, std::optional<v1::UPriority> priority = {},
+	               std::optional<std::chrono::milliseconds> ttl = {})
+	    : transport_(std::move(transport)),
+	      publish_builder_(
+	          datamodel::builder::UMessageBuilder::publish(std::move(topic))) {
+		if (!transport_) {
+			throw transport::NullTransport("transport cannot be null");
+		}
+		publish_builder_.withPriority(
+		    priority.value_or(v1::UPriority::UPRIORITY_CS1));
+		if (ttl) {
+			publish_builder_.withTtl(*ttl);
+		}
+	}
+
+	/// @brief Publish a value to this Publisher's topic.
+	///
+	/// @returns * The status from the transport's send().
+	///          * INTERNAL if the value could not be serialized.
+	[[nodiscard]] v1::UStatus publish(const T& value) const {
+		auto message = publish_builder_.build();
+		message.mutable_attributes()->set_payload_format(FORMAT);
+		if (!Serializer::serializeInto(value, *message.mutable_payload())) {
+			v1::UStatus status;
+			status.set_code(v1::UCode::INTERNAL);
+			status.set_message("Failed to serialize published value");
+			return status;
+		}
+		return transport_->send(message);
+	}
+
+private:
+	std::shared_ptr<transport::UTransport> transport_;
+	datamodel::builder::UMessageBuilder publish_builder_;
+};
+
+}  // namespace uprotocol::communication
+
+#endif  // UP_CPP_COMMUNICATION_TYPEDPUBLISHER_H
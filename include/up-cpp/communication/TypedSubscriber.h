@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_COMMUNICATION_TYPEDSUBSCRIBER_H
+#define UP_CPP_COMMUNICATION_TYPEDSUBSCRIBER_H
+
+#include <up-cpp/communication/Subscriber.h>
+#include <up-cpp/datamodel/serializer/Protobuf.h>
+#include <up-cpp/transport/UTransport.h>
+#include <up-cpp/utils/Expected.h>
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/uri.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace uprotocol::communication {
+
+/// @brief Subscriber for values of a single type T, with the payload format
+///        and serializer fixed at compile time.
+///
+/// Received payloads are deserialized into a thread_local T that is reused
+/// for every message handled on that thread, so no T is allocated per
+/// message. The value passed to the callback is only valid for the duration
+/// of the callback. Nested deliveries on the same thread (e.g. a callback
+/// that causes a local transport to deliver another message synchronously)
+/// are parsed into a temporary T instead.
+///
+/// @tparam T Type of the values received.
+/// @tparam Serializer Payload serializer for T. See
+///         datamodel::serializer::protobuf for the requirements. Defaults to
+///         deserializing T as a protobuf message.
+template <typename T,
+          typename Serializer = datamodel::serializer::protobuf::AsProtobuf<T>>
+struct TypedSubscriber {
+	using TypedSubscriberOrStatus =
+	    utils::Expected<std::unique_ptr<TypedSubscriber>, v1::UStatus>;
+	/// @brief Called with each received value and the attributes of the
+	///        message that carried it.
+	using ValueCallback =
+	    std::function<void(const T&, const v1::UAttributes&)>;
+	/// @brief Called with messages that were received on the topic but could
+	///        not be deserialized (wrong payload format or bad payload).
+	using ErrorCallback = std::function<void(const v1::UMessage&)>;
+
+	/// @brief Payload format of all messages accepted.
+	static constexpr v1::UPayloadFormat FORMAT = Serializer::FORMAT;
+
+	/// @brief Subscribes to a topic.
+	///
+	/// The subscription will remain active so long as the TypedSubscriber is
+	/// held.
+	///
+	/// @param transport Transport to register with.
+	/// @param topic UUri of the topic to listen on.
+	/// @param callback Function to be called with each value published to the
+	///                 subscribed topic.
+	/// @param on_error (Optional) Function to be called with messages that
+	///                 could not be deserialized. Such messages are dropped
+	///                 if not set.
+	///
+	/// @returns * A unique_ptr to a TypedSubscriber if the callback was
+	///            successfully registered.
+	///          * A UStatus with the appropriate failure code otherwise.
+	[[nodiscard]] static TypedSubscriberOrStatus subscribe(
+	    std::shared_ptr<transport::UTransport> transport, const v1::UUri& topic,
+	    ValueCallback&& callback, ErrorCallback&& on_error = {}) {
+		auto subscriber = Subscriber::subscribe(
+		    std::move(transport), topic,
+		    [callback = std::move(callback),
+		     on_error = std::move(on_error)](const v1::UMessage& message) {
+			    deliver(message, callback, on_error);
+		    });
+		if (!subscriber) {
+			return TypedSubscriberOrStatus(
+			    utils::Unexpected<v1::UStatus>(subscriber.error()));
+		}
+		return TypedSubscriberOrStatus(std::unique_ptr<TypedSubscriber>(
+		    new TypedSubscriber(std::move(subscriber).value())));
+	}
+
+private:
+	explicit TypedSubscriber(std::unique_ptr<Subscriber>&& subscriber)
+	    : subscriber_(std::move(subscriber)) {}
+
+	/// @brief Deserializes a received message and passes the value on.
+	static void deliver(const v1::UMessage& message,
+	                    const ValueCallback& callback,
+	                    const ErrorCallback& on_error) {
+		thread_local T reused_value;
+		thread_local bool reused_value_busy = false;
+
+		if (reused_value_busy) {
+			T value;
+			deliverWith(value, message, callback, on_error);
+			return;
+		}
+
+		reused_value_busy = true;
+		try {
+			deliverWith(reused_value, message, callback, on_error);
+		} catch (...) {
+			reused_value_busy = false;
+			throw;
+		}
+		reused_value_busy = false;
+	}
+
+	static void deliverWith(T& value, const v1::UMessage& message,
+	                        const ValueCallback& callback,
+	                        const ErrorCallback& on_error) {
+		if ((message.attributes().payload_format() != FORMAT) ||
+		    !Serializer::deserializeInto(message.payload(), value)) {
+			if (on_error) {
+				on_error(message);
+			}
+			return;
+		}
+		callback(value, message.attributes());
+	}
+
+	std::unique_ptr<Subscriber> subscriber_;
+};
+
+}  // namespace uprotocol::communication
+
+#endif  // UP_CPP_COMMUNICATION_TYPEDSUBSCRIBER_H
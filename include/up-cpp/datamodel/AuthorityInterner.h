@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_DATAMODEL_AUTHORITYINTERNER_H
+#define UP_CPP_DATAMODEL_AUTHORITYINTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace uprotocol::datamodel {
+
+/// @brief Process-wide table mapping UUri authority names to small, stable
+///        integer IDs.
+///
+/// A deployment typically has a few dozen distinct authorities but handles
+/// millions of messages. Interning each name once allows URIs to be compared
+/// and hashed by ID (see PackedUUri) rather than by string.
+///
+/// All interfaces are thread-safe. Looking up a name by ID never blocks.
+///
+/// @remarks Interned names are never released. Only names from a bounded set
+///          (e.g. this entity and its configured peers) should be interned.
+///          Use find() for names that come from untrusted input.
+struct AuthorityInterner {
+	/// @brief Interned ID of an authority name.
+	using Id = uint32_t;
+
+	/// @brief ID of the empty (local) authority name. Always interned.
+	static constexpr Id LOCAL = 0;
+	/// @brief ID of the wildcard ("*") authority name. Always interned.
+	static constexpr Id WILDCARD = 1;
+
+	/// @brief Maximum number of distinct names that can be interned.
+	static constexpr size_t CAPACITY = 65536;
+
+	/// @brief Gets the ID for a name, interning the name if it has not been
+	///        seen before.
+	///
+	/// @throws std::length_error if the name is new and CAPACITY names have
+	///         already been interned.
+	[[nodiscard]] static Id intern(std::string_view name);
+
+	/// @brief Gets the ID for a name only if it has already been interned.
+	[[nodiscard]] static std::optional<Id> find(std::string_view name);
+
+	/// @brief Gets the interned name for an ID.
+	///
+	/// @remarks The returned view remains valid for the life of the process.
+	///
+	/// @throws std::out_of_range if the ID has not been issued.
+	[[nodiscard]] static std::string_view name(Id);
+
+	/// @brief Gets the number of names interned so far, including the two
+	///        that are always present.
+	[[nodiscard]] static size_t size() noexcept;
+};
+
+}  // namespace uprotocol::datamodel
+
+#endif  // UP_CPP_DATAMODEL_AUTHORITYINTERNER_H
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_DATAMODEL_PACKEDUURI_H
+#define UP_CPP_DATAMODEL_PACKEDUURI_H
+
+#include <up-cpp/datamodel/AuthorityInterner.h>
+#include <uprotocol/v1/uri.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace uprotocol::datamodel {
+
+/// @brief Compact, trivially copyable key representing a v1::UUri.
+///
+/// The uE ID, major version, and resource ID are packed into a single 64-bit
+/// field. The authority name is replaced by its 32-bit AuthorityInterner ID,
+/// so two PackedUUri objects compare equal exactly when the v1::UUri objects
+/// they were created from have equal fields.
+///
+/// This makes PackedUUri suitable as a key for routing and deduplication
+/// tables where comparing or hashing protobuf objects would be expensive.
+///
+/// @remarks Constructing a PackedUUri from a v1::UUri interns its authority
+///          name. Use lookup() for URIs that come from untrusted input.
+class PackedUUri {
+public:
+	/// @brief Interned ID of an authority name.
+	using AuthorityId = AuthorityInterner::Id;
+
+	/// @brief ID of the empty (local) authority name.
+	static constexpr AuthorityId LOCAL_AUTHORITY = AuthorityInterner::LOCAL;
+	/// @brief ID of the wildcard ("*") authority name.
+	static constexpr AuthorityId WILDCARD_AUTHORITY =
+	    AuthorityInterner::WILDCARD;
+
+	static constexpr uint32_t WILDCARD_SERVICE_ID = 0xFFFF;
+	static constexpr uint32_t WILDCARD_INSTANCE_ID = 0xFFFF0000;
+	static constexpr uint8_t WILDCARD_VERSION = 0xFF;
+	static constexpr uint16_t WILDCARD_RESOURCE_ID = 0xFFFF;
+
+	/// @brief Constructs a PackedUUri equivalent to an empty v1::UUri.
+	constexpr PackedUUri() noexcept = default;
+
+	/// @brief Constructs a PackedUUri directly from its fields.
+	constexpr PackedUUri(AuthorityId authority, uint32_t ue_id,
+	                     uint8_t ue_version_major,
+	                     uint16_t resource_id) noexcept
+	    : fields_((static_cast<uint64_t>(ue_id) << UE_ID_SHIFT) |
+	              (static_cast<uint64_t>(ue_version_major) << VERSION_SHIFT) |
+	              resource_id),
+	      authority_(authority) {}
+
+	/// @brief Constructs a PackedUUri from a v1::UUri, interning its
+	///        authority name if it has not been seen before.
+	///
+	/// @throws InvalidUUri if the major version does not fit in a uint8_t or
+	///         the resource ID does not fit in a uint16_t.
+	explicit PackedUUri(const v1::UUri&);
+
+	/// @brief Gets the PackedUUri for a v1::UUri without interning anything.
+	///
+	/// @returns The packed form of the UUri, or std::nullopt if its authority
+	///          name has never been interned or its major version or resource
+	///          ID is out of range. In the former case, the UUri cannot be
+	///          equal to any PackedUUri that already exists.
+	[[nodiscard]] static std::optional<PackedUUri> lookup(const v1::UUri&);
+
+	/// @brief Reconstructs the v1::UUri this key represents.
+	[[nodiscard]] v1::UUri toUUri() const;
+
+	/// @brief Gets the authority name for this key.
+	///
+	/// @remarks The returned view remains valid for the life of the process.
+	[[nodiscard]] std::string_view authorityName() const {
+		return AuthorityInterner::name(authority_);
+	}
+
+	[[nodiscard]] constexpr AuthorityId authorityId() const noexcept {
+		return authority_;
+	}
+
+	[[nodiscard]] constexpr uint32_t ueId() const noexcept {
+		return static_cast<uint32_t>(fields_ >> UE_ID_SHIFT);
+	}
+
+	[[nodiscard]] constexpr uint8_t ueVersionMajor() const noexcept {
+		return static_cast<uint8_t>(fields_ >> VERSION_SHIFT);
+	}
+
+	[[nodiscard]] constexpr uint16_t resourceId() const noexcept {
+		return static_cast<uint16_t>(fields_);
+	}
+
+	[[nodiscard]] constexpr bool isLocal() const noexcept {
+		return authority_ == LOCAL_AUTHORITY;
+	}
+
+	/// @brief Checks if a URI matches this URI when used as a filter.
+	///
+	/// Each field of this URI that holds a wildcard value matches any value
+	/// of that field in the candidate. All other fields must be equal.
+	///
+	/// @see validator::uri::has_wildcard_authority() and related checks for
+	///      the wildcard value of each field.
+	[[nodiscard]] constexpr bool matches(
+	    const PackedUUri& candidate) const noexcept {
+		const bool authority_ok = (authority_ == WILDCARD_AUTHORITY) ||
+		                          (authority_ == candidate.authority_);
+		return authority_ok &&
+		       matchesField(ueId() & WILDCARD_SERVICE_ID,
+		                    candidate.ueId() & WILDCARD_SERVICE_ID,
+		                    WILDCARD_SERVICE_ID) &&
+		       matchesField(ueId() & WILDCARD_INSTANCE_ID,
+		                    candidate.ueId() & WILDCARD_INSTANCE_ID,
+		                    WILDCARD_INSTANCE_ID) &&
+		       matchesField(ueVersionMajor(), candidate.ueVersionMajor(),
+		                    WILDCARD_VERSION) &&
+		       matchesField(resourceId(), candidate.resourceId(),
+		                    WILDCARD_RESOURCE_ID);
+	}
+
+	/// @brief Gets a well-mixed hash of this key.
+	[[nodiscard]] constexpr size_t hash() const noexcept {
+		// The fields are mixed before the authority is added so that the
+		// authority does not simply cancel out bits of the uE ID
+		return static_cast<size_t>(mix(mix(fields_) + authority_));
+	}
+
+	friend constexpr bool operator==(const PackedUUri& lhs,
+	                                 const PackedUUri& rhs) noexcept {
+		return (lhs.authority_ == rhs.authority_) &&
+		       (lhs.fields_ == rhs.fields_);
+	}
+
+	friend constexpr bool operator!=(const PackedUUri& lhs,
+	                                 const PackedUUri& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+	/// @note Keys are ordered by authority ID, then uE ID, then major
+	///       version, then resource ID. Authority IDs are assigned in the
+	///       order names are first interned, so this is not alphabetical.
+	friend constexpr bool operator<(const PackedUUri& lhs,
+	                                const PackedUUri& rhs) noexcept {
+		return (lhs.authority_ != rhs.authority_)
+		           ? (lhs.authority_ < rhs.authority_)
+		           : (lhs.fields_ < rhs.fields_);
+	}
+
+	friend constexpr bool operator>(const PackedUUri& lhs,
+	                                const PackedUUri& rhs) noexcept {
+		return rhs < lhs;
+	}
+
+	friend constexpr bool operator<=(const PackedUUri& lhs,
+	                                 const PackedUUri& rhs) noexcept {
+		return !(rhs < lhs);
+	}
+
+	friend constexpr bool operator>=(const PackedUUri& lhs,
+	                                 const PackedUUri& rhs) noexcept {
+		return !(lhs < rhs);
+	}
+
+private:
+	static constexpr int UE_ID_SHIFT = 24;
+	static constexpr int VERSION_SHIFT = 16;
+
+	/// @brief Finalizer from splitmix64
+	static constexpr uint64_t mix(uint64_t value) noexcept {
+		constexpr uint64_t MIX_A = 0xBF58476D1CE4E5B9;
+		constexpr uint64_t MIX_B = 0x94D049BB133111EB;
+		constexpr int SHIFT_A = 30;
+		constexpr int SHIFT_B = 27;
+		constexpr int SHIFT_C = 31;
+		value = (value ^ (value >> SHIFT_A)) * MIX_A;
+		value = (value ^ (value >> SHIFT_B)) * MIX_B;
+		return value ^ (value >> SHIFT_C);
+	}
+
+	template <typename T>
+	static constexpr bool matchesField(T pattern, T candidate,
+	                                   T wildcard) noexcept {
+		return (pattern == wildcard) || (pattern == candidate);
+	}
+
+	/// @brief uE ID in bits [24, 56), major version in bits [16, 24), and
+	///        resource ID in bits [0, 16).
+	uint64_t fields_{0};
+	AuthorityId authority_{LOCAL_AUTHORITY};
+};
+
+static_assert(std::is_trivially_copyable_v<PackedUUri>);
+static_assert(sizeof(PackedUUri) <= 2 * sizeof(uint64_t));
+
+}  // namespace uprotocol::datamodel
+
+template <>
+struct std::hash<uprotocol::datamodel::PackedUUri> {
+	size_t operator()(
+	    const uprotocol::datamodel::PackedUUri& uri) const noexcept {
+		return uri.hash();
+	}
+};
+
+#endif  // UP_CPP_DATAMODEL_PACKEDUURI_H
@@ -13,11 +13,20 @@
 #define UP_CPP_DATAMODEL_BUILDER_PAYLOAD_H
 
 #include <google/protobuf/any.pb.h>
+#include <up-cpp/utils/SharedMemory.h>
 #include <uprotocol/v1/uattributes.pb.h>
+#include <uprotocol/v1/umessage.pb.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace uprotocol::datamodel::builder {
@@ -25,6 +34,22 @@ namespace uprotocol::datamodel::builder {
 /// @brief Interface for preparing payloads for inclusion in a UMessage
 ///
 /// Allows for implicit conversions at interfaces that require a payload.
+///
+/// Payload is move-only. Buffers passed by rvalue (std::string,
+/// std::vector<uint8_t>) or as a SharedBuffer are adopted without copying
+/// the bytes. Bytes passed by const reference are copied once: into inline
+/// storage if they fit in INLINE_CAPACITY, otherwise into a std::string.
+///
+/// A payload can also be assembled from several shared Fragments (e.g. a
+/// header and a number of data chunks). The fragments are only joined when
+/// contiguous bytes are needed, and are kept alongside the joined copy so
+/// that views from fragments() stay valid. Transports that can write
+/// scattered buffers can get them directly from fragments().
+///
+/// @remarks UMessage stores its payload in a std::string. Only payloads
+///          held in a std::string can be moved into a UMessage without a
+///          copy; all others are copied once, directly into the UMessage,
+///          when the message is built.
 struct Payload {
 	/// @brief Protobuf uses std::string to represent the Bytes type from
 	///        messages.
@@ -36,6 +61,17 @@ struct Payload {
 	/// @brief The two types of data that can be stored in a Serialized payload.
 	enum PayloadType { Data, Format };
 
+	/// @brief Immutable bytes that can be shared between payloads (and other
+	///        owners) by reference count rather than by copying.
+	using SharedBuffer = std::shared_ptr<const PbBytes>;
+
+	/// @brief Ordered buffers that together make up a payload.
+	using Fragments = std::vector<SharedBuffer>;
+
+	/// @brief Payloads of up to this many bytes that must be copied are
+	///        stored within the Payload object instead of on the heap.
+	static constexpr size_t INLINE_CAPACITY = 64;
+
 	/// @brief Constructs a Payload builder with the payload populated by
 	///        a serialized protobuf.
 	///
@@ -47,12 +83,11 @@ struct Payload {
 	/// @remarks The UPayloadFormat will automatically be set to
 	///          UPAYLOAD_FORMAT_PROTOBUF
 	template <typename ProtobufT>
-	explicit Payload(const ProtobufT& message) {
+	explicit Payload(const ProtobufT& message)
+	    : format_(v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF) {
 		std::string serialized;
 		message.SerializeToString(&serialized);
-		payload_ =
-		    std::make_tuple(std::move(serialized),
-		                    v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF);
+		data_ = std::move(serialized);
 	}
 
 	/// @brief Creates a Payload builder with the payload populated by the
@@ -79,14 +114,20 @@ struct Payload {
 	///          `Serializer::serialize(data)` will be called - the s instance
 	///          will compile out.
 	/// @param data Data to be serialized and stored.
-	template <typename Serializer, typename ValueT>
+	///
+	/// @remarks Only participates in overload resolution when
+	///          `Serializer::serialize(data)` is well-formed.
+	template <typename Serializer, typename ValueT,
+	          typename = decltype(Serializer::serialize(
+	              std::declval<const ValueT&>()))>
 	Payload(Serializer s [[maybe_unused]], const ValueT& data) {
 		auto serialized_data = Serializer::serialize(data);
 		if (!UPayloadFormat_IsValid(
 		        std::get<PayloadType::Format>(serialized_data))) {
 			throw std::out_of_range("Invalid Serializer payload format");
 		}
-		payload_ = std::move(serialized_data);
+		data_ = std::move(std::get<PayloadType::Data>(serialized_data));
+		format_ = std::get<PayloadType::Format>(serialized_data);
 	}
 
 	/// @brief Creates a Payload builder with a provided pre-serialized data.
@@ -97,6 +138,59 @@ struct Payload {
 	/// @throws std::out_of_range If format is not valid for v1::UPayloadFormat
 	Payload(const std::vector<uint8_t>& value_bytes, v1::UPayloadFormat format);
 
+	/// @brief Creates a Payload builder with a provided pre-serialized data.
+	///
+	/// The byte array will be adopted by the Payload object without copying.
+	///
+	/// @param value_bytes A byte array containing the serialized payload.
+	/// @param format The data format of the payload in value_bytes.
+	///
+	/// @throws std::out_of_range If format is not valid for v1::UPayloadFormat
+	Payload(std::vector<uint8_t>&& value_bytes, v1::UPayloadFormat format);
+
+	/// @brief Creates a Payload builder referencing a shared, immutable
+	///        buffer of pre-serialized data.
+	///
+	/// The buffer is not copied until the payload is built into a UMessage.
+	///
+	/// @param buffer A shared buffer containing the serialized payload.
+	/// @param format The data format of the payload in buffer.
+	///
+	/// @throws std::out_of_range If format is not valid for v1::UPayloadFormat
+	/// @throws std::invalid_argument If buffer is null
+	Payload(SharedBuffer buffer, v1::UPayloadFormat format);
+
+	/// @brief Creates a Payload builder from a sequence of shared buffers
+	///        that make up the pre-serialized data when joined in order.
+	///
+	/// The buffers are not copied or joined until contiguous bytes are
+	/// needed (see data()) or the payload is built into a UMessage.
+	///
+	/// @param fragments The shared buffers containing the serialized payload.
+	/// @param format The data format of the payload in fragments.
+	///
+	/// @throws std::out_of_range If format is not valid for v1::UPayloadFormat
+	/// @throws std::invalid_argument If any of the buffers is null
+	Payload(Fragments fragments, v1::UPayloadFormat format);
+
+	/// @brief Creates a UPAYLOAD_FORMAT_SHM Payload builder referencing data
+	///        already written to a shared memory segment.
+	///
+	/// Only a small ShmDescriptor is carried in the message. Receivers on
+	/// the same host read the data with utils::ShmView.
+	///
+	/// @param segment The segment the data has been written to.
+	/// @param length Number of bytes of data.
+	/// @param offset Start of the data within the segment's data region.
+	///
+	/// @throws std::out_of_range If the range extends past the segment's
+	///                           capacity.
+	///
+	/// @remarks The segment handle must be kept until receivers have opened
+	///          the data. See utils::ShmSegment.
+	Payload(const utils::ShmSegment& segment, size_t length,
+	        size_t offset = 0);
+
 	/// @brief Creates a Payload builder with a provided pre-serialized data.
 	///
 	/// @param value A string containing the serialized payload.
@@ -139,13 +233,27 @@ struct Payload {
 	explicit Payload(const google::protobuf::Any&);
 
 	/// @brief Move constructor.
+	///
+	/// @post The moved-from Payload is treated as if buildMove() had been
+	///       called on it.
 	Payload(Payload&&) noexcept;
 
-	/// @brief Copy constructor.
-	Payload(const Payload&);
-
 	Payload& operator=(Payload&&) noexcept;
-	Payload& operator=(const Payload&);
+
+	/// @brief Payloads are move-only. Use clone() where a copy is needed.
+	Payload(const Payload&) = delete;
+	Payload& operator=(const Payload&) = delete;
+
+	~Payload();
+
+	/// @brief Creates a new Payload holding the same data and format.
+	///
+	/// @remarks Payloads holding a SharedBuffer share it with the clone.
+	///          Otherwise, the bytes are copied.
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] Payload clone() const;
 
 	/// @brief This exception indicates build() or move() has been called after
 	///        move() has already been called.
@@ -160,26 +268,114 @@ struct Payload {
 		PayloadMoved& operator=(const PayloadMoved&);
 	};
 
-	/// @brief Get a reference to the internal data from this builder.
+	/// @brief Get a view of the serialized payload data.
+	///
+	/// @remarks The view is valid until this Payload is moved or destroyed.
+	///
+	/// @note If the Payload was created from Fragments, they are joined into
+	///       a cached copy on the first call. The fragments are kept, and
+	///       concurrent calls are safe.
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] std::string_view data() const;
+
+	/// @brief Get views of the serialized payload data as one or more
+	///        buffers to be written in order (e.g. with writev()).
+	///
+	/// Payloads that were not created from Fragments produce a single view
+	/// of data().
+	///
+	/// @remarks The views are valid until this Payload is moved or destroyed.
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] std::vector<std::string_view> fragments() const;
+
+	/// @brief Get the total size of the serialized payload data in bytes.
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] size_t size() const;
+
+	/// @brief Get the format of the serialized payload data.
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] v1::UPayloadFormat format() const;
+
+	/// @brief Get a copy of the internal data from this builder.
 	///
 	/// @throws PayloadMoved if called after buildMove() has already been
 	/// called.
-	[[nodiscard]] const Serialized& buildCopy() const;
+	[[nodiscard]] Serialized buildCopy() const;
 
 	/// @brief Get an xvalue of the internal data that can be moved into a
 	///        UMessage.
 	///
 	/// @post This Payload builder will no longer be valid. Calling
-	/// `buildCopy()`
-	///       or `movePayload()` after this will result in an exception.
+	///       `buildCopy()` or `buildMove()` after this will result in an
+	///       exception.
 	///
 	/// @throws PayloadMoved if called after buildMove() has already been
 	/// called.
 	[[nodiscard]] Serialized buildMove() &&;
 
+	/// @brief Sets the payload and payload format of a UMessage from this
+	///        builder with no intermediate copies.
+	///
+	/// Payloads held in a std::string are moved into the message. All others
+	/// are copied directly into the message's payload field.
+	///
+	/// @post This Payload builder will no longer be valid, as with
+	///       buildMove().
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	void buildInto(v1::UMessage&) &&;
+
 private:
-	Serialized payload_;
-	bool moved_{false};
+	struct InlineBytes {
+		std::array<char, INLINE_CAPACITY> bytes;
+		uint8_t size;
+	};
+
+	/// @brief Fragments along with their joined bytes, which are only
+	///        produced once data() is called.
+	struct FragmentedBytes {
+		explicit FragmentedBytes(Fragments fragments)
+		    : parts(std::move(fragments)) {}
+
+		/// @brief Joins the parts on the first call. Safe to call
+		///        concurrently.
+		const PbBytes& joined();
+
+		const Fragments parts;
+
+	private:
+		std::once_flag join_once_;
+		PbBytes joined_;
+	};
+
+	/// @brief Holds the bytes in whichever form they were provided. The
+	///        monostate alternative marks a Payload that has been moved.
+	using Storage = std::variant<std::monostate, PbBytes, InlineBytes,
+	                             std::vector<uint8_t>, SharedBuffer,
+	                             std::unique_ptr<FragmentedBytes>>;
+
+	Payload() = default;
+
+	/// @brief Stores bytes that must be copied, inline if they fit.
+	static Storage copyOf(std::string_view bytes);
+
+	/// @brief Copies the bytes of all fragments into a single string.
+	static PbBytes join(const Fragments&);
+
+	/// @throws PayloadMoved if the Payload has been moved.
+	void checkNotMoved() const;
+
+	Storage data_;
+	v1::UPayloadFormat format_{v1::UPayloadFormat::UPAYLOAD_FORMAT_UNSPECIFIED};
 };
 
 }  // namespace uprotocol::datamodel::builder
@@ -213,6 +213,18 @@ struct UMessageBuilder {
 	/// @returns A reference to this UMessageBuilder
 	UMessageBuilder& withPayloadFormat(v1::UPayloadFormat);
 
+	/// @brief Takes the timestamps in built message IDs from the cached time
+	///        of a CoarseClock instead of reading the system clock.
+	///
+	/// @post All future generated message IDs will be timestamped from the
+	///       clock.
+	///
+	/// @param The clock to read. Must outlive this UMessageBuilder and any
+	///        copies of it.
+	///
+	/// @returns A reference to this UMessageBuilder
+	UMessageBuilder& withClock(const utils::CoarseClock&);
+
 	/// @brief This exception indicates that build was called and the payload
 	///        format did not match the one set with withPayloadFormat().
 	struct UnexpectedFormat : public std::invalid_argument {
@@ -272,6 +284,23 @@ struct UMessageBuilder {
 	/// @return A built message with the provided payload data embedded.
 	[[nodiscard]] v1::UMessage build(const v1::UUri&, builder::Payload&&) const;
 
+	/// @brief Creates a UMessage based on the builder's current state, with
+	///        attributes for the provided payload but without its data.
+	///
+	/// For use with UTransport::send(v1::UMessage&&, Payload&&), which lets
+	/// the transport write the payload's fragments directly.
+	///
+	/// @param A Payload builder for the payload that will be sent with the
+	///        message. It is not modified.
+	///
+	/// @throws UnexpectedFormat if withPayloadFormat() has been previously
+	///         called and the format in the payload builder does not match.
+	///
+	/// @return A built message with the payload format set and no payload
+	///         populated.
+	[[nodiscard]] v1::UMessage buildAttributesFor(
+	    const builder::Payload&) const;
+
 	/// @brief Access the attributes of the message being built.
 	/// @return A reference to the attributes of the message being built.
 	[[deprecated(
@@ -12,6 +12,7 @@
 #ifndef UP_CPP_DATAMODEL_BUILDER_UUID_H
 #define UP_CPP_DATAMODEL_BUILDER_UUID_H
 
+#include <up-cpp/utils/CoarseClock.h>
 #include <uprotocol/v1/uuid.pb.h>
 
 #include <chrono>
@@ -77,6 +78,18 @@ struct UuidBuilder {
 	/// @returns A reference to thus UuidBuilder.
 	UuidBuilder& withRandomSource(std::function<uint64_t()>&&);
 
+	/// @brief Takes UUID timestamps from the cached time of a CoarseClock
+	///        instead of calling `std::chrono::system_clock::now()`.
+	///
+	/// Unlike withTimeSource(), this can be used in production mode. A time
+	/// source set with withTimeSource() takes precedence.
+	///
+	/// @param The clock to read. Must outlive this UuidBuilder and any
+	///        copies of it.
+	///
+	/// @returns A reference to thus UuidBuilder.
+	UuidBuilder& withClock(const utils::CoarseClock&);
+
 	/// @brief Creates a uProtocol UUID based on the builder's current state.
 	///
 	/// @remarks As part of the UUID v7/v8 spec, there is a shared state for
@@ -90,6 +103,7 @@ private:
 	const bool testing_{false};
 	std::function<std::chrono::system_clock::time_point()> time_source_;
 	std::function<uint64_t()> random_source_;
+	const utils::CoarseClock* clock_{nullptr};
 };
 
 }  // namespace uprotocol::datamodel::builder
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_DATAMODEL_SERIALIZER_PROTOBUF_H
+#define UP_CPP_DATAMODEL_SERIALIZER_PROTOBUF_H
+
+#include <up-cpp/utils/ProtoConverter.h>
+#include <uprotocol/v1/uattributes.pb.h>
+
+#include <string>
+#include <string_view>
+
+/// @brief Payload serializers for protobuf messages, for use with typed
+///        communication interfaces such as TypedPublisher and
+///        TypedSubscriber.
+///
+/// A payload serializer for a type T provides:
+///
+///     // Payload format of everything this serializer produces
+///     static constexpr v1::UPayloadFormat FORMAT;
+///     // Replaces the contents of `out` with the serialized value
+///     static bool serializeInto(const T& value, std::string& out);
+///     // Replaces the contents of `value` with the deserialized payload
+///     static bool deserializeInto(std::string_view payload, T& value);
+///
+/// Both functions return false on failure. Serializing into an existing
+/// string (e.g. a UMessage's payload field) and deserializing into an
+/// existing object allow buffers to be reused between messages.
+namespace uprotocol::datamodel::serializer::protobuf {
+
+/// @brief Serializes a protobuf message directly as the payload
+///        (UPAYLOAD_FORMAT_PROTOBUF).
+template <typename T>
+struct AsProtobuf {
+	static constexpr v1::UPayloadFormat FORMAT =
+	    v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF;
+
+	static bool serializeInto(const T& value, std::string& out) {
+		return value.SerializeToString(&out);
+	}
+
+	static bool deserializeInto(std::string_view payload, T& value) {
+		return value.ParseFromArray(payload.data(),
+		                            static_cast<int>(payload.size()));
+	}
+};
+
+/// @brief Serializes a protobuf message wrapped in a google::protobuf::Any
+///        (UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY).
+///
+/// Uses the single-pass encoding in utils::ProtoConverter::packToAny(), and
+/// does not construct an Any object when deserializing.
+template <typename T>
+struct AsAny {
+	static constexpr v1::UPayloadFormat FORMAT =
+	    v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY;
+
+	static bool serializeInto(const T& value, std::string& out) {
+		return utils::ProtoConverter::packToAny(value, out);
+	}
+
+	static bool deserializeInto(std::string_view payload, T& value) {
+		auto any = utils::ProtoConverter::parseAny(payload);
+		return any &&
+		       utils::ProtoConverter::anyTypeMatches(
+		           any->type_url, T::descriptor()->full_name()) &&
+		       value.ParseFromArray(any->value.data(),
+		                            static_cast<int>(any->value.size()));
+	}
+};
+
+}  // namespace uprotocol::datamodel::serializer::protobuf
+
+#endif  // UP_CPP_DATAMODEL_SERIALIZER_PROTOBUF_H
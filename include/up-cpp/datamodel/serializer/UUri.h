@@ -12,19 +12,91 @@
 #ifndef UP_CPP_DATAMODEL_SERIALIZER_UURI_H
 #define UP_CPP_DATAMODEL_SERIALIZER_UURI_H
 
+#include <up-cpp/utils/Expected.h>
 #include <uprotocol/v1/uri.pb.h>
 
+#include <array>
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 /// @brief Collection of interfaces for converting uprotocol::v1::UUri objects
 ///        between protobuf and alternative representations.
 namespace uprotocol::datamodel::serializer::uri {
 
+/// @brief Reasons a UUri string could not be deserialized by one of the
+///        non-throwing interfaces.
+enum class ParseError {
+	/// @brief The input string was empty
+	EMPTY_STRING,
+	/// @brief The input did not start with "up://", "//", or "/"
+	BAD_PREFIX,
+	/// @brief One or more '/'-separated segments were missing
+	MISSING_SEGMENT,
+	/// @brief A numeric segment was not a valid hexadecimal uint32
+	BAD_NUMBER,
+	/// @brief The string was well-formed, but the UUri it describes is not
+	///        a valid filter (see validator::uri::isValidFilter())
+	INVALID_URI
+};
+
+/// @brief Get a descriptive message for a parse error code.
+std::string_view message(ParseError);
+
+/// @brief Either a deserialized UUri or the reason deserialization failed.
+using UUriOrError = utils::Expected<v1::UUri, ParseError>;
+
 /// @brief Converts to and from a human-readable string representation of UUri
 ///        according to the UUri spec.
 struct AsString {
+	/// @brief Maximum number of characters in a serialized UUri.
+	///
+	/// This is a remote URI with an authority name of the longest length
+	/// allowed by the spec and every numeric field at its widest.
+	static constexpr size_t MAX_LENGTH =
+	    sizeof("//") - 1 + 128 + sizeof("/FFFFFFFF/FF/FFFF") - 1;
+
+	/// @brief Fixed-size buffer that can hold any serialized UUri.
+	using Buffer = std::array<char, MAX_LENGTH>;
+
+	/// @brief Serializes a UUri to a new string.
+	///
+	/// @remarks The exact length is computed before writing, so this
+	///          allocates at most once (and not at all for URIs that fit
+	///          within the small string optimization).
+	///
+	/// @throws InvalidUUri if the UUri is not a valid filter.
 	[[nodiscard]] static std::string serialize(const v1::UUri&);
+
+	/// @brief Writes the string form of a UUri into a caller-provided buffer.
+	///
+	/// No terminating null character is written.
+	///
+	/// @returns The number of characters written to the buffer.
+	/// @throws InvalidUUri if the UUri is not a valid filter.
+	static size_t serialize(const v1::UUri&, Buffer& out);
+
+	/// @brief Replaces the contents of a string with the string form of a
+	///        UUri.
+	///
+	/// @remarks Reusing the same string across calls avoids any allocation
+	///          once its capacity is large enough.
+	///
+	/// @throws InvalidUUri if the UUri is not a valid filter.
+	static void serialize(const v1::UUri&, std::string& out);
+
+	/// @throws std::invalid_argument if the string is not a well-formed UUri.
+	/// @throws InvalidUUri if the UUri is not a valid filter.
 	[[nodiscard]] static v1::UUri deserialize(const std::string&);
+
+	/// @brief Parses the string form of a UUri without throwing.
+	///
+	/// @remarks The only allocation made is for the authority name, and only
+	///          when it is too long for the small string optimization.
+	///
+	/// @returns The parsed UUri, or a ParseError describing why the string
+	///          is not a valid UUri.
+	[[nodiscard]] static UUriOrError tryDeserialize(std::string_view);
 };
 
 }  // namespace uprotocol::datamodel::serializer::uri
@@ -12,10 +12,14 @@
 #ifndef UP_CPP_DATAMODEL_SERIALIZER_UUID_H
 #define UP_CPP_DATAMODEL_SERIALIZER_UUID_H
 
+#include <up-cpp/utils/Expected.h>
+#include <up-cpp/utils/Span.h>
 #include <uprotocol/v1/uuid.pb.h>
 
+#include <array>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /// @brief Collection of interfaces for converting uprotocol::v1::UUID objects
@@ -25,16 +29,91 @@
 ///          As such, it can be automatically serialized with builder::Payload.
 namespace uprotocol::datamodel::serializer::uuid {
 
+/// @brief Reasons a UUID could not be deserialized by one of the non-throwing
+///        interfaces.
+enum class ParseError {
+	/// @brief The input was not the length of a serialized UUID
+	WRONG_LENGTH,
+	/// @brief A '-' separator was missing or in the wrong position
+	BAD_SEPARATOR,
+	/// @brief A character that should be a hex digit was not one
+	BAD_HEX_DIGIT
+};
+
+/// @brief Get a descriptive message for a parse error code.
+std::string_view message(ParseError);
+
+/// @brief Either a deserialized UUID or the reason deserialization failed.
+using UuidOrError = utils::Expected<v1::UUID, ParseError>;
+
 /// @brief Converts to and from a human-readable string representation of UUID
 struct AsString {
+	/// @brief Number of characters in a serialized UUID string.
+	static constexpr size_t LENGTH = 36;
+
+	/// @brief Fixed-size buffer that can hold exactly one serialized UUID.
+	using Buffer = std::array<char, LENGTH>;
+
 	[[nodiscard]] static std::string serialize(const v1::UUID&);
+
+	/// @brief Writes the string form of a UUID into a caller-provided buffer.
+	///
+	/// No terminating null character is written.
+	static void serialize(const v1::UUID&, Buffer& out);
+
+	/// @brief Replaces the contents of a string with the string form of a
+	///        UUID.
+	///
+	/// @remarks Reusing the same string across calls avoids any allocation
+	///          once its capacity has reached LENGTH.
+	static void serialize(const v1::UUID&, std::string& out);
+
+	/// @throws std::invalid_argument if the string is not a valid UUID.
 	[[nodiscard]] static v1::UUID deserialize(const std::string&);
+
+	/// @brief Parses the string form of a UUID without allocating or
+	///        throwing.
+	///
+	/// Upper and lower case hex digits are both accepted.
+	///
+	/// @returns The parsed UUID, or a ParseError describing why the string
+	///          is not a valid UUID.
+	[[nodiscard]] static UuidOrError tryDeserialize(std::string_view);
 };
 
 /// @brief Converts to and from byte vector representation of UUID
 struct AsBytes {
+	/// @brief Number of bytes in a serialized UUID.
+	static constexpr size_t LENGTH = 16;
+
+	/// @brief Fixed-size buffer that can hold exactly one serialized UUID.
+	using Buffer = std::array<uint8_t, LENGTH>;
+
 	[[nodiscard]] static std::vector<uint8_t> serialize(const v1::UUID&);
+
+	/// @brief Writes the big-endian byte form of a UUID into a
+	///        caller-provided buffer.
+	static void serialize(const v1::UUID&, Buffer& out);
+
+	/// @brief Writes the big-endian byte form of a UUID into the first
+	///        LENGTH bytes of a caller-provided region (e.g. a slice of a
+	///        wire header).
+	///
+	/// @throws std::invalid_argument if the region is smaller than LENGTH.
+	static void serialize(const v1::UUID&, utils::Span<uint8_t> out);
+
+	/// @throws std::invalid_argument if the vector is not LENGTH bytes long.
 	[[nodiscard]] static v1::UUID deserialize(const std::vector<uint8_t>&);
+
+	/// @throws std::invalid_argument if the region is not LENGTH bytes long.
+	[[nodiscard]] static v1::UUID deserialize(utils::Span<const uint8_t>);
+
+	/// @brief Reads the big-endian byte form of a UUID without allocating or
+	///        throwing.
+	///
+	/// @returns The UUID, or ParseError::WRONG_LENGTH if the region is not
+	///          LENGTH bytes long.
+	[[nodiscard]] static UuidOrError tryDeserialize(utils::Span<const uint8_t>);
 };
 
 }  // namespace uprotocol::datamodel::serializer::uuid
@@ -12,8 +12,12 @@
 #ifndef UP_CPP_DATAMODEL_VALIDATOR_UMESSAGE_H
 #define UP_CPP_DATAMODEL_VALIDATOR_UMESSAGE_H
 
+#include <up-cpp/utils/Span.h>
 #include <uprotocol/v1/umessage.pb.h>
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -58,6 +62,10 @@ enum class Reason {
 /// @brief Get a descriptive message for a reason code.
 std::string_view message(Reason);
 
+/// @brief Get the name of a reason code (e.g. "BAD_ID"), suitable for use
+///        as a metric label.
+std::string_view name(Reason);
+
 /// @brief Return type for validity checks.
 ///
 /// The recommended usage of these checks and return types looks something
@@ -81,6 +89,78 @@ using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 ///   * isValidNotification()
 [[nodiscard]] ValidationResult isValid(const v1::UMessage&);
 
+/// @brief Checks if UMessage is a valid UMessage of any format, using a time
+///        read from the system clock by the caller for all TTL checks.
+///
+/// Produces the same result as isValid(const v1::UMessage&) evaluated at
+/// time `now`. Reading the clock once and passing it to this check for many
+/// messages avoids a clock read per message.
+[[nodiscard]] ValidationResult isValid(
+    const v1::UMessage&, std::chrono::system_clock::time_point now);
+
+/// @brief Result of validating one message in a batch. Empty if the message
+///        is valid, otherwise the reason isValid() would have reported.
+using BatchResult = std::optional<Reason>;
+
+/// @brief Checks a batch of messages with isValid(), evaluating every TTL
+///        against the same point in time.
+///
+/// Intended for transports that receive messages in bursts. The time should
+/// be the transport's receive time for the burst where one is available.
+///
+/// @param messages Messages to check.
+/// @param now Time used for all TTL and timestamp checks.
+/// @param results Receives one BatchResult per message, in the same order.
+///                Entries past messages.size() are not modified.
+///
+/// @throws std::length_error if results is smaller than messages.
+/// @returns The number of valid messages.
+size_t validateBatch(utils::Span<const v1::UMessage> messages,
+                     std::chrono::system_clock::time_point now,
+                     utils::Span<BatchResult> results);
+
+/// @brief Checks a batch of messages with isValid(), reading the system
+///        clock once for the whole batch.
+///
+/// @see validateBatch(utils::Span<const v1::UMessage>,
+///                    std::chrono::system_clock::time_point,
+///                    utils::Span<BatchResult>)
+size_t validateBatch(utils::Span<const v1::UMessage> messages,
+                     utils::Span<BatchResult> results);
+
+/// @brief Set of Reasons, used to report every check a UMessage fails.
+struct ReasonSet {
+	using Mask = uint32_t;
+
+	Mask mask{0};
+
+	constexpr void insert(Reason reason) noexcept { mask |= bit(reason); }
+
+	[[nodiscard]] constexpr bool contains(Reason reason) const noexcept {
+		return (mask & bit(reason)) != 0;
+	}
+
+	[[nodiscard]] constexpr bool empty() const noexcept { return mask == 0; }
+
+	/// @brief Gets the number of distinct Reasons in the set.
+	[[nodiscard]] size_t size() const noexcept;
+
+private:
+	static constexpr Mask bit(Reason reason) noexcept {
+		return Mask{1} << static_cast<Mask>(reason);
+	}
+};
+
+/// @brief Runs every check isValid() would run and collects all the
+///        Reasons that failed, rather than stopping at the first.
+///
+/// @remarks Intended for diagnostics. isValid() is cheaper when only a
+///          pass/fail result is needed.
+///
+/// @returns An empty set if and only if isValid(message, now) passes.
+[[nodiscard]] ReasonSet allFailures(const v1::UMessage&,
+                                    std::chrono::system_clock::time_point now);
+
 /// @brief Checks if common attributes for all UMessage types are valid
 ///
 /// These checks must pass:
@@ -14,8 +14,13 @@
 
 #include <uprotocol/v1/uri.pb.h>
 
+#include <cstdint>
 #include <optional>
 
+namespace uprotocol::datamodel {
+class PackedUUri;
+}
+
 /// @brief Validators for UUri objects.
 namespace uprotocol::datamodel::validator::uri {
 
@@ -57,6 +62,75 @@ std::string_view message(Reason);
 ///     }
 using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 
+/// @brief Everything the UUri validators need to know about a UUri, decoded
+///        in a single pass by classify().
+///
+/// Each of the isValid*() checks can be answered from a Classification in
+/// constant time. Classification is trivially copyable, so it can be cached
+/// alongside a UUri that is checked repeatedly.
+struct Classification {
+	using Mask = uint32_t;
+
+	/// @name Forms the UUri is valid for
+	/// @{
+	static constexpr Mask RPC_METHOD = 1U << 0U;
+	static constexpr Mask RPC_RESPONSE = 1U << 1U;
+	static constexpr Mask DEFAULT_ENTITY = 1U << 2U;
+	static constexpr Mask PUBLISH_TOPIC = 1U << 3U;
+	static constexpr Mask NOTIFICATION_SOURCE = 1U << 4U;
+	static constexpr Mask NOTIFICATION_SINK = 1U << 5U;
+	static constexpr Mask SUBSCRIPTION = 1U << 6U;
+	static constexpr Mask FILTER = 1U << 7U;
+	/// @}
+
+	/// @name Other properties of the UUri
+	/// @{
+	static constexpr Mask EMPTY = 1U << 8U;
+	static constexpr Mask LOCAL = 1U << 9U;
+	/// @}
+
+	/// @name Fields holding a wildcard value
+	/// @{
+	static constexpr Mask WILDCARD_AUTHORITY = 1U << 16U;
+	static constexpr Mask WILDCARD_SERVICE_ID = 1U << 17U;
+	static constexpr Mask WILDCARD_INSTANCE_ID = 1U << 18U;
+	static constexpr Mask WILDCARD_VERSION = 1U << 19U;
+	static constexpr Mask WILDCARD_RESOURCE_ID = 1U << 20U;
+	static constexpr Mask ANY_WILDCARD =
+	    WILDCARD_AUTHORITY | WILDCARD_SERVICE_ID | WILDCARD_INSTANCE_ID |
+	    WILDCARD_VERSION | WILDCARD_RESOURCE_ID;
+	/// @}
+
+	/// @brief Bitwise OR of every flag above that applies to the UUri.
+	Mask mask{0};
+	/// @brief Reason isValidFilter() fails, if it does.
+	std::optional<Reason> filter_failure;
+	/// @brief Reason isEmpty() fails, if it does.
+	std::optional<Reason> empty_failure;
+
+	/// @brief Checks if all of the given flags are set.
+	[[nodiscard]] constexpr bool has(Mask flags) const noexcept {
+		return (mask & flags) == flags;
+	}
+
+	/// @brief Checks if any of the given flags are set.
+	[[nodiscard]] constexpr bool hasAny(Mask flags) const noexcept {
+		return (mask & flags) != 0;
+	}
+};
+
+/// @brief Decodes a UUri once into a Classification of every form it is
+///        valid for and every wildcard it contains.
+[[nodiscard]] Classification classify(const v1::UUri&);
+
+/// @brief Classifies a PackedUUri the same way as the v1::UUri it was
+///        created from.
+///
+/// Wildcard and local authorities are recognized by their interned IDs
+/// rather than by comparing names. The Classification can then be used with
+/// any of the constant-time checks below.
+[[nodiscard]] Classification classify(const PackedUUri&);
+
 /// @note DEPRECATED - This check can produce misleading results. It doesn't
 ///       handle filters with wildcards. It also is not very useful when
 ///       checking URI fields in messages where a message type is already
@@ -150,6 +224,24 @@ isValidDefaultSource(const v1::UUri&);
 /// This is just a check for a zero-length authority name string.
 [[nodiscard]] bool isLocal(const v1::UUri&);
 
+/// @name Constant-time checks against a precomputed Classification
+/// @remarks Each returns exactly what the overload taking the original
+///          v1::UUri would return.
+/// @{
+[[nodiscard]] ValidationResult isValidFilter(const Classification&);
+[[nodiscard]] ValidationResult isValidRpcMethod(const Classification&);
+[[nodiscard]] ValidationResult isValidRpcResponse(const Classification&);
+[[nodiscard]] ValidationResult isValidDefaultEntity(const Classification&);
+[[nodiscard]] ValidationResult isValidPublishTopic(const Classification&);
+[[nodiscard]] ValidationResult isValidNotificationSource(
+    const Classification&);
+[[nodiscard]] ValidationResult isValidNotificationSink(const Classification&);
+[[nodiscard]] ValidationResult isValidSubscription(const Classification&);
+[[nodiscard]] ValidationResult isEmpty(const Classification&);
+[[nodiscard]] bool isLocal(const Classification&);
+[[nodiscard]] bool verify_no_wildcards(const Classification&);
+/// @}
+
 /// @brief Checks if a UUri has a wildcard authority name.
 ///
 /// Checks if a UUri has a wildcard authority name, returns true if yes.
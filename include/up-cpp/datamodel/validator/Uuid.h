@@ -12,6 +12,7 @@
 #ifndef UP_CPP_DATAMODEL_VALIDATOR_UUID_H
 #define UP_CPP_DATAMODEL_VALIDATOR_UUID_H
 
+#include <up-cpp/utils/CoarseClock.h>
 #include <uprotocol/v1/uuid.pb.h>
 
 #include <chrono>
@@ -56,11 +57,31 @@ using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 /// @returns True if the UUID has valid UUID data, false otherwise.
 ValidationResult isUuid(const v1::UUID&);
 
+/// @brief Checks if the provided UUID contains valid uP v8 UUID data, using
+///        a time read from the system clock by the caller.
+/// @remarks Allows one clock read to be shared across many checks.
+ValidationResult isUuid(const v1::UUID&,
+                        std::chrono::system_clock::time_point now);
+
 /// @brief Checks if the provided UUID has expired based on the given TTL.
 /// @throws InvalidUuid if the UUID does not contain valid UUID data
 /// @returns True if the difference between the current system time and
 ///          the the timestamp in the UUID is greater than the TTL.
 ValidationResult isExpired(const v1::UUID& uuid, std::chrono::milliseconds ttl);
+
+/// @brief Checks if the provided UUID has expired based on the given TTL,
+///        using a time read from the system clock by the caller.
+/// @remarks Allows one clock read to be shared across many checks.
+ValidationResult isExpired(const v1::UUID& uuid, std::chrono::milliseconds ttl,
+                           std::chrono::system_clock::time_point now);
+
+/// @brief Checks if the provided UUID has expired based on the given TTL,
+///        using the cached time from a CoarseClock.
+/// @remarks Timestamps up to one clock resolution ahead of the cached time
+///          are not reported as FROM_THE_FUTURE, since the cached time may
+///          trail the system clock by that much.
+ValidationResult isExpired(const v1::UUID& uuid, std::chrono::milliseconds ttl,
+                           const utils::CoarseClock& clock);
 /// @}
 
 /// @name Inspection utilities
@@ -87,12 +108,29 @@ std::chrono::system_clock::time_point getTime(const v1::UUID& uuid);
 /// @returns The age of the UUID in milliseconds
 std::chrono::milliseconds getElapsedTime(const v1::UUID& uuid);
 
+/// @brief Gets the difference between a UUID's timestamp and the cached time
+///        from a CoarseClock.
+/// @throws InvalidUuid if the UUID does not contain valid UUID data
+/// @returns The age of the UUID in milliseconds, which is zero for UUIDs
+///          that are newer than the cached time.
+std::chrono::milliseconds getElapsedTime(const v1::UUID& uuid,
+                                         const utils::CoarseClock& clock);
+
 /// @brief Gets the time remaining before the UUID expires, based on the
 ///        given TTL.
 /// @throws InvalidUuid if the UUID does not contain valid UUID data
 /// @returns Remaining time (ttl - getElapsedTime(uuid)) in milliseconds
 std::chrono::milliseconds getRemainingTime(const v1::UUID& uuid,
                                            std::chrono::milliseconds ttl);
+
+/// @brief Gets the time remaining before the UUID expires, based on the
+///        given TTL and the cached time from a CoarseClock.
+/// @throws InvalidUuid if the UUID does not contain valid UUID data
+/// @returns Remaining time (ttl - getElapsedTime(uuid, clock)) in
+///          milliseconds
+std::chrono::milliseconds getRemainingTime(const v1::UUID& uuid,
+                                           std::chrono::milliseconds ttl,
+                                           const utils::CoarseClock& clock);
 /// @}
 
 /// @brief This exception indicates that a UUID object was provided that
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TRANSPORT_RECEIVEDISPATCHER_H
+#define UP_CPP_TRANSPORT_RECEIVEDISPATCHER_H
+
+#include <up-cpp/utils/CallbackConnection.h>
+#include <uprotocol/v1/umessage.pb.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace uprotocol::transport {
+
+/// @brief Thread pool for transport implementations to call their
+///        registered listeners with received messages.
+///
+/// Each listener has its own bounded queue of messages. A listener's
+/// messages are delivered one at a time, in the order they were passed to
+/// dispatch(), while different listeners are called in parallel across the
+/// pool. Listeners that are ready to run are spread over per-worker queues,
+/// and idle workers steal from busy ones, so a burst for one listener does
+/// not hold up the others.
+///
+/// A transport would typically hold a ReceiveDispatcher, pass each received
+/// message to dispatch() for every listener it matches, and call remove()
+/// from UTransport::cleanupListener().
+struct ReceiveDispatcher {
+	/// @brief The callable end of a listener connection, as passed to
+	///        UTransport::registerListenerImpl().
+	using Listener =
+	    utils::callbacks::CallerHandle<void, const v1::UMessage&>;
+
+	/// @brief What to do with a message for a listener whose queue is full.
+	enum class OverflowPolicy : uint8_t {
+		/// @brief Drop the new message
+		DROP_NEWEST,
+		/// @brief Drop the oldest queued message to make room
+		DROP_OLDEST,
+		/// @brief Block in dispatch() until there is room. Must not be used
+		///        if dispatch() is called from a listener.
+		BLOCK
+	};
+
+	struct Options {
+		/// @brief Number of worker threads. Zero uses one per hardware
+		///        thread.
+		size_t threads{0};
+		/// @brief Maximum number of messages queued per listener.
+		size_t queue_capacity{256};
+		OverflowPolicy overflow{OverflowPolicy::DROP_NEWEST};
+	};
+
+	struct Stats {
+		/// @brief Messages passed to a listener
+		uint64_t delivered{0};
+		/// @brief Messages dropped because a listener's queue was full, or
+		///        discarded by remove()
+		uint64_t dropped{0};
+		/// @brief Listener calls that threw an exception
+		uint64_t failed{0};
+	};
+
+	/// @brief Starts the worker threads.
+	///
+	/// @throws std::invalid_argument if queue_capacity is zero.
+	explicit ReceiveDispatcher(Options options);
+
+	/// @brief Starts the worker threads with the default options.
+	ReceiveDispatcher();
+
+	ReceiveDispatcher(const ReceiveDispatcher&) = delete;
+	ReceiveDispatcher& operator=(const ReceiveDispatcher&) = delete;
+
+	/// @brief Stops the workers, waiting for any listener calls in progress
+	///        to finish. Messages that are still queued may not be delivered.
+	~ReceiveDispatcher();
+
+	/// @brief Queues a message to be passed to a listener.
+	///
+	/// @returns True if the message was queued, or false if it was dropped
+	///          because the listener's queue was full.
+	bool dispatch(const Listener& listener, const v1::UMessage& message);
+
+	/// @see dispatch(const Listener&, const v1::UMessage&)
+	bool dispatch(const Listener& listener, v1::UMessage&& message);
+
+	/// @brief Discards the queue for a listener. Messages already queued for
+	///        it are dropped, though a call that is already running will
+	///        complete.
+	void remove(const Listener& listener);
+
+	/// @brief Blocks until every queued message has been delivered.
+	///
+	/// @remarks Must not be called from a listener.
+	void drain();
+
+	[[nodiscard]] Stats stats() const;
+
+	/// @brief Gets the number of worker threads.
+	[[nodiscard]] size_t threads() const { return workers_.size(); }
+
+private:
+	/// @brief Messages for one listener. Scheduled on at most one worker at
+	///        a time, which keeps the listener's calls in order.
+	struct Strand {
+		explicit Strand(Listener l) : listener(std::move(l)) {}
+
+		Listener listener;
+		std::mutex mtx;
+		std::condition_variable space;
+		std::deque<v1::UMessage> queue;
+		bool scheduled{false};
+		bool removed{false};
+	};
+
+	struct Worker {
+		std::mutex mtx;
+		std::deque<std::shared_ptr<Strand>> ready;
+		std::thread thread;
+	};
+
+	template <typename Message>
+	bool enqueue(const Listener& listener, Message&& message);
+
+	std::shared_ptr<Strand> strandFor(const Listener& listener);
+
+	/// @brief Places a strand on a worker's ready queue. Prefers the calling
+	///        worker, if called from one.
+	void schedule(std::shared_ptr<Strand> strand);
+
+	/// @brief Gets the next strand for a worker, stealing from the other
+	///        workers if its own queue is empty.
+	///
+	/// @returns nullptr once the dispatcher is stopping.
+	std::shared_ptr<Strand> take(size_t worker);
+
+	/// @brief Delivers a batch of messages from a strand.
+	///
+	/// @returns True if messages remain after the batch. The strand is still
+	///          marked as scheduled and must be passed to schedule() again.
+	bool run(Strand& strand);
+
+	/// @brief Marks messages as finished, waking drain() if none are left.
+	void finished(size_t count);
+
+	void work(size_t worker);
+
+	const Options options_;
+
+	mutable std::shared_mutex strands_mtx_;
+	std::map<Listener, std::shared_ptr<Strand>> strands_;
+
+	std::vector<std::unique_ptr<Worker>> workers_;
+	std::atomic<size_t> next_worker_{0};
+
+	std::mutex idle_mtx_;
+	std::condition_variable wake_;
+	std::condition_variable drained_;
+	size_t ready_{0};
+	bool stop_{false};
+
+	std::atomic<size_t> outstanding_{0};
+	std::atomic<uint64_t> delivered_{0};
+	std::atomic<uint64_t> dropped_{0};
+	std::atomic<uint64_t> failed_{0};
+};
+
+}  // namespace uprotocol::transport
+
+#endif  // UP_CPP_TRANSPORT_RECEIVEDISPATCHER_H
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TRANSPORT_SENDSCHEDULER_H
+#define UP_CPP_TRANSPORT_SENDSCHEDULER_H
+
+#include <up-cpp/transport/UTransport.h>
+#include <up-cpp/utils/Metrics.h>
+#include <uprotocol/v1/uattributes.pb.h>
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace uprotocol::transport {
+
+/// @brief Queues outgoing messages by priority and sends them from a
+///        dispatcher thread, so that high priority messages are not held up
+///        behind bulk traffic.
+///
+/// UTransport::send() sends synchronously in call order. Senders that share
+/// a transport can instead enqueue() their messages here. Each priority
+/// (CS0 - CS6) has its own bounded queue. A dispatcher thread takes messages
+/// from the queues according to the scheduling policy and passes them to
+/// UTransport::send(). Messages without a priority are queued as CS1, the
+/// default priority for uProtocol messages.
+///
+/// When a queue is full, enqueue() rejects the message with
+/// RESOURCE_EXHAUSTED. Producers can also watch for a queue filling up with
+/// congested() or Options::on_backpressure and slow down before messages
+/// start being rejected.
+///
+/// Messages remaining in the queues when the scheduler is destroyed are not
+/// sent. Their callbacks are called with CANCELLED.
+struct SendScheduler {
+	/// @brief Number of priority levels (CS0 - CS6).
+	static constexpr size_t PRIORITIES = 7;
+
+	enum class Policy : uint8_t {
+		/// @brief Always send from the highest priority non-empty queue.
+		///        Lower priorities can be starved by sustained high priority
+		///        traffic.
+		STRICT,
+		/// @brief Weighted round robin. In each round, a queue may send up to
+		///        its weight in messages, highest priority first. A new round
+		///        starts once every non-empty queue has used its weight.
+		WEIGHTED
+	};
+
+	/// @brief Called with a priority and true when its queue reaches the
+	///        high watermark, then with false when it drains to the low
+	///        watermark.
+	///
+	/// Called from the thread that caused the change, but never for the
+	/// same scheduler from two threads at once. Must not destroy the
+	/// scheduler.
+	using BackpressureCallback = std::function<void(v1::UPriority, bool)>;
+
+	struct Options {
+		Policy policy{Policy::STRICT};
+		/// @brief Messages per weighted round for CS0 - CS6. Only used with
+		///        Policy::WEIGHTED. Every weight must be at least 1.
+		std::array<uint32_t, PRIORITIES> weights{1, 1, 2, 4, 8, 16, 32};
+		/// @brief Maximum number of messages queued per priority.
+		size_t queue_capacity{1024};
+		/// @brief Queue depth at which a priority is considered congested.
+		size_t high_watermark{768};
+		/// @brief Queue depth at which a congested priority is cleared.
+		size_t low_watermark{256};
+		/// @brief (Optional) Notified when a priority becomes congested or
+		///        is cleared.
+		BackpressureCallback on_backpressure;
+	};
+
+	/// @brief Called on the dispatcher thread with the result of sending a
+	///        message.
+	///
+	/// The status is the result of UTransport::send(). If the message could
+	/// not be sent, it is instead:
+	///   * DEADLINE_EXCEEDED if its TTL expired while queued.
+	///   * INVALID_ARGUMENT if it otherwise failed validation.
+	///   * CANCELLED if the scheduler was destroyed first.
+	using SendCallback = std::function<void(const v1::UStatus&)>;
+
+	/// @brief Statistics for a single priority.
+	struct PriorityStats {
+		/// @brief Messages currently queued
+		size_t depth{0};
+		/// @brief Messages accepted by enqueue()
+		uint64_t enqueued{0};
+		/// @brief Messages rejected by enqueue() because the queue was full
+		uint64_t rejected{0};
+		/// @brief Messages taken from the queue by the dispatcher
+		uint64_t dispatched{0};
+		/// @brief Whether the queue is above its high watermark
+		bool congested{false};
+		/// @brief Time from enqueue() until the dispatcher took the message
+		utils::metrics::Histogram::Snapshot queue_latency;
+	};
+
+	/// @brief Starts the dispatcher thread.
+	///
+	/// @throws NullTransport if the transport is null.
+	/// @throws std::invalid_argument if the options are invalid: a capacity
+	///         of zero, watermarks not satisfying
+	///         low_watermark <= high_watermark <= queue_capacity, or a weight
+	///         of zero.
+	explicit SendScheduler(std::shared_ptr<UTransport> transport,
+	                       Options options);
+
+	/// @brief Starts the dispatcher thread with the default options.
+	explicit SendScheduler(std::shared_ptr<UTransport> transport);
+
+	SendScheduler(const SendScheduler&) = delete;
+	SendScheduler& operator=(const SendScheduler&) = delete;
+
+	/// @brief Stops the dispatcher. Queued messages are not sent.
+	~SendScheduler();
+
+	/// @brief Queues a message to be sent.
+	///
+	/// @param message Message to be sent.
+	/// @param on_sent (Optional) Called once the message has been sent, or
+	///                could not be sent.
+	///
+	/// @throws InvalidUMessage if the message doesn't pass the isValid()
+	///         check.
+	///
+	/// @returns * OKSTATUS if the message was queued.
+	///          * RESOURCE_EXHAUSTED if the queue for the message's priority
+	///            is full. on_sent is not called.
+	[[nodiscard]] v1::UStatus enqueue(v1::UMessage&& message,
+	                                  SendCallback&& on_sent = {});
+
+	/// @brief Checks if a priority's queue is above its high watermark.
+	[[nodiscard]] bool congested(v1::UPriority priority) const;
+
+	/// @brief Gets the statistics for a priority.
+	[[nodiscard]] PriorityStats stats(v1::UPriority priority) const;
+
+	/// @brief Blocks until all queued messages have been sent.
+	///
+	/// @remarks Must not be called from a SendCallback.
+	void flush();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		v1::UMessage message;
+		SendCallback on_sent;
+		Clock::time_point enqueued;
+	};
+
+	struct Queue {
+		std::deque<Entry> entries;
+		uint64_t enqueued{0};
+		uint64_t rejected{0};
+		uint64_t dispatched{0};
+		uint32_t credit{0};
+		std::atomic<bool> congested{false};
+		utils::metrics::Histogram queue_latency;
+	};
+
+	static size_t indexFor(v1::UPriority priority);
+
+	void dispatch();
+
+	/// @brief Picks the queue to send from next.
+	///
+	/// Must be called with queues_mtx_ held and at least one entry queued.
+	Queue& next();
+
+	/// @brief Notifies on_backpressure if the state of a queue has changed
+	///        since it was last notified.
+	///
+	/// Must be called without queues_mtx_ held.
+	void signal(size_t index);
+
+	const std::shared_ptr<UTransport> transport_;
+	const Options options_;
+
+	mutable std::mutex queues_mtx_;
+	std::array<Queue, PRIORITIES> queues_;
+	size_t queued_{0};
+	bool sending_{false};
+	bool stop_{false};
+	std::condition_variable wake_dispatcher_;
+	std::condition_variable flushed_;
+
+	std::mutex signal_mtx_;
+	std::array<bool, PRIORITIES> signalled_{};
+
+	std::thread dispatcher_;
+};
+
+}  // namespace uprotocol::transport
+
+#endif  // UP_CPP_TRANSPORT_SENDSCHEDULER_H
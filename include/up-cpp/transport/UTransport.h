@@ -12,6 +12,7 @@
 #ifndef UP_CPP_TRANSPORT_UTRANSPORT_H
 #define UP_CPP_TRANSPORT_UTRANSPORT_H
 
+#include <up-cpp/datamodel/builder/Payload.h>
 #include <up-cpp/utils/CallbackConnection.h>
 #include <up-cpp/utils/Expected.h>
 #include <uprotocol/v1/umessage.pb.h>
@@ -73,6 +74,27 @@ public:
 	///          * FAILSTATUS with the appropriate failure.
 	[[nodiscard]] v1::UStatus send(const v1::UMessage& message);
 
+	/// @brief Send a message with a payload that has not yet been built
+	///        into it.
+	///
+	/// Allows transports that can write scattered buffers to send the
+	/// payload's fragments without first joining them. The payload format
+	/// attribute is set from the payload.
+	///
+	/// @param message UMessage to be sent, with an empty payload.
+	/// @param payload Payload to send with the message.
+	///
+	/// @throws InvalidUMessage if the message doesn't pass the isValid() check
+	///         or already has a payload.
+	///
+	/// @see send(const v1::UMessage&)
+	///
+	/// @returns * OKSTATUS if the payload has been successfully
+	///            sent (ACK'ed)
+	///          * FAILSTATUS with the appropriate failure.
+	[[nodiscard]] v1::UStatus send(v1::UMessage&& message,
+	                               datamodel::builder::Payload&& payload);
+
 	/// @brief Callback function (void(const UMessage&))
 	using ListenCallback = typename CallbackConnection::Callback;
 
@@ -220,6 +242,24 @@ protected:
 	///          * FAILSTATUS with the appropriate failure.
 	[[nodiscard]] virtual v1::UStatus sendImpl(const v1::UMessage&) = 0;
 
+	/// @brief Send a message and separately provided payload using the
+	///        transport implementation.
+	///
+	/// The transport library can optionally implement this to write the
+	/// payload directly from payload.fragments().
+	///
+	/// @note The default implementation builds the payload into the message
+	///       and calls sendImpl(const v1::UMessage&).
+	///
+	/// @param message UMessage to be sent, with an empty payload and the
+	///                payload format attribute already set.
+	/// @param payload Payload to send with the message.
+	///
+	/// @returns * OKSTATUS if the payload has been successfully sent (ACK'ed)
+	///          * FAILSTATUS with the appropriate failure.
+	[[nodiscard]] virtual v1::UStatus sendPayloadImpl(
+	    v1::UMessage&& message, datamodel::builder::Payload&& payload);
+
 	/// @brief Represents the callable end of a callback connection.
 	///
 	/// This is a shared_ptr wrapping a callbacks::Connection. The
@@ -12,6 +12,8 @@
 #ifndef UP_CPP_UTILS_CALLBACKCONNECTION_H
 #define UP_CPP_UTILS_CALLBACKCONNECTION_H
 
+#include <up-cpp/utils/Metrics.h>
+
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -65,6 +67,10 @@ struct CallerHandle;
 namespace detail {
 template <typename RT>
 struct InvokeResult;
+
+/// @brief Histogram of the time spent in callbacks invoked through a
+///        Connection (up_callback_duration_seconds).
+metrics::Histogram& callbackDuration();
 }  // namespace detail
 
 /// @brief The callable end of a callback/handle connection.
@@ -158,6 +164,7 @@ struct [[nodiscard]] Connection {
 			}
 
 			if (auto locked_cb = callback.lock(); locked_cb) {
+				metrics::ScopedTimer timer(detail::callbackDuration);
 				if constexpr (!std::is_void_v<RT>) {
 					result = (*locked_cb)(std::forward<Args>(args)...);
 				} else {
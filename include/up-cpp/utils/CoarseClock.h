@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_COARSECLOCK_H
+#define UP_CPP_UTILS_COARSECLOCK_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace uprotocol::utils {
+
+/// @brief Clock that caches readings of the system and steady clocks,
+///        refreshed by a background thread at a fixed resolution.
+///
+/// Reading the cached time is a single atomic load, which is much cheaper
+/// than a clock call when TTLs and timestamps are checked for every message.
+/// In exchange, readings trail the real clocks by up to one resolution (more
+/// if the refresh thread is delayed by the scheduler), so this is only
+/// suitable where millisecond accuracy is enough, such as uProtocol UUID
+/// timestamps and TTLs.
+struct CoarseClock {
+	using SystemTime = std::chrono::system_clock::time_point;
+	using SteadyTime = std::chrono::steady_clock::time_point;
+
+	/// @brief A pair of readings taken together from the underlying clocks.
+	struct Reading {
+		SystemTime system;
+		SteadyTime steady;
+	};
+
+	/// @brief Callable that reads the underlying clocks.
+	using Source = std::function<Reading()>;
+
+	static constexpr std::chrono::milliseconds DEFAULT_RESOLUTION{1};
+
+	/// @brief Takes an initial reading, then starts a thread to refresh it
+	///        every resolution.
+	///
+	/// @param resolution How often to refresh. If zero, no thread is started
+	///                   and the readings only change when refresh() is
+	///                   called.
+	/// @param source Replaces the system and steady clocks. Intended for
+	///               tests.
+	///
+	/// @throws std::invalid_argument if resolution is negative.
+	explicit CoarseClock(
+	    std::chrono::milliseconds resolution = DEFAULT_RESOLUTION,
+	    Source source = {});
+
+	CoarseClock(const CoarseClock&) = delete;
+	CoarseClock& operator=(const CoarseClock&) = delete;
+
+	~CoarseClock();
+
+	/// @brief Gets the cached system clock time.
+	[[nodiscard]] SystemTime now() const noexcept {
+		return SystemTime(
+		    SystemTime::duration(system_.load(std::memory_order_relaxed)));
+	}
+
+	/// @brief Gets the cached steady clock time.
+	[[nodiscard]] SteadyTime steadyNow() const noexcept {
+		return SteadyTime(
+		    SteadyTime::duration(steady_.load(std::memory_order_relaxed)));
+	}
+
+	/// @brief Gets the interval between refreshes, which is the most the
+	///        cached times are expected to trail the real clocks by.
+	[[nodiscard]] std::chrono::milliseconds resolution() const noexcept {
+		return resolution_;
+	}
+
+	/// @brief Reads the source and updates the cached times immediately.
+	void refresh();
+
+	/// @brief Gets the process-wide clock, with the default resolution.
+	///
+	/// The refresh thread is started on first use. The clock is never
+	/// destroyed, so it remains safe to read during static destruction.
+	static CoarseClock& global();
+
+private:
+	void refreshLoop();
+
+	const std::chrono::milliseconds resolution_;
+	const Source source_;
+
+	std::atomic<SystemTime::rep> system_{0};
+	std::atomic<SteadyTime::rep> steady_{0};
+
+	std::mutex mtx_;
+	std::condition_variable stop_cv_;
+	bool stop_{false};
+	std::thread thread_;
+};
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_COARSECLOCK_H
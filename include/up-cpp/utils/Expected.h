@@ -57,7 +57,8 @@ private:
 template <typename T, typename E>
 class Expected {
 public:
-	constexpr explicit Expected(T arg) : storage_(std::forward<T>(arg)) {}
+	constexpr explicit Expected(const T& arg) : storage_(arg) {}
+	constexpr explicit Expected(T&& arg) : storage_(std::move(arg)) {}
 	// It E and T are the same type, this can cause problems. Previously, this
 	// was in use by implicit conversion
 	//  constexpr explicit Expected(E arg) :
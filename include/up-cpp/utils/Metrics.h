@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_METRICS_H
+#define UP_CPP_UTILS_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+/// @brief In-process metrics for the transport and communication layers.
+///
+/// Metrics are disabled by default. While disabled, the instrumented code
+/// paths do not register metrics, read clocks, or touch shared state beyond
+/// a single relaxed atomic load. Call setEnabled(true) early in the process
+/// to start collecting, then scrape with Registry::snapshot() or
+/// Registry::exportText().
+///
+/// Updates to Counter and Histogram values are lock-free and sharded across
+/// cache lines so that concurrent updates from different threads rarely
+/// contend. Registration and snapshots take a lock and are intended to be
+/// infrequent.
+///
+/// Built-in metrics:
+///   * up_transport_send_total / up_transport_send_failed_total
+///   * up_transport_send_invalid_total{reason="..."}
+///   * up_rpc_client_requests_total / up_rpc_client_responses_total
+///   * up_rpc_client_responses_failed_total / up_rpc_client_timeouts_total
+///   * up_rpc_client_pending (gauge; calls whose callback has not yet run)
+///   * up_rpc_server_requests_total / up_rpc_server_responses_total
+///   * up_rpc_server_requests_invalid_total{reason="..."}
+///   * up_receive_expired_total (messages dropped by an ExpiryFilter)
+///   * up_callback_duration_seconds (histogram; its count is the number of
+///     callback invocations, which covers messages delivered to transport
+///     listeners such as Subscriber and NotificationSink)
+namespace uprotocol::utils::metrics {
+
+namespace detail {
+inline std::atomic<bool> enabled{false};
+
+/// @brief Number of shards in sharded metrics.
+constexpr size_t SHARDS = 16;
+
+/// @brief Size of the cache lines that shards are aligned to.
+constexpr size_t CACHE_LINE = 64;
+
+/// @brief Gets the shard assigned to the calling thread.
+///
+/// Threads are assigned shards round-robin on first use.
+size_t shardIndex() noexcept;
+}  // namespace detail
+
+/// @brief Checks if metrics collection is enabled.
+inline bool enabled() noexcept {
+	return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// @brief Enables or disables metrics collection for the whole process.
+///
+/// Values already collected are kept when metrics are disabled.
+inline void setEnabled(bool enable) noexcept {
+	detail::enabled.store(enable, std::memory_order_relaxed);
+}
+
+/// @brief Monotonically increasing count, sharded per thread.
+struct Counter {
+	Counter() = default;
+	Counter(const Counter&) = delete;
+	Counter& operator=(const Counter&) = delete;
+
+	/// @brief Adds to the counter.
+	void increment(uint64_t amount = 1) noexcept {
+		shards_[detail::shardIndex()].value.fetch_add(
+		    amount, std::memory_order_relaxed);
+	}
+
+	/// @brief Sums the value across all shards.
+	[[nodiscard]] uint64_t value() const noexcept;
+
+	/// @brief Sets the value back to zero.
+	void reset() noexcept;
+
+private:
+	struct alignas(detail::CACHE_LINE) Shard {
+		std::atomic<uint64_t> value{0};
+	};
+	std::array<Shard, detail::SHARDS> shards_;
+};
+
+/// @brief Value that can go up and down (e.g. a queue depth).
+struct Gauge {
+	Gauge() = default;
+	Gauge(const Gauge&) = delete;
+	Gauge& operator=(const Gauge&) = delete;
+
+	void set(int64_t value) noexcept {
+		value_.store(value, std::memory_order_relaxed);
+	}
+
+	void add(int64_t amount) noexcept {
+		value_.fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] int64_t value() const noexcept {
+		return value_.load(std::memory_order_relaxed);
+	}
+
+	void reset() noexcept { set(0); }
+
+private:
+	std::atomic<int64_t> value_{0};
+};
+
+/// @brief Distribution of durations over fixed, exponentially sized buckets.
+///
+/// Bucket i counts observations no greater than 2^i microseconds, with the
+/// last bucket counting everything larger (i.e. +Inf). Each thread updates
+/// its own shard.
+struct Histogram {
+	/// @brief Number of buckets, including the +Inf bucket.
+	static constexpr size_t BUCKETS = 24;
+
+	/// @brief Merged view of the histogram's shards.
+	struct Snapshot {
+		/// @brief Observations per bucket (not cumulative).
+		std::array<uint64_t, BUCKETS> buckets{};
+		/// @brief Total number of observations.
+		uint64_t count{0};
+		/// @brief Sum of all observed durations.
+		std::chrono::nanoseconds sum{0};
+	};
+
+	Histogram() = default;
+	Histogram(const Histogram&) = delete;
+	Histogram& operator=(const Histogram&) = delete;
+
+	/// @brief Records one observation.
+	void observe(std::chrono::nanoseconds duration) noexcept;
+
+	/// @brief Merges the values from all shards.
+	[[nodiscard]] Snapshot snapshot() const noexcept;
+
+	/// @brief Sets all buckets back to zero.
+	void reset() noexcept;
+
+	/// @brief Gets the inclusive upper bound of a bucket.
+	///
+	/// @returns nanoseconds::max() for the +Inf bucket.
+	static std::chrono::nanoseconds upperBound(size_t bucket) noexcept;
+
+	/// @brief Gets the bucket a duration is counted in.
+	static size_t bucketFor(std::chrono::nanoseconds duration) noexcept;
+
+private:
+	struct alignas(detail::CACHE_LINE) Shard {
+		std::array<std::atomic<uint64_t>, BUCKETS> buckets{};
+		std::atomic<uint64_t> count{0};
+		std::atomic<int64_t> sum_ns{0};
+	};
+	std::array<Shard, detail::SHARDS> shards_;
+};
+
+/// @brief Records the time from construction to destruction in a histogram.
+///
+/// The histogram is only looked up, and the clock only read, when metrics
+/// are enabled at construction.
+struct ScopedTimer {
+	using HistogramGetter = Histogram& (*)();
+
+	explicit ScopedTimer(HistogramGetter getter) noexcept {
+		if (enabled()) {
+			getter_ = getter;
+			start_ = std::chrono::steady_clock::now();
+		}
+	}
+
+	ScopedTimer(const ScopedTimer&) = delete;
+	ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	~ScopedTimer() {
+		if (getter_ != nullptr) {
+			getter_().observe(std::chrono::steady_clock::now() - start_);
+		}
+	}
+
+private:
+	HistogramGetter getter_{nullptr};
+	std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief Named collection of metrics.
+///
+/// Metric names follow Prometheus conventions and may include a label set,
+/// for example `up_transport_send_invalid_total{reason="BAD_ID"}`. Metrics
+/// with the same name up to the label set form a family that shares one
+/// help string.
+///
+/// Metrics are never removed, so references returned by the registration
+/// functions remain valid for the lifetime of the registry.
+struct Registry {
+	/// @brief Values of all registered metrics at one point in time.
+	struct Snapshot {
+		std::map<std::string, uint64_t> counters;
+		std::map<std::string, int64_t> gauges;
+		std::map<std::string, Histogram::Snapshot> histograms;
+	};
+
+	Registry() = default;
+	Registry(const Registry&) = delete;
+	Registry& operator=(const Registry&) = delete;
+
+	/// @brief Gets the registry used by the built-in metrics.
+	static Registry& global();
+
+	/// @brief Gets the counter with a given name, registering it if needed.
+	///
+	/// @param name Name of the metric, optionally with labels.
+	/// @param help Description of the metric family. Only used the first
+	///             time the family is registered.
+	///
+	/// @throws std::invalid_argument if the name is registered as a
+	///         different type of metric.
+	Counter& counter(const std::string& name, const std::string& help = {});
+
+	/// @brief Gets the gauge with a given name, registering it if needed.
+	///
+	/// @see counter()
+	Gauge& gauge(const std::string& name, const std::string& help = {});
+
+	/// @brief Gets the histogram with a given name, registering it if needed.
+	///
+	/// @see counter()
+	Histogram& histogram(const std::string& name,
+	                     const std::string& help = {});
+
+	/// @brief Reads the current value of every registered metric.
+	[[nodiscard]] Snapshot snapshot() const;
+
+	/// @brief Formats the current values in the Prometheus text exposition
+	///        format. Histogram durations are exported in seconds.
+	[[nodiscard]] std::string exportText() const;
+
+	/// @brief Sets every registered metric back to zero.
+	void reset();
+
+private:
+	enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+	struct Family {
+		Type type;
+		std::string help;
+		std::set<std::string> members;
+	};
+
+	/// @brief Registers or checks the family a metric belongs to.
+	///
+	/// Must be called with mutex_ held.
+	void addToFamily(const std::string& name, Type type,
+	                 const std::string& help);
+
+	mutable std::mutex mutex_;
+	std::map<std::string, Family> families_;
+	std::map<std::string, std::unique_ptr<Counter>> counters_;
+	std::map<std::string, std::unique_ptr<Gauge>> gauges_;
+	std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+};
+
+}  // namespace uprotocol::utils::metrics
+
+#endif  // UP_CPP_UTILS_METRICS_H
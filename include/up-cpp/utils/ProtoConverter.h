@@ -7,10 +7,16 @@
 #include <uprotocol/v1/ustatus.pb.h>
 
 #include <chrono>
+#include <climits>
+#include <cstdint>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #include "up-cpp/datamodel/builder/Payload.h"
 #include "up-cpp/utils/Expected.h"
+#include "up-cpp/utils/SharedMemory.h"
 
 namespace uprotocol::utils {
 template <typename T>
@@ -99,6 +105,9 @@ struct ProtoConverter {
 
 	/// @brief Deserializes a protobuf message from a given payload.
 	///
+	/// Payloads in UPAYLOAD_FORMAT_SHM are parsed directly from the shared
+	/// memory they describe (see ShmView).
+	///
 	/// @tparam T The type to deserialize the message into.
 	/// @param message The `v1::UMessage` containing the payload.
 	/// @return `TOrStatus<T>` with the deserialized object or an error status.
@@ -115,11 +124,11 @@ struct ProtoConverter {
 					    "protobuf.");
 					return TOrStatus<T>(UnexpectedStatus(status));
 				}
-				return TOrStatus<T>(response);
+				return TOrStatus<T>(std::move(response));
 			}
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY: {
-				google::protobuf::Any any;
-				if (!any.ParseFromString(message.payload())) {
+				auto any = parseAny(message.payload());
+				if (!any) {
 					v1::UStatus status;
 					status.set_code(v1::UCode::INTERNAL);
 					status.set_message(
@@ -128,14 +137,43 @@ struct ProtoConverter {
 					return TOrStatus<T>(UnexpectedStatus(status));
 				}
 				T response;
-				if (!any.UnpackTo(&response)) {
+				if (!anyTypeMatches(any->type_url,
+				                    T::descriptor()->full_name()) ||
+				    !response.ParseFromArray(
+				        any->value.data(),
+				        static_cast<int>(any->value.size()))) {
 					v1::UStatus status;
 					status.set_code(v1::UCode::INTERNAL);
 					status.set_message(
 					    "extractFromProtobuf: Error when unpacking any.");
 					return TOrStatus<T>(UnexpectedStatus(status));
 				}
-				return TOrStatus<T>(response);
+				return TOrStatus<T>(std::move(response));
+			}
+			case v1::UPayloadFormat::UPAYLOAD_FORMAT_SHM: {
+				auto view = ShmView::open(message);
+				if (!view) {
+					v1::UStatus status;
+					status.set_code(v1::UCode::UNAVAILABLE);
+					std::string reason(
+					    "extractFromProtobuf: Error when opening shared "
+					    "memory: ");
+					reason += utils::message(view.error());
+					status.set_message(std::move(reason));
+					return TOrStatus<T>(UnexpectedStatus(status));
+				}
+				const auto data = view->data();
+				T response;
+				if (!response.ParseFromArray(data.data(),
+				                             static_cast<int>(data.size()))) {
+					v1::UStatus status;
+					status.set_code(v1::UCode::INTERNAL);
+					status.set_message(
+					    "extractFromProtobuf: Error when parsing payload from "
+					    "shared memory.");
+					return TOrStatus<T>(UnexpectedStatus(status));
+				}
+				return TOrStatus<T>(std::move(response));
 			}
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_UNSPECIFIED:
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON:
@@ -143,7 +181,6 @@ struct ProtoConverter {
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_SOMEIP_TLV:
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW:
 			case v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT:
-			case v1::UPayloadFormat::UPAYLOAD_FORMAT_SHM:
 			case v1::UPayloadFormat::
 			    UPayloadFormat_INT_MIN_SENTINEL_DO_NOT_USE_:
 			case v1::UPayloadFormat::
@@ -170,9 +207,9 @@ struct ProtoConverter {
 	/// @return `PayloadOrStatus` containing the payload or an error status.
 	template <typename T>
 	static PayloadOrStatus protoToPayload(const T& proto) {
-		google::protobuf::Any any;
+		auto any = packToAny(proto);
 
-		if (!any.PackFrom(proto)) {
+		if (!any) {
 			v1::UStatus status;
 			status.set_code(v1::UCode::INTERNAL);
 			status.set_message(
@@ -181,10 +218,84 @@ struct ProtoConverter {
 			return PayloadOrStatus(UnexpectedStatus(status));
 		}
 
-		const datamodel::builder::Payload payload(any);
+		datamodel::builder::Payload payload(
+		    std::move(*any),
+		    v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY);
 
-		return PayloadOrStatus(payload);
+		return PayloadOrStatus(std::move(payload));
 	}
+
+	/// @brief Serializes a protobuf object as a google::protobuf::Any.
+	///
+	/// The Any envelope and the object are written directly into a single
+	/// buffer. This produces the same bytes as Any::PackFrom() followed by
+	/// Any::SerializeAsString(), but the object is only serialized once.
+	///
+	/// @tparam T The type of the protobuf object to serialize.
+	/// @param proto The protobuf object to serialize.
+	/// @param out String to write the serialized Any to. Its contents are
+	///            replaced, but its capacity is reused.
+	/// @return False if the object is too large to be serialized.
+	template <typename T>
+	static bool packToAny(const T& proto, std::string& out) {
+		// Also caches the sizes of any sub-messages for the write below
+		const size_t value_size = proto.ByteSizeLong();
+		if (value_size > static_cast<size_t>(INT_MAX)) {
+			return false;
+		}
+
+		const size_t value_offset =
+		    writeAnyEnvelope(out, T::descriptor()->full_name(), value_size);
+		proto.SerializeWithCachedSizesToArray(
+		    reinterpret_cast<uint8_t*>(out.data() + value_offset));
+		return true;
+	}
+
+	/// @brief Serializes a protobuf object as a google::protobuf::Any.
+	///
+	/// @see packToAny(const T&, std::string&)
+	///
+	/// @return The serialized Any, or std::nullopt if the object is too
+	///         large to be serialized.
+	template <typename T>
+	static std::optional<std::string> packToAny(const T& proto) {
+		std::string serialized;
+		if (!packToAny(proto, serialized)) {
+			return std::nullopt;
+		}
+		return serialized;
+	}
+
+	/// @brief Fields of a serialized google::protobuf::Any.
+	struct AnyFields {
+		std::string_view type_url;
+		std::string_view value;
+	};
+
+	/// @brief Reads the fields of a serialized google::protobuf::Any without
+	///        copying them into an Any object.
+	///
+	/// @param serialized The serialized Any.
+	/// @return Views of the fields within `serialized`, or std::nullopt if it
+	///         could not be parsed.
+	static std::optional<AnyFields> parseAny(std::string_view serialized);
+
+	/// @brief Checks if an Any type URL refers to the named message type,
+	///        using the same rule as Any::Is().
+	///
+	/// @param type_url The type URL from an Any.
+	/// @param full_name The full name of a protobuf message type.
+	static bool anyTypeMatches(std::string_view type_url,
+	                           std::string_view full_name);
+
+private:
+	/// @brief Sizes `out` for a serialized Any holding a value of
+	///        `value_size` bytes and writes everything but the value.
+	///
+	/// @return The offset in `out` where the value must be written.
+	static size_t writeAnyEnvelope(std::string& out,
+	                               std::string_view full_name,
+	                               size_t value_size);
 };
 };      // namespace uprotocol::utils
 #endif  // UP_CPP_UTILS_PROTOCONVERTER_H
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_PROTOREADER_H
+#define UP_CPP_UTILS_PROTOREADER_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace uprotocol::utils {
+
+/// @brief Forward-only reader over the top-level fields of a serialized
+///        protobuf message.
+///
+/// Allows selected fields to be read directly from the wire bytes (e.g. a
+/// UMessage payload) without parsing the whole message into an object. A
+/// receiver can use this to filter messages before deciding whether a full
+/// parse is worthwhile.
+///
+/// Nested messages are returned as bytes(), which can be read with another
+/// ProtoReader.
+///
+/// @remarks Nothing is copied. Views returned by the reader point into the
+///          serialized data, which must outlive them.
+///
+/// @note Groups (a deprecated proto2 feature) are not supported and are
+///       treated as malformed data.
+class ProtoReader {
+public:
+	enum class WireType : uint8_t {
+		VARINT = 0,
+		FIXED64 = 1,
+		LENGTH_DELIMITED = 2,
+		FIXED32 = 5
+	};
+
+	/// @brief Creates a reader positioned before the first field.
+	explicit ProtoReader(std::string_view serialized) noexcept
+	    : remaining_(serialized) {}
+
+	/// @brief Advances to the next field.
+	///
+	/// @returns True if positioned on a field, false at the end of the data
+	///          or if the data is malformed (see failed()).
+	[[nodiscard]] bool next() noexcept;
+
+	/// @brief Checks if reading stopped because the data is malformed.
+	[[nodiscard]] bool failed() const noexcept { return failed_; }
+
+	/// @brief Gets the field number of the current field.
+	[[nodiscard]] uint32_t fieldNumber() const noexcept {
+		return field_number_;
+	}
+
+	/// @brief Gets the wire type of the current field.
+	[[nodiscard]] WireType wireType() const noexcept { return wire_type_; }
+
+	/// @brief Gets the value of the current field if it is a varint.
+	///
+	/// @remarks The value is returned as encoded. Callers reading int32,
+	///          uint32, or enum fields should narrow it with a cast, as
+	///          protobuf parsing does.
+	[[nodiscard]] std::optional<uint64_t> varint() const noexcept;
+
+	/// @brief Gets the contents of the current field if it is
+	///        length-delimited (string, bytes, or nested message).
+	[[nodiscard]] std::optional<std::string_view> bytes() const noexcept;
+
+	/// @brief Finds a length-delimited field in a serialized message.
+	///
+	/// @remarks If the field occurs more than once, the last occurrence is
+	///          returned, as for a string or bytes field. Occurrences of
+	///          nested message fields are not merged.
+	///
+	/// @returns The contents of the field, or std::nullopt if the field does
+	///          not occur or the data is malformed.
+	[[nodiscard]] static std::optional<std::string_view> findBytes(
+	    std::string_view serialized, uint32_t field_number) noexcept;
+
+private:
+	/// @brief Reads a varint from the start of remaining_.
+	bool readVarint(uint64_t& value) noexcept;
+
+	/// @brief Stops reading due to malformed data.
+	bool fail() noexcept;
+
+	std::string_view remaining_;
+	uint32_t field_number_{0};
+	WireType wire_type_{WireType::VARINT};
+	uint64_t varint_{0};
+	std::string_view bytes_;
+	bool failed_{false};
+};
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_PROTOREADER_H
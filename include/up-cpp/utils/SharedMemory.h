@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_SHAREDMEMORY_H
+#define UP_CPP_UTILS_SHAREDMEMORY_H
+
+#include <up-cpp/utils/Expected.h>
+#include <up-cpp/utils/Span.h>
+#include <uprotocol/v1/umessage.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/// @brief Local shared memory transfer of large payloads.
+///
+/// Payloads in UPAYLOAD_FORMAT_SHM carry a ShmDescriptor instead of the data
+/// itself. The data lives in a POSIX shared memory segment allocated from a
+/// ShmPool by the sender, and is mapped read-only by receivers on the same
+/// host with ShmView.
+///
+/// Each segment starts with a small header holding a reference count and a
+/// generation number. The sender's ShmSegment handle and every open ShmView
+/// hold one reference. A segment is only reused by its pool once the count
+/// drops to zero, at which point its generation is advanced. Descriptors for
+/// an earlier generation can no longer be opened.
+///
+/// @remarks Only the sender's handle keeps data alive while a message is in
+///          flight. Senders should hold the ShmSegment until receivers are
+///          expected to have opened it (e.g. until the next frame).
+namespace uprotocol::utils {
+
+/// @brief Reference to a range of bytes in a shared memory segment, as
+///        carried in the payload of a UPAYLOAD_FORMAT_SHM message.
+struct ShmDescriptor {
+	/// @brief Name of the segment, as passed to shm_open()
+	std::string name;
+	/// @brief Generation of the segment the data was written in
+	uint64_t generation{0};
+	/// @brief Start of the data, relative to the segment's data region
+	uint64_t offset{0};
+	/// @brief Number of bytes of data
+	uint64_t length{0};
+
+	enum class ParseError {
+		/// @brief Data is not a ShmDescriptor
+		BAD_MAGIC,
+		/// @brief Descriptor was written by an unsupported version
+		BAD_VERSION,
+		/// @brief Data ends before the descriptor does, or continues after
+		WRONG_LENGTH
+	};
+
+	/// @brief Encodes this descriptor for use as a payload.
+	[[nodiscard]] std::string serialize() const;
+
+	/// @brief Decodes a descriptor from a payload.
+	[[nodiscard]] static Expected<ShmDescriptor, ParseError> deserialize(
+	    std::string_view);
+};
+
+/// @brief Get a descriptive message for a descriptor parse error.
+std::string_view message(ShmDescriptor::ParseError);
+
+class ShmPool;
+
+/// @brief Sender's writable handle to a segment allocated from a ShmPool.
+///
+/// The handle holds one reference on the segment. The segment will not be
+/// reused while the handle exists.
+class ShmSegment {
+public:
+	ShmSegment(ShmSegment&&) noexcept;
+	ShmSegment& operator=(ShmSegment&&) noexcept;
+	ShmSegment(const ShmSegment&) = delete;
+	ShmSegment& operator=(const ShmSegment&) = delete;
+	~ShmSegment();
+
+	/// @brief Gets the writable data region of the segment.
+	[[nodiscard]] Span<uint8_t> data() const;
+
+	/// @brief Gets the size of the data region in bytes.
+	[[nodiscard]] size_t capacity() const;
+
+	/// @brief Describes a range of this segment's data region so it can be
+	///        sent to receivers.
+	///
+	/// @throws std::out_of_range if the range extends past capacity().
+	[[nodiscard]] ShmDescriptor describe(size_t length,
+	                                     size_t offset = 0) const;
+
+	struct State;
+
+private:
+	friend class ShmPool;
+	explicit ShmSegment(std::shared_ptr<State>);
+
+	std::shared_ptr<State> state_;
+};
+
+/// @brief Allocates shared memory segments and reuses them once released.
+///
+/// Segments are named "/<prefix>-<pid>-<n>". All segments are unlinked when
+/// the pool and every ShmSegment allocated from it have been destroyed.
+/// Receivers that already have a segment mapped are unaffected.
+///
+/// @remarks Thread-safe.
+class ShmPool {
+public:
+	explicit ShmPool(std::string prefix = "up-cpp");
+	~ShmPool();
+
+	ShmPool(const ShmPool&) = delete;
+	ShmPool& operator=(const ShmPool&) = delete;
+
+	/// @brief Gets a segment with at least `size` bytes of data region.
+	///
+	/// Reuses a released segment of sufficient capacity if one exists,
+	/// otherwise creates a new segment.
+	///
+	/// @throws std::system_error if a new segment could not be created.
+	[[nodiscard]] ShmSegment allocate(size_t size);
+
+	/// @brief Gets the number of segments currently owned by the pool.
+	[[nodiscard]] size_t size() const;
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Receiver's read-only mapping of the data referenced by a
+///        ShmDescriptor.
+///
+/// Holds one reference on the segment until destroyed, so the sender's pool
+/// will not reuse it while it is being read.
+class ShmView {
+public:
+	enum class OpenError {
+		/// @brief The message payload format is not UPAYLOAD_FORMAT_SHM
+		WRONG_FORMAT,
+		/// @brief The payload could not be parsed as a ShmDescriptor
+		BAD_DESCRIPTOR,
+		/// @brief The segment does not exist or could not be mapped
+		UNAVAILABLE,
+		/// @brief The segment has been reused since the descriptor was made
+		STALE,
+		/// @brief The described range extends past the end of the segment
+		OUT_OF_RANGE
+	};
+
+	using ViewOrError = Expected<ShmView, OpenError>;
+
+	/// @brief Maps the data referenced by a descriptor.
+	[[nodiscard]] static ViewOrError open(const ShmDescriptor&);
+
+	/// @brief Maps the data referenced by a UPAYLOAD_FORMAT_SHM message.
+	[[nodiscard]] static ViewOrError open(const v1::UMessage&);
+
+	ShmView(ShmView&&) noexcept;
+	ShmView& operator=(ShmView&&) noexcept;
+	ShmView(const ShmView&) = delete;
+	ShmView& operator=(const ShmView&) = delete;
+	~ShmView();
+
+	/// @brief Gets the referenced data.
+	[[nodiscard]] Span<const uint8_t> data() const;
+
+	/// @brief Gets the referenced data as a string_view (e.g. for parsing
+	///        with protobuf).
+	[[nodiscard]] std::string_view view() const;
+
+	struct Mapping;
+
+private:
+	ShmView(std::unique_ptr<Mapping>, Span<const uint8_t>);
+
+	std::unique_ptr<Mapping> mapping_;
+	Span<const uint8_t> data_;
+};
+
+/// @brief Get a descriptive message for a ShmView open error.
+std::string_view message(ShmView::OpenError);
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_SHAREDMEMORY_H
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_SPAN_H
+#define UP_CPP_UTILS_SPAN_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace uprotocol::utils {
+
+// A sentinel keeping watch for when we switch to C++20 and gain access to
+// the real std::span. Our limited copy should be replaced immediately.
+static_assert(!__has_cpp_attribute(__cpp_lib_span),
+              "Replace uprotocol::utils::Span with std::span");
+
+/// @name Temporary substitute for std::span
+/// @remarks See the reference for std::span:
+///          https://en.cppreference.com/w/cpp/container/span
+///          Only the dynamic extent form is provided. No further
+///          documentation is provided in this file.
+/// @{
+template <typename T>
+class Span {
+	template <typename Container, typename = void>
+	struct IsCompatible : std::false_type {};
+
+	template <typename Container>
+	struct IsCompatible<
+	    Container, std::void_t<decltype(std::data(std::declval<Container&>())),
+	                           decltype(std::size(std::declval<Container&>()))>>
+	    : std::is_convertible<std::remove_pointer_t<decltype(std::data(
+	                              std::declval<Container&>()))> (*)[],
+	                          T (*)[]> {};
+
+	template <typename Container>
+	static constexpr bool IS_COMPATIBLE =
+	    !std::is_same_v<std::remove_cv_t<Container>, Span> &&
+	    IsCompatible<Container>::value;
+
+public:
+	using element_type = T;
+	using value_type = std::remove_cv_t<T>;
+	using size_type = std::size_t;
+	using pointer = T*;
+	using reference = T&;
+	using iterator = T*;
+
+	constexpr Span() noexcept = default;
+	constexpr Span(const Span&) noexcept = default;
+	constexpr Span& operator=(const Span&) noexcept = default;
+
+	constexpr Span(pointer data, size_type size) noexcept
+	    : data_(data), size_(size) {}
+
+	template <typename Container,
+	          typename = std::enable_if_t<IS_COMPATIBLE<Container>>>
+	constexpr Span(Container& container) noexcept  // NOLINT(*-explicit-*)
+	    : data_(std::data(container)), size_(std::size(container)) {}
+
+	template <typename Container,
+	          typename = std::enable_if_t<IS_COMPATIBLE<const Container>>>
+	constexpr Span(const Container& container) noexcept  // NOLINT(*-explicit-*)
+	    : data_(std::data(container)), size_(std::size(container)) {}
+
+	[[nodiscard]] constexpr pointer data() const noexcept { return data_; }
+	[[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+	[[nodiscard]] constexpr size_type size_bytes() const noexcept {
+		return size_ * sizeof(T);
+	}
+	[[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+	constexpr iterator begin() const noexcept { return data_; }
+	constexpr iterator end() const noexcept { return data_ + size_; }
+
+	constexpr reference operator[](size_type idx) const { return data_[idx]; }
+	constexpr reference front() const { return data_[0]; }
+	constexpr reference back() const { return data_[size_ - 1]; }
+
+	constexpr Span first(size_type count) const {
+		if (count > size_) {
+			throw std::out_of_range("Span::first() count exceeds size");
+		}
+		return {data_, count};
+	}
+
+	constexpr Span last(size_type count) const {
+		if (count > size_) {
+			throw std::out_of_range("Span::last() count exceeds size");
+		}
+		return {data_ + (size_ - count), count};
+	}
+
+	constexpr Span subspan(size_type offset) const {
+		if (offset > size_) {
+			throw std::out_of_range("Span::subspan() offset exceeds size");
+		}
+		return {data_ + offset, size_ - offset};
+	}
+
+	constexpr Span subspan(size_type offset, size_type count) const {
+		if ((offset > size_) || (count > size_ - offset)) {
+			throw std::out_of_range("Span::subspan() range exceeds size");
+		}
+		return {data_ + offset, count};
+	}
+
+private:
+	pointer data_{nullptr};
+	size_type size_{0};
+};
+/// @}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_SPAN_H
@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_TRACING_H
+#define UP_CPP_UTILS_TRACING_H
+
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+#include <uprotocol/v1/uuid.pb.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief Emits a trace event from a static probe point.
+///
+/// Usage: UP_CPP_TRACE(SENT, message.attributes().id(), status.code());
+///
+/// The probe name is one of the tracing::Probe values. The status code is
+/// optional and defaults to OK.
+///
+/// Probes are compiled in when UP_CPP_TRACING is defined (the CMake option
+/// UP_CPP_ENABLE_TRACING, on by default). When compiled in, a probe costs a
+/// single relaxed atomic load until a sink is installed with
+/// tracing::setSink(). When compiled out, the arguments are not evaluated.
+#ifdef UP_CPP_TRACING
+#define UP_CPP_TRACE(probe, ...)           \
+	::uprotocol::utils::tracing::trace(    \
+	    ::uprotocol::utils::tracing::Probe::probe, __VA_ARGS__)
+#else
+#define UP_CPP_TRACE(probe, ...) static_cast<void>(0)
+#endif
+
+/// @brief Tracing of messages as they move through the library, for
+///        attributing latency to individual stages.
+namespace uprotocol::utils::tracing {
+
+/// @brief Static probe points in the library.
+enum class Probe : uint8_t {
+	/// @brief A UMessageBuilder assigned an ID to a new message
+	BUILT,
+	/// @brief An outgoing message passed validation in UTransport::send()
+	VALIDATED,
+	/// @brief The transport implementation returned from sending a message.
+	///        The event carries the send status.
+	SENT,
+	/// @brief A received message was passed to a library listener (RpcClient,
+	///        RpcServer, Subscriber, NotificationSink)
+	RECEIVED,
+	/// @brief The listener for a received message returned
+	DISPATCHED,
+	/// @brief An RPC response was passed to the caller's callback. The event
+	///        carries the request ID and the response's commstatus.
+	RPC_COMPLETED,
+	/// @brief An RPC ended without a response (expired, cancelled, or failed
+	///        to send). The event carries the request ID and the reason.
+	RPC_EXPIRED
+};
+
+/// @brief Get the name of a probe (e.g. "SENT").
+std::string_view name(Probe);
+
+/// @brief Single trace event as passed to a Sink.
+struct Event {
+	Probe probe{Probe::BUILT};
+	/// @brief ID of the message, or of the request for RPC events
+	v1::UUID id;
+	/// @brief Time at which the probe was hit
+	std::chrono::steady_clock::time_point when;
+	/// @brief Status associated with the event. OK for events without one.
+	v1::UCode code{v1::UCode::OK};
+};
+
+/// @brief Destination for trace events.
+///
+/// record() is called synchronously on the thread that hit the probe, so it
+/// should return quickly. It may be called from multiple threads at once.
+struct Sink {
+	virtual ~Sink() = default;
+	virtual void record(const Event& event) = 0;
+};
+
+/// @brief Installs the process-wide trace sink.
+///
+/// @param sink Sink to receive all future events, or nullptr to stop
+///             tracing. The previous sink may still receive events from
+///             probes that were already running when it was replaced.
+void setSink(std::shared_ptr<Sink> sink);
+
+/// @brief Gets the currently installed sink, if any.
+std::shared_ptr<Sink> getSink();
+
+namespace detail {
+inline std::atomic<bool> active{false};
+
+void emit(Probe probe, const v1::UUID& id, v1::UCode code);
+}  // namespace detail
+
+/// @brief Sends an event to the installed sink, if there is one.
+///
+/// Prefer UP_CPP_TRACE(), which compiles out when tracing is disabled.
+inline void trace(Probe probe, const v1::UUID& id,
+                  v1::UCode code = v1::UCode::OK) {
+	if (detail::active.load(std::memory_order_relaxed)) {
+		detail::emit(probe, id, code);
+	}
+}
+
+/// @brief Wraps a message listener so that RECEIVED and DISPATCHED are
+///        traced around each call.
+///
+/// Empty listeners are returned empty so that they are still rejected
+/// when registered. The listener is returned unwrapped when tracing is
+/// compiled out.
+template <typename Listener>
+std::function<void(const v1::UMessage&)> traceListener(Listener listener) {
+#ifdef UP_CPP_TRACING
+	if constexpr (std::is_constructible_v<bool, const Listener&>) {
+		if (!listener) {
+			return {};
+		}
+	}
+	return [listener = std::move(listener)](const v1::UMessage& message) {
+		UP_CPP_TRACE(RECEIVED, message.attributes().id());
+		listener(message);
+		UP_CPP_TRACE(DISPATCHED, message.attributes().id());
+	};
+#else
+	return listener;
+#endif
+}
+
+/// @brief Sink that keeps the most recent events in memory.
+struct RingBufferSink : public Sink {
+	/// @param capacity Maximum number of events held. Once full, the oldest
+	///                 events are overwritten.
+	///
+	/// @throws std::invalid_argument if capacity is zero.
+	explicit RingBufferSink(size_t capacity);
+
+	void record(const Event& event) override;
+
+	/// @brief Gets the held events, oldest first.
+	[[nodiscard]] std::vector<Event> events() const;
+
+	/// @brief Gets the number of events overwritten because the buffer was
+	///        full.
+	[[nodiscard]] size_t overwritten() const;
+
+	/// @brief Discards all held events.
+	void clear();
+
+private:
+	const size_t capacity_;
+	mutable std::mutex mutex_;
+	std::vector<Event> events_;
+	size_t next_{0};
+	size_t recorded_{0};
+};
+
+/// @brief Sink that forwards every event to a callback, e.g. to feed an
+///        external tracing framework.
+struct CallbackSink : public Sink {
+	using Callback = std::function<void(const Event&)>;
+
+	explicit CallbackSink(Callback&& callback)
+	    : callback_(std::move(callback)) {}
+
+	void record(const Event& event) override { callback_(event); }
+
+private:
+	Callback callback_;
+};
+
+}  // namespace uprotocol::utils::tracing
+
+#endif  // UP_CPP_UTILS_TRACING_H
@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "up-cpp/client/usubscription/v3/RequestBuilder.h"
+#include "up-cpp/utils/ProtoReader.h"
 
 namespace uprotocol::client::usubscription::v3 {
 
@@ -53,15 +54,56 @@ Consumer::Consumer(std::shared_ptr<uprotocol::transport::UTransport> transport,
 	return ConsumerOrStatus(utils::Unexpected<v1::UStatus>(status));
 }
 
+bool Consumer::isSubscriptionTopic(std::string_view payload,
+                                   uint32_t topic_field) const {
+	// A missing topic reads as an empty UUri, as it would when parsed. If the
+	// payload is malformed it will not match, and would fail to parse anyway.
+	const auto topic = utils::ProtoReader::findBytes(payload, topic_field);
+
+	std::string_view authority_name;
+	uint64_t ue_id = 0;
+	uint64_t ue_version_major = 0;
+	uint64_t resource_id = 0;
+
+	utils::ProtoReader reader(topic.value_or(std::string_view{}));
+	while (reader.next()) {
+		switch (reader.fieldNumber()) {
+			case v1::UUri::kAuthorityNameFieldNumber:
+				authority_name = reader.bytes().value_or(authority_name);
+				break;
+			case v1::UUri::kUeIdFieldNumber:
+				ue_id = reader.varint().value_or(ue_id);
+				break;
+			case v1::UUri::kUeVersionMajorFieldNumber:
+				ue_version_major = reader.varint().value_or(ue_version_major);
+				break;
+			case v1::UUri::kResourceIdFieldNumber:
+				resource_id = reader.varint().value_or(resource_id);
+				break;
+			default:
+				break;
+		}
+	}
+
+	// UUri's numeric fields are uint32, which parsing truncates to
+	return !reader.failed() &&
+	       (authority_name == subscription_topic_.authority_name()) &&
+	       (static_cast<uint32_t>(ue_id) == subscription_topic_.ue_id()) &&
+	       (static_cast<uint32_t>(ue_version_major) ==
+	        subscription_topic_.ue_version_major()) &&
+	       (static_cast<uint32_t>(resource_id) ==
+	        subscription_topic_.resource_id());
+}
+
 v1::UStatus Consumer::createNotificationSink() {
 	auto notification_sink_callback = [this](const v1::UMessage& update) {
-		if (update.has_payload()) {
+		// Updates for other topics are filtered out before parsing
+		if (update.has_payload() &&
+		    isSubscriptionTopic(update.payload(),
+		                        Update::kTopicFieldNumber)) {
 			Update data;
 			if (data.ParseFromString(update.payload())) {
-				if (data.topic().SerializeAsString() ==
-				    subscription_topic_.SerializeAsString()) {
-					subscription_update_ = std::move(data);
-				}
+				subscription_update_ = std::move(data);
 			}
 		}
 	};
@@ -98,13 +140,12 @@ v1::UStatus Consumer::subscribe(
 
 	auto on_response = [this](const auto& maybe_response) {
 		if (maybe_response.has_value() &&
-		    maybe_response.value().has_payload()) {
+		    maybe_response.value().has_payload() &&
+		    isSubscriptionTopic(maybe_response.value().payload(),
+		                        SubscriptionResponse::kTopicFieldNumber)) {
 			SubscriptionResponse response;
 			if (response.ParseFromString(maybe_response.value().payload())) {
-				if (response.topic().SerializeAsString() ==
-				    subscription_topic_.SerializeAsString()) {
-					subscription_response_ = response;
-				}
+				subscription_response_ = std::move(response);
 			}
 		}
 	};
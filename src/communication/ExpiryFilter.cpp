@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/communication/ExpiryFilter.h"
+
+#include <chrono>
+
+#include "up-cpp/datamodel/validator/Uuid.h"
+#include "up-cpp/utils/CoarseClock.h"
+#include "up-cpp/utils/Metrics.h"
+
+namespace {
+
+namespace metrics = uprotocol::utils::metrics;
+
+metrics::Counter& expiredCounter() {
+	static auto& counter = metrics::Registry::global().counter(
+	    "up_receive_expired_total",
+	    "Received messages dropped because their TTL had elapsed");
+	return counter;
+}
+
+}  // namespace
+
+namespace uprotocol::communication {
+
+bool ExpiryFilter::isExpired(const v1::UMessage& message) {
+	const auto& attributes = message.attributes();
+	if (!attributes.has_ttl() || (attributes.ttl() == 0)) {
+		return false;
+	}
+
+	auto [expired, reason] = datamodel::validator::uuid::isExpired(
+	    attributes.id(), std::chrono::milliseconds(attributes.ttl()),
+	    utils::CoarseClock::global());
+	return expired;
+}
+
+bool ExpiryFilter::drop(const v1::UMessage& message) const {
+	if (!isExpired(message)) {
+		return false;
+	}
+
+	dropped_->fetch_add(1, std::memory_order_relaxed);
+	if (metrics::enabled()) {
+		expiredCounter().increment();
+	}
+	return true;
+}
+
+}  // namespace uprotocol::communication
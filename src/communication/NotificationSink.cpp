@@ -14,6 +14,7 @@
 #include <google/protobuf/util/message_differencer.h>
 
 #include "up-cpp/datamodel/validator/UUri.h"
+#include "up-cpp/utils/Tracing.h"
 
 namespace uprotocol::communication {
 namespace UriValidator = datamodel::validator::uri;
@@ -36,15 +37,19 @@ NotificationSink::SinkOrStatus NotificationSink::create(
 		    std::string(UriValidator::message(*bad_source_reason)));
 	}
 
+	ExpiryFilter expiry_filter;
 	auto listener = transport->registerListener(
-	    std::move(callback), source_filter, transport->getEntityUri());
+	    utils::tracing::traceListener(expiry_filter.wrap(std::move(callback))),
+	    source_filter, transport->getEntityUri());
 
 	if (!listener) {
 		return SinkOrStatus(utils::Unexpected<v1::UStatus>(listener.error()));
 	}
 
-	return SinkOrStatus(std::make_unique<NotificationSink>(
-	    transport, std::forward<ListenHandle&&>(std::move(listener).value())));
+	auto sink = std::make_unique<NotificationSink>(
+	    transport, std::forward<ListenHandle&&>(std::move(listener).value()));
+	sink->expiry_filter_ = std::move(expiry_filter);
+	return SinkOrStatus(std::move(sink));
 }
 
 // NOTE: deprecated
@@ -39,9 +39,9 @@ NotificationSource::NotificationSource(
 
 v1::UStatus NotificationSource::notify(
     datamodel::builder::Payload&& payload) const {
-	auto message = notify_builder_.build(std::move(payload));
+	auto message = notify_builder_.buildAttributesFor(payload);
 
-	return transport_->send(message);
+	return transport_->send(std::move(message), std::move(payload));
 }
 
 v1::UStatus NotificationSource::notify() const {
@@ -35,12 +35,12 @@ Publisher::Publisher(std::shared_ptr<transport::UTransport> transport,
 }
 
 v1::UStatus Publisher::publish(datamodel::builder::Payload&& payload) const {
-	auto message = publish_builder_.build(std::move(payload));
+	auto message = publish_builder_.buildAttributesFor(payload);
 	if (!transport_) {
 		throw transport::NullTransport("transport cannot be null");
 	}
 
-	return transport_->send(message);
+	return transport_->send(std::move(message), std::move(payload));
 }
 
 }  // namespace uprotocol::communication
\ No newline at end of file
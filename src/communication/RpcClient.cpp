@@ -13,15 +13,145 @@
 
 #include <google/protobuf/util/message_differencer.h>
 
+#include <atomic>
 #include <chrono>
 #include <queue>
 #include <utility>
 
+#include "up-cpp/utils/Metrics.h"
+#include "up-cpp/utils/Tracing.h"
+
 namespace {
 namespace detail {
 
 using uprotocol::v1::UStatus;
 using ListenHandle = uprotocol::transport::UTransport::ListenHandle;
+namespace metrics = uprotocol::utils::metrics;
+
+struct ClientMetrics {
+	metrics::Counter& requests;
+	metrics::Counter& responses;
+	metrics::Counter& responses_failed;
+	metrics::Counter& timeouts;
+	metrics::Gauge& pending;
+
+	static ClientMetrics& get() {
+		auto& registry = metrics::Registry::global();
+		static ClientMetrics client_metrics{
+		    registry.counter("up_rpc_client_requests_total",
+		                     "RPC requests started by invokeMethod()"),
+		    registry.counter("up_rpc_client_responses_total",
+		                     "RPC responses delivered to callbacks"),
+		    registry.counter("up_rpc_client_responses_failed_total",
+		                     "RPC responses received with a non-OK "
+		                     "commstatus"),
+		    registry.counter("up_rpc_client_timeouts_total",
+		                     "RPC requests that expired before a response "
+		                     "was received"),
+		    registry.gauge("up_rpc_client_pending",
+		                   "RPC requests waiting for a response or expiry")};
+		return client_metrics;
+	}
+};
+
+// Called once the RPC callback is about to be called for any reason. Only
+// calls that were counted as pending when they started are removed, so that
+// enabling metrics mid-call cannot drive the gauge negative.
+void completed(bool counted_pending) {
+	if (counted_pending) {
+		ClientMetrics::get().pending.add(-1);
+	}
+}
+
+// Called once a response is about to be passed to the RPC callback
+void responded(const uprotocol::v1::UUID& request_id,
+               uprotocol::v1::UCode commstatus) {
+	UP_CPP_TRACE(RPC_COMPLETED, request_id, commstatus);
+	if (metrics::enabled()) {
+		auto& client_metrics = ClientMetrics::get();
+		client_metrics.responses.increment();
+		if (commstatus != uprotocol::v1::UCode::OK) {
+			client_metrics.responses_failed.increment();
+		}
+	}
+}
+
+// Per-request state used when RpcClient::setLatencyRecorder() is in use.
+//
+// A response can be delivered while send() is still running (inline from the
+// transport, or on another thread), so the call is only recorded once both
+// the send has returned and the callback has finished, by whichever of those
+// happens last.
+struct PendingTiming {
+	PendingTiming(
+	    std::shared_ptr<uprotocol::communication::RpcLatencyRecorder> recorder,
+	    const uprotocol::v1::UMessage& request,
+	    std::chrono::steady_clock::time_point started)
+	    : recorder_(std::move(recorder)) {
+		timing_.method = request.attributes().sink();
+		timing_.request_id = request.attributes().id();
+		timing_.build = started;
+	}
+
+	void sendStarted() {
+		timing_.send_start = std::chrono::steady_clock::now();
+	}
+
+	void sendEnded() {
+		timing_.send_end = std::chrono::steady_clock::now();
+		finish();
+	}
+
+	// Wraps the call to the RPC callback, then records the finished call
+	template <typename Invoke>
+	void callback(uprotocol::v1::UCode code, Invoke&& invoke) {
+		timing_.response = std::chrono::steady_clock::now();
+		invoke();
+		timing_.callback_done = std::chrono::steady_clock::now();
+		timing_.code = code;
+		finish();
+	}
+
+private:
+	void finish() {
+		// sendEnded() and callback() write disjoint fields, so only the last
+		// of the two to finish may read them all
+		if (remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+			return;
+		}
+		// If the response arrived before send() returned, the send can be
+		// considered done when the response arrived
+		if (timing_.send_end > timing_.response) {
+			timing_.send_end = timing_.response;
+		}
+		recorder_->record(timing_);
+	}
+
+	std::shared_ptr<uprotocol::communication::RpcLatencyRecorder> recorder_;
+	uprotocol::communication::RpcCallTiming timing_;
+	std::atomic<int> remaining_{2};
+};
+
+// Calls the RPC callback through the PendingTiming, if there is one
+template <typename Invoke>
+void timedCallback(const std::shared_ptr<PendingTiming>& timing,
+                   uprotocol::v1::UCode code, Invoke&& invoke) {
+	if (timing) {
+		timing->callback(code, std::forward<Invoke>(invoke));
+	} else {
+		invoke();
+	}
+}
+
+// Called once an error is about to be passed to the RPC callback in place of
+// a response
+void expired(const uprotocol::v1::UUID& request_id, const UStatus& reason) {
+	UP_CPP_TRACE(RPC_EXPIRED, request_id, reason.code());
+	if (metrics::enabled() &&
+	    (reason.code() == uprotocol::v1::UCode::DEADLINE_EXCEEDED)) {
+		ClientMetrics::get().timeouts.increment();
+	}
+}
 
 struct PendingRequest {
 	friend struct ScrubablePendingQueue;
@@ -125,11 +255,29 @@ RpcClient::RpcClient(std::shared_ptr<transport::UTransport> transport,
 	}
 }
 
-RpcClient::InvokeHandle RpcClient::invokeMethod(v1::UMessage&& request,
-                                                Callback&& callback) {
-	auto when_expire = std::chrono::steady_clock::now() + ttl_;
+RpcClient::InvokeHandle RpcClient::invokeMethod(
+    v1::UMessage&& request, Callback&& callback,
+    std::chrono::steady_clock::time_point started) {
+	const auto now = std::chrono::steady_clock::now();
+	auto when_expire = now + ttl_;
 	auto reqid = request.attributes().id();
 
+	std::shared_ptr<detail::PendingTiming> timing;
+	if (latency_recorder_) {
+		if (started == std::chrono::steady_clock::time_point{}) {
+			started = now;
+		}
+		timing = std::make_shared<detail::PendingTiming>(latency_recorder_,
+		                                                 request, started);
+	}
+
+	const bool counted_pending = utils::metrics::enabled();
+	if (counted_pending) {
+		auto& client_metrics = detail::ClientMetrics::get();
+		client_metrics.requests.increment();
+		client_metrics.pending.add(1);
+	}
+
 	// There are multiple paths to calling the callback. It can be called for
 	// errors communicating with the transport, errors returned from the
 	// uProtocol network, when the request times out (by the ExpireWorker), or
@@ -150,25 +298,37 @@ RpcClient::InvokeHandle RpcClient::invokeMethod(v1::UMessage&& request,
 	// This is likely less efficient than a single shared callback that maps
 	// responses via request IDs, but we can always optimize once we
 	// characterize performance.
-	auto wrapper = [callable, reqid = std::move(reqid),
-	                callback_once](const v1::UMessage& m) mutable {
+	auto wrapper = [callable, reqid = std::move(reqid), callback_once, timing,
+	                counted_pending](const v1::UMessage& m) mutable {
 		using MsgDiff = google::protobuf::util::MessageDifferencer;
 		if (MsgDiff::Equals(m.attributes().reqid(), reqid)) {
+			UP_CPP_TRACE(RECEIVED, m.attributes().id());
 			if (m.attributes().commstatus() == v1::UCode::OK) {
-				std::call_once(*callback_once, [&callable, &m]() {
-					MessageOrStatus message(m);
-					callable(std::move(message));
+				std::call_once(*callback_once, [&callable, &m, &reqid,
+				                                &timing, counted_pending]() {
+					detail::completed(counted_pending);
+					detail::responded(reqid, v1::UCode::OK);
+					detail::timedCallback(timing, v1::UCode::OK, [&]() {
+						MessageOrStatus message(m);
+						callable(std::move(message));
+					});
 				});
 			} else {
 				v1::UStatus status;
 				status.set_code(m.attributes().commstatus());
 				status.set_message("Received response with !OK commstatus");
-				std::call_once(
-				    *callback_once, [&callable, status = std::move(status)]() {
-					    callable(utils::Expected<v1::UMessage, v1::UStatus>(
-					        utils::Unexpected<v1::UStatus>(status)));
-				    });
+				std::call_once(*callback_once, [&callable, &reqid, &timing,
+				                                counted_pending,
+				                                status = std::move(status)]() {
+					detail::completed(counted_pending);
+					detail::responded(reqid, status.code());
+					detail::timedCallback(timing, status.code(), [&]() {
+						callable(utils::Expected<v1::UMessage, v1::UStatus>(
+						    utils::Unexpected<v1::UStatus>(status)));
+					});
+				});
 			}
+			UP_CPP_TRACE(DISPATCHED, m.attributes().id());
 		}
 	};
 	///////////////////////////////////////////////////////////////////////////
@@ -176,12 +336,19 @@ RpcClient::InvokeHandle RpcClient::invokeMethod(v1::UMessage&& request,
 	///////////////////////////////////////////////////////////////////////////
 	// Called when the request has expired or failed. Will be handed off to the
 	// expiration monitoring service once the request has been sent.
-	auto expire = [callable, callback_once](v1::UStatus&& reason) mutable {
-		std::call_once(*callback_once,
-		               [&callable, reason = std::move(reason)]() {
-			               callable(utils::Expected<v1::UMessage, v1::UStatus>(
-			                   utils::Unexpected<v1::UStatus>(reason)));
-		               });
+	auto expire = [callable, callback_once, timing, counted_pending,
+	               request_id = request.attributes().id()](
+	                  v1::UStatus&& reason) mutable {
+		std::call_once(*callback_once, [&callable, &request_id, &timing,
+		                                counted_pending,
+		                                reason = std::move(reason)]() {
+			detail::completed(counted_pending);
+			detail::expired(request_id, reason);
+			detail::timedCallback(timing, reason.code(), [&]() {
+				callable(utils::Expected<v1::UMessage, v1::UStatus>(
+				    utils::Unexpected<v1::UStatus>(reason)));
+			});
+		});
 	};
 	///////////////////////////////////////////////////////////////////////////
 
@@ -189,10 +356,19 @@ RpcClient::InvokeHandle RpcClient::invokeMethod(v1::UMessage&& request,
 	    std::move(wrapper), request.attributes().sink(),
 	    request.attributes().source());
 
+	if (timing) {
+		timing->sendStarted();
+	}
 	if (!maybe_handle) {
+		if (timing) {
+			timing->sendEnded();
+		}
 		expire(std::move(maybe_handle).error());
 	} else {
 		auto send_result = transport_->send(request);
+		if (timing) {
+			timing->sendEnded();
+		}
 		if (send_result.code() != v1::UCode::OK) {
 			expire(std::move(send_result));
 		} else {
@@ -208,13 +384,15 @@ RpcClient::InvokeHandle RpcClient::invokeMethod(v1::UMessage&& request,
 RpcClient::InvokeHandle RpcClient::invokeMethod(
     const v1::UUri& method, datamodel::builder::Payload&& payload,
     Callback&& callback) {
+	const auto started = latencyStart();
 	return invokeMethod(builder_.build(method, std::move(payload)),
-	                    std::move(callback));
+	                    std::move(callback), started);
 }
 
 RpcClient::InvokeHandle RpcClient::invokeMethod(const v1::UUri& method,
                                                 Callback&& callback) {
-	return invokeMethod(builder_.build(method), std::move(callback));
+	const auto started = latencyStart();
+	return invokeMethod(builder_.build(method), std::move(callback), started);
 }
 
 RpcClient::InvokeFuture RpcClient::invokeMethod(
@@ -249,6 +427,15 @@ RpcClient::InvokeFuture RpcClient::invokeMethod(const v1::UUri& method) {
 	return {std::move(future), std::move(handle)};
 }
 
+void RpcClient::setLatencyRecorder(
+    std::shared_ptr<RpcLatencyRecorder> recorder) {
+	latency_recorder_ = std::move(recorder);
+}
+
+const std::shared_ptr<RpcLatencyRecorder>& RpcClient::latencyRecorder() const {
+	return latency_recorder_;
+}
+
 RpcClient::RpcClient(RpcClient&&) noexcept = default;
 RpcClient::~RpcClient() = default;
 
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/communication/RpcLatency.h"
+
+#include <stdexcept>
+#include <string_view>
+
+#include "up-cpp/datamodel/serializer/UUri.h"
+
+namespace uprotocol::communication {
+
+RpcLatencyRecorder::RpcLatencyRecorder(std::chrono::nanoseconds slow_threshold,
+                                       size_t slow_call_capacity)
+    : slow_threshold_(slow_threshold),
+      slow_call_capacity_(slow_call_capacity) {
+	if (slow_call_capacity_ == 0) {
+		throw std::invalid_argument(
+		    "RpcLatencyRecorder slow call capacity cannot be zero");
+	}
+	slow_calls_.reserve(slow_call_capacity_);
+}
+
+void RpcLatencyRecorder::record(const RpcCallTiming& timing) {
+	auto& histograms = histogramsFor(timing.method);
+	histograms.calls.fetch_add(1, std::memory_order_relaxed);
+	if (timing.code != v1::UCode::OK) {
+		histograms.failed.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	auto observe = [&histograms](Stage stage, auto from, auto to) {
+		histograms.stages[static_cast<size_t>(stage)].observe(to - from);
+	};
+	observe(Stage::BUILD, timing.build, timing.send_start);
+	observe(Stage::SEND, timing.send_start, timing.send_end);
+	observe(Stage::WAIT, timing.send_end, timing.response);
+	observe(Stage::CALLBACK, timing.response, timing.callback_done);
+	observe(Stage::TOTAL, timing.build, timing.callback_done);
+
+	if (timing.total() >= slow_threshold_) {
+		std::lock_guard const lock(slow_calls_mtx_);
+		if (slow_calls_.size() < slow_call_capacity_) {
+			slow_calls_.push_back(timing);
+		} else {
+			slow_calls_[next_slow_call_] = timing;
+		}
+		next_slow_call_ = (next_slow_call_ + 1) % slow_call_capacity_;
+	}
+}
+
+std::vector<RpcCallTiming> RpcLatencyRecorder::slowCalls() const {
+	std::lock_guard const lock(slow_calls_mtx_);
+	std::vector<RpcCallTiming> ordered;
+	ordered.reserve(slow_calls_.size());
+	if (slow_calls_.size() == slow_call_capacity_) {
+		const auto oldest =
+		    slow_calls_.begin() + static_cast<ptrdiff_t>(next_slow_call_);
+		ordered.insert(ordered.end(), oldest, slow_calls_.end());
+		ordered.insert(ordered.end(), slow_calls_.begin(), oldest);
+	} else {
+		ordered = slow_calls_;
+	}
+	return ordered;
+}
+
+std::map<std::string, RpcLatencyRecorder::MethodStats>
+RpcLatencyRecorder::methodStats() const {
+	std::lock_guard const lock(methods_mtx_);
+	std::map<std::string, MethodStats> stats;
+	for (const auto& [method, histograms] : methods_) {
+		auto& method_stats = stats[method];
+		method_stats.calls = histograms->calls.load(std::memory_order_relaxed);
+		method_stats.failed =
+		    histograms->failed.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < STAGES; ++i) {
+			method_stats.stages[i] = histograms->stages[i].snapshot();
+		}
+	}
+	return stats;
+}
+
+void RpcLatencyRecorder::reset() {
+	{
+		// Methods are kept so that references held by record() stay valid
+		std::lock_guard const lock(methods_mtx_);
+		for (auto& [method, histograms] : methods_) {
+			histograms->calls.store(0, std::memory_order_relaxed);
+			histograms->failed.store(0, std::memory_order_relaxed);
+			for (auto& stage : histograms->stages) {
+				stage.reset();
+			}
+		}
+	}
+	std::lock_guard const lock(slow_calls_mtx_);
+	slow_calls_.clear();
+	next_slow_call_ = 0;
+}
+
+RpcLatencyRecorder::MethodHistograms& RpcLatencyRecorder::histogramsFor(
+    const v1::UUri& method) {
+	using UriSerializer = datamodel::serializer::uri::AsString;
+	UriSerializer::Buffer buffer;
+	const std::string_view key(buffer.data(),
+	                           UriSerializer::serialize(method, buffer));
+
+	std::lock_guard const lock(methods_mtx_);
+	auto found = methods_.find(key);
+	if (found == methods_.end()) {
+		found = methods_
+		            .emplace(std::string(key),
+		                     std::make_unique<MethodHistograms>())
+		            .first;
+	}
+	return *found->second;
+}
+
+}  // namespace uprotocol::communication
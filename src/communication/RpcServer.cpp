@@ -11,6 +11,50 @@
 
 #include "up-cpp/communication/RpcServer.h"
 
+#include <array>
+#include <string>
+
+#include "up-cpp/utils/Metrics.h"
+#include "up-cpp/utils/Tracing.h"
+
+namespace {
+
+namespace metrics = uprotocol::utils::metrics;
+namespace message_validator = uprotocol::datamodel::validator::message;
+
+constexpr size_t NUM_REASONS =
+    static_cast<size_t>(message_validator::Reason::WRONG_MESSAGE_TYPE) + 1;
+
+struct ServerMetrics {
+	metrics::Counter& requests;
+	metrics::Counter& responses;
+	std::array<metrics::Counter*, NUM_REASONS> invalid;
+
+	static ServerMetrics& get() {
+		static ServerMetrics server_metrics = [] {
+			auto& registry = metrics::Registry::global();
+			ServerMetrics m{
+			    registry.counter("up_rpc_server_requests_total",
+			                     "Valid RPC requests passed to a callback"),
+			    registry.counter("up_rpc_server_responses_total",
+			                     "RPC responses sent"),
+			    {}};
+			for (size_t i = 0; i < NUM_REASONS; ++i) {
+				m.invalid[i] = &registry.counter(
+				    "up_rpc_server_requests_invalid_total{reason=\"" +
+				        std::string(message_validator::name(
+				            static_cast<message_validator::Reason>(i))) +
+				        "\"}",
+				    "Received RPC requests dropped by validation");
+			}
+			return m;
+		}();
+		return server_metrics;
+	}
+};
+
+}  // namespace
+
 namespace uprotocol::communication {
 
 namespace Validator = datamodel::validator;
@@ -82,13 +126,27 @@ v1::UStatus RpcServer::connect(const v1::UUri& method, RpcCallback&& callback) {
 
 	auto result = transport_->registerListener(
 	    // listener=
-	    [this](const v1::UMessage& request) {
+	    utils::tracing::traceListener([this](const v1::UMessage& request) {
+		    // Shed requests the client has already given up on before doing
+		    // any work for them
+		    if (expiry_filter_.drop(request)) {
+			    return;
+		    }
+
 		    // Validate the request message using a RPC message validator.
 		    auto [valid, reason] =
 		        Validator::message::isValidRpcRequest(request);
 		    if (!valid) {
+			    if (metrics::enabled()) {
+				    ServerMetrics::get()
+				        .invalid[static_cast<size_t>(*reason)]
+				        ->increment();
+			    }
 			    return;
 		    }
+		    if (metrics::enabled()) {
+			    ServerMetrics::get().requests.increment();
+		    }
 
 		    // Create a response message builder using the request message.
 		    auto builder =
@@ -119,7 +177,10 @@ v1::UStatus RpcServer::connect(const v1::UUri& method, RpcCallback&& callback) {
 			    // Ignoring status code for transport send
 			    std::ignore = transport_->send(response);
 		    }
-	    },
+		    if (metrics::enabled()) {
+			    ServerMetrics::get().responses.increment();
+		    }
+	    }),
 	    // source_filter=
 	    []() {
 		    v1::UUri any_uri;
@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "up-cpp/datamodel/validator/UUri.h"
+#include "up-cpp/utils/Tracing.h"
 
 namespace uprotocol::communication {
 namespace uri_validator = uprotocol::datamodel::validator::uri;
@@ -34,16 +35,21 @@ namespace uri_validator = uprotocol::datamodel::validator::uri;
 		    std::string(uri_validator::message(*bad_source_reason)));
 	}
 
-	auto handle = transport->registerListener(std::move(callback), topic);
+	ExpiryFilter expiry_filter;
+	auto handle = transport->registerListener(
+	    utils::tracing::traceListener(expiry_filter.wrap(std::move(callback))),
+	    topic);
 
 	if (!handle) {
 		return SubscriberOrStatus(
 		    utils::Unexpected<v1::UStatus>(handle.error()));
 	}
 
-	return SubscriberOrStatus(std::make_unique<Subscriber>(
+	auto subscriber = std::make_unique<Subscriber>(
 	    std::forward<std::shared_ptr<transport::UTransport>>(transport),
-	    std::forward<ListenHandle&&>(std::move(handle).value())));
+	    std::forward<ListenHandle&&>(std::move(handle).value()));
+	subscriber->expiry_filter_ = std::move(expiry_filter);
+	return SubscriberOrStatus(std::move(subscriber));
 }
 
 Subscriber::Subscriber(std::shared_ptr<transport::UTransport> transport,
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/datamodel/AuthorityInterner.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+using uprotocol::datamodel::AuthorityInterner;
+using Id = AuthorityInterner::Id;
+
+// Names are stored in fixed-size segments that are allocated on demand and
+// never moved, so readers can index them without taking a lock. A name's
+// slot is fully written before size_ is advanced past it, and readers only
+// access slots below the size_ they observe.
+class Table {
+public:
+	static Table& instance() {
+		static Table table;
+		return table;
+	}
+
+	Id intern(std::string_view name) {
+		{
+			std::shared_lock lock(ids_mutex_);
+			if (auto existing = ids_.find(name); existing != ids_.end()) {
+				return existing->second;
+			}
+		}
+
+		std::unique_lock lock(ids_mutex_);
+		// Another thread may have added the name while we were unlocked
+		if (auto existing = ids_.find(name); existing != ids_.end()) {
+			return existing->second;
+		}
+		return add(name);
+	}
+
+	std::optional<Id> find(std::string_view name) {
+		std::shared_lock lock(ids_mutex_);
+		if (auto existing = ids_.find(name); existing != ids_.end()) {
+			return existing->second;
+		}
+		return std::nullopt;
+	}
+
+	std::string_view name(Id id) const {
+		if (id >= size_.load(std::memory_order_acquire)) {
+			throw std::out_of_range("Unknown authority ID");
+		}
+		return (*segments_[id / SEGMENT_SIZE].load(
+		    std::memory_order_acquire))[id % SEGMENT_SIZE];
+	}
+
+	size_t size() const noexcept {
+		return size_.load(std::memory_order_acquire);
+	}
+
+private:
+	static constexpr size_t SEGMENT_SIZE = 256;
+	static constexpr size_t NUM_SEGMENTS =
+	    AuthorityInterner::CAPACITY / SEGMENT_SIZE;
+	using Segment = std::array<std::string, SEGMENT_SIZE>;
+
+	Table() {
+		std::unique_lock lock(ids_mutex_);
+		add("");
+		add("*");
+	}
+
+	// Caller must hold ids_mutex_ exclusively
+	Id add(std::string_view name) {
+		const auto id = size_.load(std::memory_order_relaxed);
+		if (id >= AuthorityInterner::CAPACITY) {
+			throw std::length_error("Authority interner is full");
+		}
+
+		auto& owned = owned_segments_[id / SEGMENT_SIZE];
+		if (!owned) {
+			owned = std::make_unique<Segment>();
+			segments_[id / SEGMENT_SIZE].store(owned.get(),
+			                                   std::memory_order_release);
+		}
+		auto& stored = (*owned)[id % SEGMENT_SIZE];
+		stored = name;
+
+		ids_.emplace(stored, static_cast<Id>(id));
+		size_.store(id + 1, std::memory_order_release);
+		return static_cast<Id>(id);
+	}
+
+	std::shared_mutex ids_mutex_;
+	std::unordered_map<std::string_view, Id> ids_;
+	std::array<std::unique_ptr<Segment>, NUM_SEGMENTS> owned_segments_;
+	// Lock-free view of owned_segments_ for readers
+	std::array<std::atomic<Segment*>, NUM_SEGMENTS> segments_{};
+	std::atomic<size_t> size_{0};
+};
+
+}  // namespace
+
+namespace uprotocol::datamodel {
+
+AuthorityInterner::Id AuthorityInterner::intern(std::string_view name) {
+	return Table::instance().intern(name);
+}
+
+std::optional<AuthorityInterner::Id> AuthorityInterner::find(
+    std::string_view name) {
+	return Table::instance().find(name);
+}
+
+std::string_view AuthorityInterner::name(Id id) {
+	return Table::instance().name(id);
+}
+
+size_t AuthorityInterner::size() noexcept { return Table::instance().size(); }
+
+}  // namespace uprotocol::datamodel
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/datamodel/PackedUUri.h"
+
+#include <limits>
+#include <string>
+
+#include "up-cpp/datamodel/validator/UUri.h"
+
+namespace {
+
+// Returns true if the non-authority fields of uri fit in a PackedUUri
+bool fieldsFit(const uprotocol::v1::UUri& uri) {
+	return (uri.ue_version_major() <= std::numeric_limits<uint8_t>::max()) &&
+	       (uri.resource_id() <= std::numeric_limits<uint16_t>::max());
+}
+
+}  // namespace
+
+namespace uprotocol::datamodel {
+
+PackedUUri::PackedUUri(const v1::UUri& uri) {
+	using validator::uri::InvalidUUri;
+
+	if (uri.ue_version_major() > std::numeric_limits<uint8_t>::max()) {
+		throw InvalidUUri(std::string(
+		    message(validator::uri::Reason::VERSION_OVERFLOW)));
+	}
+	if (uri.resource_id() > std::numeric_limits<uint16_t>::max()) {
+		throw InvalidUUri(std::string(
+		    message(validator::uri::Reason::RESOURCE_OVERFLOW)));
+	}
+
+	*this = PackedUUri(AuthorityInterner::intern(uri.authority_name()),
+	                   uri.ue_id(),
+	                   static_cast<uint8_t>(uri.ue_version_major()),
+	                   static_cast<uint16_t>(uri.resource_id()));
+}
+
+std::optional<PackedUUri> PackedUUri::lookup(const v1::UUri& uri) {
+	if (!fieldsFit(uri)) {
+		return std::nullopt;
+	}
+	auto authority = AuthorityInterner::find(uri.authority_name());
+	if (!authority) {
+		return std::nullopt;
+	}
+	return PackedUUri(*authority, uri.ue_id(),
+	                  static_cast<uint8_t>(uri.ue_version_major()),
+	                  static_cast<uint16_t>(uri.resource_id()));
+}
+
+v1::UUri PackedUUri::toUUri() const {
+	v1::UUri uri;
+	const auto authority = authorityName();
+	uri.set_authority_name(authority.data(), authority.size());
+	uri.set_ue_id(ueId());
+	uri.set_ue_version_major(ueVersionMajor());
+	uri.set_resource_id(resourceId());
+	return uri;
+}
+
+}  // namespace uprotocol::datamodel
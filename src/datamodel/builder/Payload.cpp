@@ -10,65 +10,127 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/datamodel/builder/Payload.h"
+
+#include <cstring>
+#include <utility>
+
 namespace uprotocol::datamodel::builder {
 
 // Byte vector constructor
 Payload::Payload(const std::vector<uint8_t>& value_bytes,
-                 const v1::UPayloadFormat format) {
+                 const v1::UPayloadFormat format)
+    : format_(format) {
 	if (!UPayloadFormat_IsValid(format)) {
 		throw std::out_of_range("Invalid Byte vector payload format");
 	}
-	std::string serialized(value_bytes.begin(), value_bytes.end());
-	payload_ = std::make_tuple(std::move(serialized), format);
+	data_ = copyOf({reinterpret_cast<const char*>(value_bytes.data()),
+	                value_bytes.size()});
+}
+
+// Move byte vector constructor
+Payload::Payload(std::vector<uint8_t>&& value_bytes,
+                 const v1::UPayloadFormat format)
+    : format_(format) {
+	if (!UPayloadFormat_IsValid(format)) {
+		throw std::out_of_range("Invalid RValue Byte vector payload format");
+	}
+	data_ = std::move(value_bytes);
+}
+
+// Shared buffer constructor
+Payload::Payload(SharedBuffer buffer, const v1::UPayloadFormat format)
+    : format_(format) {
+	if (!UPayloadFormat_IsValid(format)) {
+		throw std::out_of_range("Invalid Shared buffer payload format");
+	}
+	if (!buffer) {
+		throw std::invalid_argument("Shared buffer payload is null");
+	}
+	data_ = std::move(buffer);
 }
 
+// Fragments constructor
+Payload::Payload(Fragments fragments, const v1::UPayloadFormat format)
+    : format_(format) {
+	if (!UPayloadFormat_IsValid(format)) {
+		throw std::out_of_range("Invalid Fragments payload format");
+	}
+	for (const auto& fragment : fragments) {
+		if (!fragment) {
+			throw std::invalid_argument("Payload fragment is null");
+		}
+	}
+	data_ = std::make_unique<FragmentedBytes>(std::move(fragments));
+}
+
+// Shared memory constructor
+Payload::Payload(const utils::ShmSegment& segment, size_t length,
+                 size_t offset)
+    : data_(segment.describe(length, offset).serialize()),
+      format_(v1::UPayloadFormat::UPAYLOAD_FORMAT_SHM) {}
+
 // String constructor
-Payload::Payload(const std::string& value, const v1::UPayloadFormat format) {
+Payload::Payload(const std::string& value, const v1::UPayloadFormat format)
+    : format_(format) {
 	if (!UPayloadFormat_IsValid(format)) {
 		throw std::out_of_range("Invalid String payload format");
 	}
-	payload_ = std::make_tuple(value, format);
+	data_ = copyOf(value);
 }
 
 // Move string constructor
-Payload::Payload(std::string&& value, const v1::UPayloadFormat format) {
+Payload::Payload(std::string&& value, const v1::UPayloadFormat format)
+    : format_(format) {
 	if (!UPayloadFormat_IsValid(format)) {
 		throw std::out_of_range("Invalid RValue String payload format");
 	}
-	payload_ = std::make_tuple(std::move(value), format);
+	data_ = std::move(value);
 }
 
 // Move Serialized constructor
-Payload::Payload(Serialized&& serialized) {
-	if (!UPayloadFormat_IsValid(std::get<PayloadType::Format>(serialized))) {
+Payload::Payload(Serialized&& serialized)
+    : format_(std::get<PayloadType::Format>(serialized)) {
+	if (!UPayloadFormat_IsValid(format_)) {
 		throw std::out_of_range("Invalid RValue Serialized payload format");
 	}
-	payload_ = std::move(serialized);
+	data_ = std::move(std::get<PayloadType::Data>(serialized));
 }
 
 // google::protobuf::Any constructor
-Payload::Payload(const google::protobuf::Any& any) {
-	payload_ = std::make_tuple(
-	    any.SerializeAsString(),
-	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY);
-}
+Payload::Payload(const google::protobuf::Any& any)
+    : data_(any.SerializeAsString()),
+      format_(v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY) {}
 
 // Move constructor
 Payload::Payload(Payload&& other) noexcept
-    : payload_(std::move(other.payload_)), moved_(other.moved_) {}
-
-// Copy constructor
-Payload::Payload(const Payload& other) = default;
+    : data_(std::exchange(other.data_, std::monostate{})),
+      format_(other.format_) {}
 
 // Move assignment operator
 Payload& Payload::operator=(Payload&& other) noexcept {
-	payload_ = std::move(other.payload_);
-	moved_ = other.moved_;
+	data_ = std::exchange(other.data_, std::monostate{});
+	format_ = other.format_;
 	return *this;
 }
 
-// Copy assignment operator
-Payload& Payload::operator=(const Payload& other) = default;
+Payload::~Payload() = default;
+
+Payload Payload::clone() const {
+	checkNotMoved();
+	Payload copy;
+	copy.format_ = format_;
+	if (const auto* shared = std::get_if<SharedBuffer>(&data_)) {
+		copy.data_ = *shared;
+	} else if (const auto* fragmented =
+	               std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		copy.data_ = std::make_unique<FragmentedBytes>((*fragmented)->parts);
+	} else if (const auto* inline_bytes = std::get_if<InlineBytes>(&data_)) {
+		copy.data_ = *inline_bytes;
+	} else {
+		copy.data_ = copyOf(data());
+	}
+	return copy;
+}
 
 Payload::PayloadMoved::PayloadMoved(PayloadMoved&& other) noexcept
     : std::runtime_error(std::move(other)) {}
@@ -87,22 +149,136 @@ Payload::PayloadMoved::PayloadMoved(const PayloadMoved& other) = default;
 Payload::PayloadMoved& Payload::PayloadMoved::operator=(
     const PayloadMoved& other) = default;
 
+std::string_view Payload::data() const {
+	checkNotMoved();
+	if (const auto* bytes = std::get_if<PbBytes>(&data_)) {
+		return *bytes;
+	}
+	if (const auto* bytes = std::get_if<InlineBytes>(&data_)) {
+		return {bytes->bytes.data(), bytes->size};
+	}
+	if (const auto* bytes = std::get_if<std::vector<uint8_t>>(&data_)) {
+		return {reinterpret_cast<const char*>(bytes->data()), bytes->size()};
+	}
+	if (const auto* fragmented =
+	        std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		return (*fragmented)->joined();
+	}
+	return *std::get<SharedBuffer>(data_);
+}
+
+std::vector<std::string_view> Payload::fragments() const {
+	checkNotMoved();
+	if (const auto* fragmented =
+	        std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		const auto& parts = (*fragmented)->parts;
+		std::vector<std::string_view> views;
+		views.reserve(parts.size());
+		for (const auto& part : parts) {
+			views.emplace_back(*part);
+		}
+		return views;
+	}
+	return {data()};
+}
+
+size_t Payload::size() const {
+	checkNotMoved();
+	if (const auto* fragmented =
+	        std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		size_t total = 0;
+		for (const auto& part : (*fragmented)->parts) {
+			total += part->size();
+		}
+		return total;
+	}
+	return data().size();
+}
+
+v1::UPayloadFormat Payload::format() const {
+	checkNotMoved();
+	return format_;
+}
+
 // buildCopy method
-[[nodiscard]] const Payload::Serialized& Payload::buildCopy() const {
-	if (moved_) {
-		throw PayloadMoved("Payload has been already moved");
+[[nodiscard]] Payload::Serialized Payload::buildCopy() const {
+	checkNotMoved();
+	if (const auto* fragmented =
+	        std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		return {join((*fragmented)->parts), format_};
 	}
-	return payload_;
+	return {PbBytes(data()), format_};
 }
 
 // buildMove method
 [[nodiscard]] Payload::Serialized Payload::buildMove() && {
-	// Check if payload_ is in the "moved" state
-	if (moved_) {
+	checkNotMoved();
+	Serialized serialized;
+	if (auto* bytes = std::get_if<PbBytes>(&data_)) {
+		serialized = {std::move(*bytes), format_};
+	} else if (const auto* fragmented =
+	               std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		serialized = {join((*fragmented)->parts), format_};
+	} else {
+		serialized = {PbBytes(data()), format_};
+	}
+	data_ = std::monostate{};
+	return serialized;
+}
+
+void Payload::buildInto(v1::UMessage& message) && {
+	checkNotMoved();
+	if (auto* bytes = std::get_if<PbBytes>(&data_)) {
+		message.set_payload(std::move(*bytes));
+	} else if (const auto* fragmented =
+	               std::get_if<std::unique_ptr<FragmentedBytes>>(&data_)) {
+		// Gather directly into the message rather than joining first
+		auto* payload = message.mutable_payload();
+		payload->clear();
+		payload->reserve(size());
+		for (const auto& part : (*fragmented)->parts) {
+			payload->append(*part);
+		}
+	} else {
+		auto view = data();
+		message.set_payload(view.data(), view.size());
+	}
+	message.mutable_attributes()->set_payload_format(format_);
+	data_ = std::monostate{};
+}
+
+Payload::Storage Payload::copyOf(std::string_view bytes) {
+	if (bytes.size() <= INLINE_CAPACITY) {
+		InlineBytes inline_bytes{};
+		std::memcpy(inline_bytes.bytes.data(), bytes.data(), bytes.size());
+		inline_bytes.size = static_cast<uint8_t>(bytes.size());
+		return inline_bytes;
+	}
+	return PbBytes(bytes);
+}
+
+Payload::PbBytes Payload::join(const Fragments& parts) {
+	size_t total = 0;
+	for (const auto& part : parts) {
+		total += part->size();
+	}
+	PbBytes joined;
+	joined.reserve(total);
+	for (const auto& part : parts) {
+		joined.append(*part);
+	}
+	return joined;
+}
+
+const Payload::PbBytes& Payload::FragmentedBytes::joined() {
+	std::call_once(join_once_, [this]() { joined_ = join(parts); });
+	return joined_;
+}
+
+void Payload::checkNotMoved() const {
+	if (std::holds_alternative<std::monostate>(data_)) {
 		throw PayloadMoved("Payload has been already moved");
 	}
-	// Set payload_ to the "moved" state
-	moved_ = true;
-	return std::move(payload_);
 }
+
 }  // namespace uprotocol::datamodel::builder
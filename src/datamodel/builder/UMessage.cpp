@@ -13,6 +13,7 @@
 
 #include "up-cpp/datamodel/validator/UUri.h"
 #include "up-cpp/datamodel/validator/Uuid.h"
+#include "up-cpp/utils/Tracing.h"
 
 namespace uprotocol::datamodel::builder {
 namespace UriValidator = validator::uri;
@@ -204,6 +205,12 @@ UMessageBuilder& UMessageBuilder::withPayloadFormat(v1::UPayloadFormat format) {
 	return *this;
 }
 
+UMessageBuilder& UMessageBuilder::withClock(const utils::CoarseClock& clock) {
+	uuidBuilder_.withClock(clock);
+
+	return *this;
+}
+
 v1::UMessage UMessageBuilder::build() const {
 	v1::UMessage message;
 	if (expectedPayloadFormat_.has_value()) {
@@ -214,6 +221,7 @@ v1::UMessage UMessageBuilder::build() const {
 
 	*message.mutable_attributes() = attributes_;
 	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
+	UP_CPP_TRACE(BUILT, message.attributes().id());
 
 	return message;
 }
@@ -229,6 +237,7 @@ v1::UMessage UMessageBuilder::build(const v1::UUri& method) const {
 	*message.mutable_attributes() = attributes_;
 	*message.mutable_attributes()->mutable_sink() = method;
 	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
+	UP_CPP_TRACE(BUILT, message.attributes().id());
 
 	return message;
 }
@@ -238,15 +247,14 @@ v1::UMessage UMessageBuilder::build(builder::Payload&& payload) const {
 
 	*message.mutable_attributes() = attributes_;
 	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
-	auto [payloadData, payloadFormat] = std::move(payload).buildMove();
+	UP_CPP_TRACE(BUILT, message.attributes().id());
 	if (expectedPayloadFormat_.has_value()) {
-		if (payloadFormat != expectedPayloadFormat_) {
+		if (payload.format() != expectedPayloadFormat_) {
 			throw UnexpectedFormat(
 			    "Payload format does not match the expected format");
 		}
 	}
-	*message.mutable_payload() = std::move(payloadData);
-	message.mutable_attributes()->set_payload_format(payloadFormat);
+	std::move(payload).buildInto(message);
 
 	return message;
 }
@@ -258,15 +266,32 @@ v1::UMessage UMessageBuilder::build(const v1::UUri& method,
 	*message.mutable_attributes() = attributes_;
 	*message.mutable_attributes()->mutable_sink() = method;
 	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
-	auto [payloadData, payloadFormat] = std::move(payload).buildMove();
+	UP_CPP_TRACE(BUILT, message.attributes().id());
+	if (expectedPayloadFormat_.has_value()) {
+		if (payload.format() != expectedPayloadFormat_) {
+			throw UnexpectedFormat(
+			    "Payload format does not match the expected format");
+		}
+	}
+	std::move(payload).buildInto(message);
+
+	return message;
+}
+
+v1::UMessage UMessageBuilder::buildAttributesFor(
+    const builder::Payload& payload) const {
+	v1::UMessage message;
+
+	*message.mutable_attributes() = attributes_;
+	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
+	UP_CPP_TRACE(BUILT, message.attributes().id());
 	if (expectedPayloadFormat_.has_value()) {
-		if (payloadFormat != expectedPayloadFormat_) {
+		if (payload.format() != expectedPayloadFormat_) {
 			throw UnexpectedFormat(
 			    "Payload format does not match the expected format");
 		}
 	}
-	*message.mutable_payload() = std::move(payloadData);
-	message.mutable_attributes()->set_payload_format(payloadFormat);
+	message.mutable_attributes()->set_payload_format(payload.format());
 
 	return message;
 }
@@ -48,9 +48,21 @@ UuidBuilder& UuidBuilder::withRandomSource(
 	return *this;
 }
 
+UuidBuilder& UuidBuilder::withClock(const utils::CoarseClock& clock) {
+	clock_ = &clock;
+	return *this;
+}
+
 v1::UUID UuidBuilder::build() {
 	v1::UUID uuid;
-	auto now = time_source_ ? time_source_() : std::chrono::system_clock::now();
+	std::chrono::system_clock::time_point now;
+	if (time_source_) {
+		now = time_source_();
+	} else if (clock_ != nullptr) {
+		now = clock_->now();
+	} else {
+		now = std::chrono::system_clock::now();
+	}
 	auto unix_ts_ms =
 	    std::chrono::time_point_cast<std::chrono::milliseconds>(now);
 	std::mt19937_64 gen{std::random_device{}()};
@@ -10,16 +10,76 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "up-cpp/datamodel/serializer/UUri.h"
 
+#include <algorithm>
 #include <charconv>
-#include <sstream>
+#include <optional>
+#include <string_view>
 
 #include "up-cpp/datamodel/validator/UUri.h"
 
-namespace uprotocol::datamodel::serializer::uri {
+namespace {
 
-std::string AsString::serialize(const v1::UUri& uri) {
+constexpr std::string_view REMOTE_PREFIX = "//";
+constexpr char SEGMENT_SEPARATOR = '/';
+constexpr int HEX_BASE = 16;
+constexpr size_t BITS_PER_HEX_DIGIT = 4;
+
+// Number of hex digits std::to_chars will produce for value
+constexpr size_t hexLength(uint32_t value) {
+	size_t digits = 1;
+	while ((value >>= BITS_PER_HEX_DIGIT) != 0) {
+		++digits;
+	}
+	return digits;
+}
+
+static_assert(hexLength(0) == 1);
+static_assert(hexLength(0xF) == 1);
+static_assert(hexLength(0x10) == 2);
+static_assert(hexLength(0xFFFFFFFF) == 8);
+
+// Exact number of characters encode() will write for uri
+size_t serializedLength(const uprotocol::v1::UUri& uri) {
+	size_t length = 0;
+	if (!uri.authority_name().empty()) {
+		length += REMOTE_PREFIX.size() + uri.authority_name().size();
+	}
+	// One separator before each of the three numeric fields
+	length += 3 + hexLength(uri.ue_id()) + hexLength(uri.ue_version_major()) +
+	          hexLength(uri.resource_id());
+	return length;
+}
+
+// Writes one '/'-prefixed, uppercase hex field and returns the new end
+char* writeHexField(char* out, char* end, uint32_t value) {
+	*out++ = SEGMENT_SEPARATOR;
+	auto* const digits = out;
+	out = std::to_chars(out, end, value, HEX_BASE).ptr;
+	// to_chars only produces lowercase letters
+	for (auto* digit = digits; digit != out; ++digit) {
+		if (*digit >= 'a') {
+			*digit = static_cast<char>(*digit - 'a' + 'A');
+		}
+	}
+	return out;
+}
+
+// Writes exactly serializedLength(uri) characters to out
+void encode(const uprotocol::v1::UUri& uri, char* out, size_t length) {
+	auto* const end = out + length;
+	const auto& authority = uri.authority_name();
+	if (!authority.empty()) {
+		out = std::copy(REMOTE_PREFIX.begin(), REMOTE_PREFIX.end(), out);
+		out = std::copy(authority.begin(), authority.end(), out);
+	}
+	out = writeHexField(out, end, uri.ue_id());
+	out = writeHexField(out, end, uri.ue_version_major());
+	writeHexField(out, end, uri.resource_id());
+}
+
+// Throws if uri cannot be serialized, otherwise returns its serialized length
+size_t checkedLength(const uprotocol::v1::UUri& uri) {
 	using uprotocol::datamodel::validator::uri::InvalidUUri;
-	using uprotocol::datamodel::validator::uri::isLocal;
 	using uprotocol::datamodel::validator::uri::isValidFilter;
 
 	// isValidFilter is the most permissive of the validators
@@ -28,87 +88,127 @@ std::string AsString::serialize(const v1::UUri& uri) {
 		throw InvalidUUri("Invalid UUri For Serialization | " +
 		                  std::string(message(*reason)));
 	}
-	std::stringstream ss;
-	ss << std::hex << std::uppercase;
-
-	if (!isLocal(uri)) {
-		ss << "//" << uri.authority_name();
-	}
-	ss << "/" << uri.ue_id() << "/" << uri.ue_version_major() << "/"
-	   << uri.resource_id();
-
-	return std::move(ss).str();
+	return serializedLength(uri);
 }
 
-std::string_view extractSegment(std::string_view& uri_view) {
-	constexpr std::string_view SEGMENT_SEPARATOR = "/";
+using uprotocol::datamodel::serializer::uri::ParseError;
+
+// Splits the leading segment off of uri_view, advancing it past the separator
+std::optional<std::string_view> extractSegment(std::string_view& uri_view) {
 	const auto end = uri_view.find(SEGMENT_SEPARATOR);
 	if (end == std::string_view::npos) {
-		throw std::invalid_argument("Could not extract segment from '" +
-		                            std::string(uri_view) +
-		                            "' with separator '" + "/" + "'");
+		return std::nullopt;
 	}
 	auto segment = uri_view.substr(0, end);
-	uri_view = uri_view.substr(end + 1);
+	uri_view.remove_prefix(end + 1);
 	return segment;
 }
 
-uint32_t segmentToUint32(const std::string_view& segment) {
+std::optional<uint32_t> segmentToUint32(std::string_view segment) {
 	uint32_t value = 0;
-	constexpr auto HEX_BASE = 16;
-	auto [end, ec] = std::from_chars(
-	    segment.data(), segment.data() + segment.size(), value, HEX_BASE);
-	const bool convert_ok =
-	    (ec == std::errc{}) && (end == segment.data() + segment.size());
-	if (!convert_ok) {
-		throw std::invalid_argument("Failed to convert segment to number: " +
-		                            std::string(segment));
+	const auto* const end = segment.data() + segment.size();
+	auto [ptr, ec] = std::from_chars(segment.data(), end, value, HEX_BASE);
+	if ((ec != std::errc{}) || (ptr != end)) {
+		return std::nullopt;
 	}
 	return value;
 }
 
-uprotocol::v1::UUri AsString::deserialize(const std::string& uri_as_string) {
-	if (uri_as_string.empty()) {
-		throw std::invalid_argument("Cannot deserialize empty string");
-	}
-
+// Fills uri from its string form without validating the resulting UUri
+std::optional<ParseError> parse(std::string_view uri_view,
+                                uprotocol::v1::UUri& uri) {
 	constexpr std::string_view SCHEMA_PREFIX = "up://";
-	constexpr std::string_view REMOTE_PREFIX = "//";
-	constexpr std::string_view SEGMENT_SEPARATOR = "/";
 
-	// Operating on a string view to avoid copies and reallocations
-	std::string_view uri_view(uri_as_string);
-
-	// Extract and convert the rest of the URI string
-	v1::UUri uri;
+	if (uri_view.empty()) {
+		return ParseError::EMPTY_STRING;
+	}
 
 	// Verify start and extract Authority, if present
-	// With up:// schema
+	bool is_remote = true;
 	if (uri_view.substr(0, SCHEMA_PREFIX.size()) == SCHEMA_PREFIX) {
-		// Advance past the prefix
-		uri_view = uri_view.substr(SCHEMA_PREFIX.size());
-		uri.set_authority_name(std::string(extractSegment(uri_view)));
-		// with // remote prefix
+		uri_view.remove_prefix(SCHEMA_PREFIX.size());
 	} else if (uri_view.substr(0, REMOTE_PREFIX.size()) == REMOTE_PREFIX) {
-		// Advance past the prefix
-		uri_view = uri_view.substr(REMOTE_PREFIX.size());
-		uri.set_authority_name(std::string(extractSegment(uri_view)));
+		uri_view.remove_prefix(REMOTE_PREFIX.size());
+	} else if (uri_view.front() == SEGMENT_SEPARATOR) {
+		uri_view.remove_prefix(1);
+		is_remote = false;
+	} else {
+		return ParseError::BAD_PREFIX;
+	}
+
+	if (is_remote) {
+		auto authority = extractSegment(uri_view);
+		if (!authority) {
+			return ParseError::MISSING_SEGMENT;
+		}
+		uri.set_authority_name(authority->data(), authority->size());
+	}
 
-		// with / local prefix
-	} else if (uri_view.substr(0, SEGMENT_SEPARATOR.size()) ==
-	           SEGMENT_SEPARATOR) {
-		// Advance past the prefix
-		uri_view = uri_view.substr(SEGMENT_SEPARATOR.size());
+	auto ue_id = extractSegment(uri_view);
+	auto ue_version_major = extractSegment(uri_view);
+	if (!ue_id || !ue_version_major) {
+		return ParseError::MISSING_SEGMENT;
+	}
 
-		// Missing required prefix
-	} else {
-		throw std::invalid_argument(
-		    "Did not find expected URI start in string: '" +
-		    std::string(uri_view) + "'");
+	auto ue_id_value = segmentToUint32(*ue_id);
+	auto ue_version_major_value = segmentToUint32(*ue_version_major);
+	auto resource_id_value = segmentToUint32(uri_view);
+	if (!ue_id_value || !ue_version_major_value || !resource_id_value) {
+		return ParseError::BAD_NUMBER;
+	}
+
+	uri.set_ue_id(*ue_id_value);
+	uri.set_ue_version_major(*ue_version_major_value);
+	uri.set_resource_id(*resource_id_value);
+	return std::nullopt;
+}
+
+}  // namespace
+
+namespace uprotocol::datamodel::serializer::uri {
+
+std::string_view message(ParseError error) {
+	switch (error) {
+		case ParseError::EMPTY_STRING:
+			return "Cannot deserialize empty string";
+		case ParseError::BAD_PREFIX:
+			return "Did not find expected URI start ('up://', '//', or '/')";
+		case ParseError::MISSING_SEGMENT:
+			return "URI is missing one or more '/'-separated segments";
+		case ParseError::BAD_NUMBER:
+			return "URI segment is not a valid hexadecimal uint32";
+		case ParseError::INVALID_URI:
+			return "URI is not a valid filter";
+		default:
+			return "Unknown reason";
+	}
+}
+
+std::string AsString::serialize(const v1::UUri& uri) {
+	std::string str;
+	serialize(uri, str);
+	return str;
+}
+
+size_t AsString::serialize(const v1::UUri& uri, Buffer& out) {
+	const auto length = checkedLength(uri);
+	encode(uri, out.data(), length);
+	return length;
+}
+
+void AsString::serialize(const v1::UUri& uri, std::string& out) {
+	const auto length = checkedLength(uri);
+	out.resize(length);
+	encode(uri, out.data(), length);
+}
+
+uprotocol::v1::UUri AsString::deserialize(const std::string& uri_as_string) {
+	v1::UUri uri;
+	if (auto error = parse(uri_as_string, uri)) {
+		throw std::invalid_argument("Failed to deserialize UUri '" +
+		                            uri_as_string +
+		                            "': " + std::string(message(*error)));
 	}
-	uri.set_ue_id(segmentToUint32(extractSegment(uri_view)));
-	uri.set_ue_version_major(segmentToUint32(extractSegment(uri_view)));
-	uri.set_resource_id(segmentToUint32(uri_view));
 
 	{
 		using uprotocol::datamodel::validator::uri::InvalidUUri;
@@ -122,4 +222,20 @@ uprotocol::v1::UUri AsString::deserialize(const std::string& uri_as_string) {
 	}
 	return uri;
 }
+
+UUriOrError AsString::tryDeserialize(std::string_view uri_as_string) {
+	v1::UUri uri;
+	if (auto error = parse(uri_as_string, uri)) {
+		return UUriOrError(utils::Unexpected<ParseError>(*error));
+	}
+
+	// isValidFilter is the most permissive of the validators
+	auto [valid, reason] = validator::uri::isValidFilter(uri);
+	if (!valid) {
+		return UUriOrError(
+		    utils::Unexpected<ParseError>(ParseError::INVALID_URI));
+	}
+	return UUriOrError(std::move(uri));
+}
+
 }  // namespace uprotocol::datamodel::serializer::uri
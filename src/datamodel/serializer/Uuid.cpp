@@ -11,55 +11,161 @@
 
 #include "up-cpp/datamodel/serializer/Uuid.h"
 
-#include <arpa/inet.h>
-
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
 
 #include "up-cpp/datamodel/constants/UuidConstants.h"
 
 namespace {
-constexpr uint64_t RANDOM_B_SHIFT = 48;
-constexpr size_t MSB_HIGH = 0;
-constexpr size_t MSB_LOW = 4;
-constexpr size_t LSB_HIGH = 8;
-constexpr size_t LSB_LOW = 12;
+using uprotocol::datamodel::LEN_HEX_TO_BIT;
+using uprotocol::datamodel::POS_FIRST_SEPARATOR;
+using uprotocol::datamodel::POS_FOURTH_SEPARATOR;
+using uprotocol::datamodel::POS_SECOND_SEPARATOR;
+using uprotocol::datamodel::POS_THIRD_SEPARATOR;
+using uprotocol::datamodel::TOTAL_UUID_LENGTH;
+using uprotocol::datamodel::UUID_BYTE_SIZE;
+
+constexpr size_t BYTES_PER_HALF = UUID_BYTE_SIZE / 2;
+constexpr size_t BITS_PER_BYTE = 8;
+constexpr size_t BYTE_VALUES = 256;
+constexpr uint8_t NIBBLE_MASK = 0xF;
+constexpr int8_t NOT_HEX = -1;
+
+// Offset of the first hex digit of each UUID byte (most significant byte
+// first) within the string form:
+//
+// Format  : 12345678-1234-1234-1234-123456789ABC
+// Index   : 012345678901234567890123456789012345
+constexpr std::array<uint8_t, UUID_BYTE_SIZE> BYTE_OFFSETS = {
+    0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+constexpr std::array<size_t, 4> SEPARATOR_OFFSETS = {
+    POS_FIRST_SEPARATOR, POS_SECOND_SEPARATOR, POS_THIRD_SEPARATOR,
+    POS_FOURTH_SEPARATOR};
+
+// Lowercase two-digit hex representation of every byte value
+constexpr auto HEX_PAIRS = []() {
+	constexpr std::string_view DIGITS = "0123456789abcdef";
+	std::array<std::array<char, 2>, BYTE_VALUES> pairs{};
+	for (size_t value = 0; value < BYTE_VALUES; ++value) {
+		pairs[value][0] = DIGITS[value >> LEN_HEX_TO_BIT];
+		pairs[value][1] = DIGITS[value & NIBBLE_MASK];
+	}
+	return pairs;
+}();
+
+// Numeric value of every character that is a hex digit, NOT_HEX otherwise
+constexpr auto HEX_VALUES = []() {
+	std::array<int8_t, BYTE_VALUES> values{};
+	for (auto& value : values) {
+		value = NOT_HEX;
+	}
+	constexpr int8_t DECIMAL_DIGITS = 10;
+	constexpr int8_t LETTER_DIGITS = 6;
+	for (int8_t i = 0; i < DECIMAL_DIGITS; ++i) {
+		values[static_cast<uint8_t>('0' + i)] = i;
+	}
+	for (int8_t i = 0; i < LETTER_DIGITS; ++i) {
+		values[static_cast<uint8_t>('a' + i)] =
+		    static_cast<int8_t>(DECIMAL_DIGITS + i);
+		values[static_cast<uint8_t>('A' + i)] =
+		    static_cast<int8_t>(DECIMAL_DIGITS + i);
+	}
+	return values;
+}();
+
+static_assert(uprotocol::datamodel::serializer::uuid::AsString::LENGTH ==
+                  TOTAL_UUID_LENGTH,
+              "AsString::LENGTH must match the UUID string constants");
+static_assert(uprotocol::datamodel::serializer::uuid::AsBytes::LENGTH ==
+                  UUID_BYTE_SIZE,
+              "AsBytes::LENGTH must match the UUID byte constants");
+
+// Writes value to out[0..7] most significant byte first. Being plain shifts,
+// this is independent of host byte order and compilers reduce it to a single
+// byte-swapping store where one is available.
+constexpr void storeBigEndian(uint64_t value, uint8_t* out) {
+	for (size_t i = 0; i < BYTES_PER_HALF; ++i) {
+		out[i] = static_cast<uint8_t>(
+		    value >> ((BYTES_PER_HALF - 1 - i) * BITS_PER_BYTE));
+	}
+}
+
+// Reads a uint64_t from in[0..7], most significant byte first
+constexpr uint64_t loadBigEndian(const uint8_t* in) {
+	uint64_t value = 0;
+	for (size_t i = 0; i < BYTES_PER_HALF; ++i) {
+		value = (value << BITS_PER_BYTE) | in[i];
+	}
+	return value;
+}
+
+static_assert(loadBigEndian(std::array<uint8_t, BYTES_PER_HALF>{
+                                0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF}
+                                .data()) == 0x0123456789ABCDEF,
+              "loadBigEndian must read the most significant byte first");
+
+// Writes exactly UUID_BYTE_SIZE bytes to out
+void encodeBytes(const uprotocol::v1::UUID& uuid, uint8_t* out) {
+	storeBigEndian(uuid.msb(), out);
+	storeBigEndian(uuid.lsb(), out + BYTES_PER_HALF);
+}
+
+// Writes exactly TOTAL_UUID_LENGTH characters to out
+void encode(const uprotocol::v1::UUID& uuid, char* out) {
+	for (size_t i = 0; i < UUID_BYTE_SIZE; ++i) {
+		const uint64_t half = (i < BYTES_PER_HALF) ? uuid.msb() : uuid.lsb();
+		const auto shift =
+		    (BYTES_PER_HALF - 1 - (i % BYTES_PER_HALF)) * BITS_PER_BYTE;
+		const auto& pair = HEX_PAIRS[(half >> shift) & 0xFF];
+		out[BYTE_OFFSETS[i]] = pair[0];
+		out[BYTE_OFFSETS[i] + 1] = pair[1];
+	}
+	for (auto offset : SEPARATOR_OFFSETS) {
+		out[offset] = '-';
+	}
+}
+
 }  // namespace
 
 namespace uprotocol::datamodel::serializer::uuid {
 
+std::string_view message(ParseError error) {
+	switch (error) {
+		case ParseError::WRONG_LENGTH:
+			return "Input is not the length of a serialized UUID";
+		case ParseError::BAD_SEPARATOR:
+			return "UUID separator is missing or misplaced";
+		case ParseError::BAD_HEX_DIGIT:
+			return "UUID contains a character that is not a hex digit";
+		default:
+			return "Unknown reason";
+	}
+}
+
 std::string AsString::serialize(const uprotocol::v1::UUID& uuid) {
-	// Extracting the parts of the UUIDv7
-	uint64_t unix_ts_ms =
-	    (uuid.msb() >> UUID_TIMESTAMP_SHIFT) & UUID_TIMESTAMP_MASK;
-	uint8_t ver = (uuid.msb() >> UUID_VERSION_SHIFT) & UUID_VERSION_MASK;
-	uint16_t rand_a = uuid.msb() & UUID_RANDOM_A_MASK;
-	uint8_t var = (uuid.lsb() >> UUID_VARIANT_SHIFT) & UUID_VARIANT_MASK;
-	uint64_t rand_b = uuid.lsb() & UUID_RANDOM_B_MASK;
-
-	// Formatting the UUIDv8 in the traditional format
-	std::stringstream ss;
-	ss << std::hex << std::setfill('0') << std::setw(LEN_32_BITS_IN_HEX)
-	   << ((unix_ts_ms >> LEN_LSB_IN_HEX * LEN_HEX_TO_BIT) &
-	       MASK_32_BITS)  // First 32 bits of timestamp
-	   << "-" << std::setw(LEN_16_BITS_IN_HEX)
-	   << ((unix_ts_ms)&MASK_16_BITS)  // Next 16 bits of timestamp i.e. last 16
-	                                   // bits of ts
-	   << "-" << std::setw(LEN_16_BITS_IN_HEX)
-	   << (((ver & UUID_VERSION_MASK) << UUID_VERSION_SHIFT) |
-	       (rand_a &
-	        UUID_RANDOM_A_MASK))  // Last 16 bits of timestamp and version
-	   << "-" << std::setw(LEN_16_BITS_IN_HEX)
-	   << (((var & UUID_VARIANT_MASK) << (LEN_HEX_TO_BIT * 3 + 2)) |
-	       ((rand_b >> RANDOM_B_SHIFT) & MASK_14_BITS))  // Variant and randb
-	   << "-" << std::setw(LEN_48_BITS_IN_HEX)
-	   << (rand_b & UUID_TIMESTAMP_MASK);  // Random number
-
-	return std::move(ss).str();
+	std::string str;
+	serialize(uuid, str);
+	return str;
+}
+
+void AsString::serialize(const v1::UUID& uuid, Buffer& out) {
+	encode(uuid, out.data());
+}
+
+void AsString::serialize(const v1::UUID& uuid, std::string& out) {
+	out.resize(LENGTH);
+	encode(uuid, out.data());
 }
 
 uprotocol::v1::UUID AsString::deserialize(const std::string& str) {
+	auto maybe_uuid = tryDeserialize(str);
+	if (!maybe_uuid) {
+		throw std::invalid_argument("Invalid UUID string format");
+	}
+	return std::move(maybe_uuid).value();
+}
+
+UuidOrError AsString::tryDeserialize(std::string_view str) {
 	// Check if the UUID string is in the correct format
 	// Format  : 12345678-1234-1234-1234-123456789ABC
 	// Index   : 012345678901234567890123456789012345
@@ -72,101 +178,80 @@ uprotocol::v1::UUID AsString::deserialize(const std::string& str) {
 	// RAND - random (62 bits)
 	// Please check UP-spec for UUID formatting:
 	// https://github.com/eclipse-uprotocol/up-spec/blob/main/basics/uuid.adoc
-
-	if (str.length() != TOTAL_UUID_LENGTH || str[POS_FIRST_SEPARATOR] != '-' ||
-	    str[POS_SECOND_SEPARATOR] != '-' || str[POS_THIRD_SEPARATOR] != '-' ||
-	    str[POS_FOURTH_SEPARATOR] != '-') {
-		throw std::invalid_argument("Invalid UUID string format");
+	if (str.size() != LENGTH) {
+		return UuidOrError(
+		    utils::Unexpected<ParseError>(ParseError::WRONG_LENGTH));
 	}
 
-	uprotocol::v1::UUID uuid;
-	uint64_t unix_ts_ms = 0;
-	uint8_t ver = 0;
-	uint16_t rand_a = 0;
-	uint8_t var = 0;
-	uint64_t rand_b = 0;
-
-	try {
-		// Extract the parts from the UUID string
-		unix_ts_ms =
-		    std::stoull(str.substr(0, LEN_MSB_IN_HEX), nullptr, HEX_BASE)
-		    << LEN_LSB_IN_HEX * LEN_HEX_TO_BIT;
-		unix_ts_ms |=
-		    std::stoull(str.substr(POS_FIRST_SEPARATOR + 1, LEN_LSB_IN_HEX),
-		                nullptr, HEX_BASE);
-
-		uint16_t msb_low = static_cast<uint16_t>(
-		    std::stoul(str.substr(POS_SECOND_SEPARATOR + 1, LEN_VCANT_IN_HEX),
-		               nullptr, HEX_BASE));
-		ver = (msb_low >> LEN_HEX_TO_BIT * 3) & UUID_VERSION_MASK;
-		rand_a = msb_low & UUID_RANDOM_A_MASK;
-
-		uint16_t var_randb = static_cast<uint16_t>(
-		    std::stoul(str.substr(POS_THIRD_SEPARATOR + 1, LEN_VARR_IN_HEX),
-		               nullptr, HEX_BASE));
-		var = (var_randb >> (LEN_HEX_TO_BIT * 3 + 2)) & UUID_VARIANT_MASK;
-		rand_b = static_cast<uint64_t>(var_randb & MASK_14_BITS)
-		         << RANDOM_B_SHIFT;
-		rand_b |= std::stoull(str.substr(POS_FOURTH_SEPARATOR + 1), nullptr,
-		                      HEX_BASE);
-	} catch (const std::exception& e) {
-		throw std::invalid_argument("Invalid UUID string format");
+	for (auto offset : SEPARATOR_OFFSETS) {
+		if (str[offset] != '-') {
+			return UuidOrError(
+			    utils::Unexpected<ParseError>(ParseError::BAD_SEPARATOR));
+		}
 	}
 
-	// Reconstruct the UUID
-	uuid.set_msb((unix_ts_ms << UUID_TIMESTAMP_SHIFT) |
-	             ((static_cast<uint64_t>(ver) << UUID_VERSION_SHIFT)) | rand_a);
-	uuid.set_lsb((static_cast<uint64_t>(var) << UUID_VARIANT_SHIFT) | rand_b);
+	uint64_t msb = 0;
+	uint64_t lsb = 0;
+	for (size_t i = 0; i < UUID_BYTE_SIZE; ++i) {
+		const auto high =
+		    HEX_VALUES[static_cast<uint8_t>(str[BYTE_OFFSETS[i]])];
+		const auto low =
+		    HEX_VALUES[static_cast<uint8_t>(str[BYTE_OFFSETS[i] + 1])];
+		if ((high == NOT_HEX) || (low == NOT_HEX)) {
+			return UuidOrError(
+			    utils::Unexpected<ParseError>(ParseError::BAD_HEX_DIGIT));
+		}
+
+		auto& half = (i < BYTES_PER_HALF) ? msb : lsb;
+		half = (half << BITS_PER_BYTE) |
+		       static_cast<uint64_t>((high << LEN_HEX_TO_BIT) | low);
+	}
 
-	return uuid;
+	v1::UUID uuid;
+	uuid.set_msb(msb);
+	uuid.set_lsb(lsb);
+	return UuidOrError(std::move(uuid));
 }
 
-// Serialization function
 std::vector<uint8_t> AsBytes::serialize(const v1::UUID& uuid) {
-	std::vector<uint8_t> bytes(UUID_BYTE_SIZE);
-
-	uint32_t msb_high =
-	    htonl(static_cast<uint32_t>(uuid.msb() >> LEN_UINT64_IN_BIT / 2));
-	uint32_t msb_low = htonl(static_cast<uint32_t>(uuid.msb() & MASK_32_BITS));
-	uint32_t lsb_high =
-	    htonl(static_cast<uint32_t>(uuid.lsb() >> LEN_UINT64_IN_BIT / 2));
-	uint32_t lsb_low = htonl(static_cast<uint32_t>(uuid.lsb() & MASK_32_BITS));
+	std::vector<uint8_t> bytes(LENGTH);
+	encodeBytes(uuid, bytes.data());
+	return bytes;
+}
 
-	std::memcpy(&bytes[MSB_HIGH], &msb_high, UUID_PART_SIZE);
-	std::memcpy(&bytes[MSB_LOW], &msb_low, UUID_PART_SIZE);
-	std::memcpy(&bytes[LSB_HIGH], &lsb_high, UUID_PART_SIZE);
-	std::memcpy(&bytes[LSB_LOW], &lsb_low, UUID_PART_SIZE);
+void AsBytes::serialize(const v1::UUID& uuid, Buffer& out) {
+	encodeBytes(uuid, out.data());
+}
 
-	return bytes;
+void AsBytes::serialize(const v1::UUID& uuid, utils::Span<uint8_t> out) {
+	if (out.size() < LENGTH) {
+		throw std::invalid_argument("UUID byte buffer is too small");
+	}
+	encodeBytes(uuid, out.data());
 }
 
 v1::UUID AsBytes::deserialize(const std::vector<uint8_t>& bytes) {
-	if (bytes.size() != UUID_BYTE_SIZE) {
+	return deserialize(utils::Span<const uint8_t>(bytes));
+}
+
+v1::UUID AsBytes::deserialize(utils::Span<const uint8_t> bytes) {
+	auto maybe_uuid = tryDeserialize(bytes);
+	if (!maybe_uuid) {
 		throw std::invalid_argument("Invalid UUID byte array size");
 	}
+	return std::move(maybe_uuid).value();
+}
 
-	uint32_t msb_high = 0;
-	uint32_t msb_low = 0;
-	uint32_t lsb_high = 0;
-	uint32_t lsb_low = 0;
-
-	std::memcpy(&msb_high, &bytes[MSB_HIGH], UUID_PART_SIZE);
-	std::memcpy(&msb_low, &bytes[MSB_LOW], UUID_PART_SIZE);
-	std::memcpy(&lsb_high, &bytes[LSB_HIGH], UUID_PART_SIZE);
-	std::memcpy(&lsb_low, &bytes[LSB_LOW], UUID_PART_SIZE);
-
-	uint64_t msb =
-	    (static_cast<uint64_t>(ntohl(msb_high)) << LEN_UINT64_IN_BIT / 2) |
-	    ntohl(msb_low);
-	uint64_t lsb =
-	    (static_cast<uint64_t>(ntohl(lsb_high)) << LEN_UINT64_IN_BIT / 2) |
-	    ntohl(lsb_low);
+UuidOrError AsBytes::tryDeserialize(utils::Span<const uint8_t> bytes) {
+	if (bytes.size() != LENGTH) {
+		return UuidOrError(
+		    utils::Unexpected<ParseError>(ParseError::WRONG_LENGTH));
+	}
 
 	v1::UUID uuid;
-	uuid.set_msb(msb);
-	uuid.set_lsb(lsb);
-
-	return uuid;
+	uuid.set_msb(loadBigEndian(bytes.data()));
+	uuid.set_lsb(loadBigEndian(bytes.data() + BYTES_PER_HALF));
+	return UuidOrError(std::move(uuid));
 }
 
 }  // namespace uprotocol::datamodel::serializer::uuid
@@ -13,13 +13,265 @@
 
 #include <google/protobuf/util/message_differencer.h>
 
+#include <bitset>
+#include <climits>
+#include <stdexcept>
+
 #include "up-cpp/datamodel/validator/UUri.h"
 #include "up-cpp/datamodel/validator/Uuid.h"
 
-namespace uprotocol::datamodel::validator::message {
+namespace {
 
+namespace message = uprotocol::datamodel::validator::message;
+namespace uri = uprotocol::datamodel::validator::uri;
+namespace uuid = uprotocol::datamodel::validator::uuid;
+using message::Reason;
+using uprotocol::v1::UAttributes;
+using uprotocol::v1::UMessageType;
 using uprotocol::v1::UPRIORITY_CS4;
 
+// Everything a rule needs to evaluate one message. The clock is read once by
+// the caller so that every TTL check in a pass sees the same time.
+struct Context {
+	const UAttributes& attributes;
+	std::chrono::system_clock::time_point now;
+};
+
+// A single check and the reason reported when it fails
+template <bool (*Passes)(const Context&), Reason FailureReason>
+struct Rule {
+	static bool passes(const Context& context) { return Passes(context); }
+	static constexpr Reason REASON = FailureReason;
+};
+
+// An ordered list of Rules. Tables are types rather than arrays of function
+// pointers so that every check can be inlined into a single pass.
+template <typename... Rules>
+struct RuleTable {
+	static std::optional<Reason> firstFailure(const Context& context) {
+		std::optional<Reason> failure;
+		// Stops at the first rule that does not pass
+		static_cast<void>((... && (Rules::passes(context) ||
+		                           (failure = Rules::REASON, false))));
+		return failure;
+	}
+
+	static void collectFailures(const Context& context,
+	                            message::ReasonSet& failures) {
+		(..., (Rules::passes(context) ? void()
+		                              : failures.insert(Rules::REASON)));
+	}
+};
+
+bool isNotExpired(const uprotocol::v1::UUID& uuid, const Context& context) {
+	if (!context.attributes.has_ttl() || (context.attributes.ttl() == 0)) {
+		return true;
+	}
+	auto [expired, reason] = uuid::isExpired(
+	    uuid, std::chrono::milliseconds(context.attributes.ttl()),
+	    context.now);
+	return !expired;
+}
+
+bool idIsUuid(const Context& context) {
+	return std::get<0>(uuid::isUuid(context.attributes.id(), context.now));
+}
+
+bool idIsNotExpired(const Context& context) {
+	return isNotExpired(context.attributes.id(), context);
+}
+
+bool priorityInRange(const Context& context) {
+	return UPriority_IsValid(context.attributes.priority());
+}
+
+bool payloadFormatInRange(const Context& context) {
+	return UPayloadFormat_IsValid(context.attributes.payload_format());
+}
+
+template <UMessageType Type>
+bool isType(const Context& context) {
+	return context.attributes.type() == Type;
+}
+
+bool hasSource(const Context& context) {
+	return context.attributes.has_source();
+}
+
+bool hasSink(const Context& context) { return context.attributes.has_sink(); }
+
+bool sourceIsRpcMethod(const Context& context) {
+	return std::get<0>(uri::isValidRpcMethod(context.attributes.source()));
+}
+
+bool sourceIsRpcResponse(const Context& context) {
+	return std::get<0>(uri::isValidRpcResponse(context.attributes.source()));
+}
+
+bool sourceIsPublishTopic(const Context& context) {
+	return std::get<0>(uri::isValidPublishTopic(context.attributes.source()));
+}
+
+bool sourceIsNotificationSource(const Context& context) {
+	return std::get<0>(
+	    uri::isValidNotificationSource(context.attributes.source()));
+}
+
+bool sinkIsRpcMethod(const Context& context) {
+	return std::get<0>(uri::isValidRpcMethod(context.attributes.sink()));
+}
+
+bool sinkIsRpcResponse(const Context& context) {
+	return std::get<0>(uri::isValidRpcResponse(context.attributes.sink()));
+}
+
+bool sinkIsNotificationSink(const Context& context) {
+	return std::get<0>(uri::isValidNotificationSink(context.attributes.sink()));
+}
+
+bool priorityAtLeastCs4(const Context& context) {
+	return context.attributes.priority() >= UPRIORITY_CS4;
+}
+
+bool ttlIsNonZero(const Context& context) {
+	return context.attributes.has_ttl() && (context.attributes.ttl() != 0);
+}
+
+bool hasReqid(const Context& context) {
+	return context.attributes.has_reqid();
+}
+
+bool reqidIsUuid(const Context& context) {
+	return std::get<0>(uuid::isUuid(context.attributes.reqid(), context.now));
+}
+
+bool reqidIsNotExpired(const Context& context) {
+	return isNotExpired(context.attributes.reqid(), context);
+}
+
+bool noSink(const Context& context) { return !context.attributes.has_sink(); }
+
+bool noCommstatus(const Context& context) {
+	return !context.attributes.has_commstatus();
+}
+
+bool noReqid(const Context& context) {
+	return !context.attributes.has_reqid();
+}
+
+bool noPermissionLevel(const Context& context) {
+	return !context.attributes.has_permission_level();
+}
+
+bool noToken(const Context& context) {
+	return !context.attributes.has_token();
+}
+
+// Each table lists its checks in the order the first failure is reported.
+// Each URI is classified by exactly one rule in a table.
+using CommonRules =
+    RuleTable<Rule<idIsUuid, Reason::BAD_ID>,
+              Rule<idIsNotExpired, Reason::ID_EXPIRED>,
+              Rule<priorityInRange, Reason::PRIORITY_OUT_OF_RANGE>,
+              Rule<payloadFormatInRange, Reason::PAYLOAD_FORMAT_OUT_OF_RANGE>>;
+
+using RequestRules =
+    RuleTable<Rule<isType<UMessageType::UMESSAGE_TYPE_REQUEST>,
+                   Reason::WRONG_MESSAGE_TYPE>,
+              Rule<hasSource, Reason::BAD_SOURCE_URI>,
+              Rule<hasSink, Reason::BAD_SINK_URI>,
+              Rule<sourceIsRpcResponse, Reason::BAD_SOURCE_URI>,
+              Rule<sinkIsRpcMethod, Reason::BAD_SINK_URI>,
+              Rule<priorityAtLeastCs4, Reason::PRIORITY_OUT_OF_RANGE>,
+              Rule<ttlIsNonZero, Reason::INVALID_TTL>,
+              Rule<noCommstatus, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noReqid, Reason::DISALLOWED_FIELD_SET>>;
+
+using ResponseRules =
+    RuleTable<Rule<isType<UMessageType::UMESSAGE_TYPE_RESPONSE>,
+                   Reason::WRONG_MESSAGE_TYPE>,
+              Rule<hasSource, Reason::BAD_SOURCE_URI>,
+              Rule<hasSink, Reason::BAD_SINK_URI>,
+              Rule<sourceIsRpcMethod, Reason::BAD_SOURCE_URI>,
+              Rule<sinkIsRpcResponse, Reason::BAD_SINK_URI>,
+              Rule<hasReqid, Reason::REQID_MISMATCH>,
+              Rule<reqidIsUuid, Reason::REQID_MISMATCH>,
+              Rule<reqidIsNotExpired, Reason::ID_EXPIRED>,
+              Rule<priorityAtLeastCs4, Reason::PRIORITY_OUT_OF_RANGE>,
+              Rule<noPermissionLevel, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noToken, Reason::DISALLOWED_FIELD_SET>>;
+
+using PublishRules =
+    RuleTable<Rule<isType<UMessageType::UMESSAGE_TYPE_PUBLISH>,
+                   Reason::WRONG_MESSAGE_TYPE>,
+              Rule<hasSource, Reason::BAD_SOURCE_URI>,
+              Rule<sourceIsPublishTopic, Reason::BAD_SOURCE_URI>,
+              Rule<noSink, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noCommstatus, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noReqid, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noPermissionLevel, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noToken, Reason::DISALLOWED_FIELD_SET>>;
+
+using NotificationRules =
+    RuleTable<Rule<isType<UMessageType::UMESSAGE_TYPE_NOTIFICATION>,
+                   Reason::WRONG_MESSAGE_TYPE>,
+              Rule<hasSource, Reason::BAD_SOURCE_URI>,
+              Rule<hasSink, Reason::BAD_SINK_URI>,
+              Rule<sourceIsNotificationSource, Reason::BAD_SOURCE_URI>,
+              Rule<sinkIsNotificationSink, Reason::BAD_SINK_URI>,
+              Rule<noCommstatus, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noReqid, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noPermissionLevel, Reason::DISALLOWED_FIELD_SET>,
+              Rule<noToken, Reason::DISALLOWED_FIELD_SET>>;
+
+template <typename Rules>
+message::ValidationResult validate(const uprotocol::v1::UMessage& umessage,
+                                   std::chrono::system_clock::time_point now) {
+	const Context context{umessage.attributes(), now};
+	auto reason = CommonRules::firstFailure(context);
+	if (!reason) {
+		reason = Rules::firstFailure(context);
+	}
+	return {!reason, reason};
+}
+
+// Calls visitor with the RuleTable for a message type. If the type has no
+// rules, returns the reason instead.
+template <typename Visitor>
+std::optional<Reason> visitRules(UMessageType type, Visitor&& visitor) {
+	switch (type) {
+		case UMessageType::UMESSAGE_TYPE_REQUEST:
+			visitor(RequestRules{});
+			return std::nullopt;
+
+		case UMessageType::UMESSAGE_TYPE_RESPONSE:
+			visitor(ResponseRules{});
+			return std::nullopt;
+
+		case UMessageType::UMESSAGE_TYPE_PUBLISH:
+			visitor(PublishRules{});
+			return std::nullopt;
+
+		case UMessageType::UMESSAGE_TYPE_NOTIFICATION:
+			visitor(NotificationRules{});
+			return std::nullopt;
+
+		case UMessageType::UMESSAGE_TYPE_UNSPECIFIED:
+			return Reason::UNSPECIFIED_MESSAGE_TYPE;
+
+		case UMessageType::UMessageType_INT_MIN_SENTINEL_DO_NOT_USE_:
+		case UMessageType::UMessageType_INT_MAX_SENTINEL_DO_NOT_USE_:
+		default:
+			break;
+	}
+
+	return Reason::INVALID_MESSAGE_TYPE;
+}
+
+}  // namespace
+
+namespace uprotocol::datamodel::validator::message {
+
 std::string_view message(Reason reason) {
 	switch (reason) {
 		case Reason::BAD_ID:
@@ -58,181 +310,112 @@ std::string_view message(Reason reason) {
 	}
 }
 
-ValidationResult isValid(const v1::UMessage& umessage) {
-	switch (umessage.attributes().type()) {
-		case v1::UMessageType::UMESSAGE_TYPE_REQUEST:
-			return isValidRpcRequest(umessage);
-
-		case v1::UMessageType::UMESSAGE_TYPE_RESPONSE:
-			return isValidRpcResponse(umessage);
-
-		case v1::UMessageType::UMESSAGE_TYPE_PUBLISH:
-			return isValidPublish(umessage);
-
-		case v1::UMessageType::UMESSAGE_TYPE_NOTIFICATION:
-			return isValidNotification(umessage);
-
-		case v1::UMessageType::UMESSAGE_TYPE_UNSPECIFIED:
-			return {false, Reason::UNSPECIFIED_MESSAGE_TYPE};
-
-		case v1::UMessageType::UMessageType_INT_MIN_SENTINEL_DO_NOT_USE_:
-		case v1::UMessageType::UMessageType_INT_MAX_SENTINEL_DO_NOT_USE_:
+std::string_view name(Reason reason) {
+	switch (reason) {
+		case Reason::BAD_ID:
+			return "BAD_ID";
+		case Reason::ID_EXPIRED:
+			return "ID_EXPIRED";
+		case Reason::PRIORITY_OUT_OF_RANGE:
+			return "PRIORITY_OUT_OF_RANGE";
+		case Reason::PAYLOAD_FORMAT_OUT_OF_RANGE:
+			return "PAYLOAD_FORMAT_OUT_OF_RANGE";
+		case Reason::BAD_SOURCE_URI:
+			return "BAD_SOURCE_URI";
+		case Reason::BAD_SINK_URI:
+			return "BAD_SINK_URI";
+		case Reason::INVALID_TTL:
+			return "INVALID_TTL";
+		case Reason::DISALLOWED_FIELD_SET:
+			return "DISALLOWED_FIELD_SET";
+		case Reason::REQID_MISMATCH:
+			return "REQID_MISMATCH";
+		case Reason::PRIORITY_MISMATCH:
+			return "PRIORITY_MISMATCH";
+		case Reason::URI_MISMATCH:
+			return "URI_MISMATCH";
+		case Reason::UNSPECIFIED_MESSAGE_TYPE:
+			return "UNSPECIFIED_MESSAGE_TYPE";
+		case Reason::INVALID_MESSAGE_TYPE:
+			return "INVALID_MESSAGE_TYPE";
+		case Reason::WRONG_MESSAGE_TYPE:
+			return "WRONG_MESSAGE_TYPE";
 		default:
-			break;
+			return "UNKNOWN";
 	}
-
-	return std::make_tuple(false, Reason::INVALID_MESSAGE_TYPE);
 }
 
-ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
-	auto [valid, reason] = uuid::isUuid(umessage.attributes().id());
-	if (!valid) {
-		return {false, Reason::BAD_ID};
-	}
-
-	if (umessage.attributes().has_ttl() && (umessage.attributes().ttl() > 0)) {
-		auto [expired, reason] = uuid::isExpired(
-		    umessage.attributes().id(),
-		    std::chrono::milliseconds(umessage.attributes().ttl()));
-		if (expired) {
-			return {false, Reason::ID_EXPIRED};
-		}
-	}
-
-	if (!UPriority_IsValid(umessage.attributes().priority())) {
-		return {false, Reason::PRIORITY_OUT_OF_RANGE};
-	}
-
-	if (!UPayloadFormat_IsValid(umessage.attributes().payload_format())) {
-		return {false, Reason::PAYLOAD_FORMAT_OUT_OF_RANGE};
-	}
-
-	return {true, {}};
+ValidationResult isValid(const v1::UMessage& umessage) {
+	return isValid(umessage, std::chrono::system_clock::now());
 }
 
-ValidationResult isValidRpcRequest(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_REQUEST) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
-	if (!umessage.attributes().has_source()) {
-		return {false, Reason::BAD_SOURCE_URI};
+ValidationResult isValid(const v1::UMessage& umessage,
+                         std::chrono::system_clock::time_point now) {
+	ValidationResult result;
+	auto bad_type = visitRules(umessage.attributes().type(), [&](auto rules) {
+		result = validate<decltype(rules)>(umessage, now);
+	});
+	if (bad_type) {
+		return {false, bad_type};
 	}
+	return result;
+}
 
-	if (!umessage.attributes().has_sink()) {
-		return {false, Reason::BAD_SINK_URI};
+size_t validateBatch(utils::Span<const v1::UMessage> messages,
+                     std::chrono::system_clock::time_point now,
+                     utils::Span<BatchResult> results) {
+	if (results.size() < messages.size()) {
+		throw std::length_error(
+		    "Batch results must have an entry for every message");
 	}
 
-	{
-		auto [valid, reason] =
-		    uri::isValidRpcResponse(umessage.attributes().source());
-		if (!valid) {
-			return {false, Reason::BAD_SOURCE_URI};
-		}
+	size_t num_valid = 0;
+	auto result = results.begin();
+	for (const auto& umessage : messages) {
+		auto [valid, reason] = isValid(umessage, now);
+		*result++ = reason;
+		num_valid += valid ? 1 : 0;
 	}
+	return num_valid;
+}
 
-	{
-		auto [valid, reason] =
-		    uri::isValidRpcMethod(umessage.attributes().sink());
-		if (!valid) {
-			return {false, Reason::BAD_SINK_URI};
-		}
-	}
+size_t validateBatch(utils::Span<const v1::UMessage> messages,
+                     utils::Span<BatchResult> results) {
+	return validateBatch(messages, std::chrono::system_clock::now(), results);
+}
 
-	if (umessage.attributes().priority() < UPRIORITY_CS4) {
-		return {false, Reason::PRIORITY_OUT_OF_RANGE};
-	}
+size_t ReasonSet::size() const noexcept {
+	return std::bitset<sizeof(Mask) * CHAR_BIT>(mask).count();
+}
 
-	if ((!umessage.attributes().has_ttl()) ||
-	    (umessage.attributes().ttl() == 0)) {
-		return {false, Reason::INVALID_TTL};
-	}
+ReasonSet allFailures(const v1::UMessage& umessage,
+                      std::chrono::system_clock::time_point now) {
+	const Context context{umessage.attributes(), now};
+	ReasonSet failures;
+	CommonRules::collectFailures(context, failures);
 
-	if (umessage.attributes().has_commstatus()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
+	auto bad_type = visitRules(umessage.attributes().type(), [&](auto rules) {
+		decltype(rules)::collectFailures(context, failures);
+	});
+	if (bad_type) {
+		failures.insert(*bad_type);
 	}
+	return failures;
+}
 
-	if (umessage.attributes().has_reqid()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
+ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
+	const Context context{umessage.attributes(),
+	                      std::chrono::system_clock::now()};
+	auto reason = CommonRules::firstFailure(context);
+	return {!reason, reason};
+}
 
-	return {true, {}};
+ValidationResult isValidRpcRequest(const v1::UMessage& umessage) {
+	return validate<RequestRules>(umessage, std::chrono::system_clock::now());
 }
 
 ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_RESPONSE) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
-	if (!umessage.attributes().has_source()) {
-		return {false, Reason::BAD_SOURCE_URI};
-	}
-
-	if (!umessage.attributes().has_sink()) {
-		return {false, Reason::BAD_SINK_URI};
-	}
-
-	{
-		auto [valid, reason] =
-		    uri::isValidRpcMethod(umessage.attributes().source());
-		if (!valid) {
-			return {false, Reason::BAD_SOURCE_URI};
-		}
-	}
-
-	{
-		auto [valid, reason] =
-		    uri::isValidRpcResponse(umessage.attributes().sink());
-		if (!valid) {
-			return {false, Reason::BAD_SINK_URI};
-		}
-	}
-
-	if (!umessage.attributes().has_reqid()) {
-		return {false, Reason::REQID_MISMATCH};
-	}
-
-	{
-		auto [valid, reason] = uuid::isUuid(umessage.attributes().reqid());
-		if (!valid) {
-			return {false, Reason::REQID_MISMATCH};
-		}
-	}
-
-	if (umessage.attributes().has_ttl() && (umessage.attributes().ttl() > 0)) {
-		auto [expired, reason] = uuid::isExpired(
-		    umessage.attributes().reqid(),
-		    std::chrono::milliseconds(umessage.attributes().ttl()));
-		if (expired) {
-			return {false, Reason::ID_EXPIRED};
-		}
-	}
-
-	if (umessage.attributes().priority() < UPRIORITY_CS4) {
-		return {false, Reason::PRIORITY_OUT_OF_RANGE};
-	}
-
-	if (umessage.attributes().has_permission_level()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_token()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	return {true, {}};
+	return validate<ResponseRules>(umessage, std::chrono::system_clock::now());
 }
 
 ValidationResult isValidRpcResponseFor(const v1::UMessage& request,
@@ -265,103 +448,12 @@ ValidationResult isValidRpcResponseFor(const v1::UMessage& request,
 }
 
 ValidationResult isValidPublish(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_PUBLISH) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
-	if (!umessage.attributes().has_source()) {
-		return {false, Reason::BAD_SOURCE_URI};
-	}
-
-	{
-		auto [valid, reason] =
-		    uri::isValidPublishTopic(umessage.attributes().source());
-		if (!valid) {
-			return {false, Reason::BAD_SOURCE_URI};
-		}
-	}
-
-	if (umessage.attributes().has_sink()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_commstatus()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_reqid()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_permission_level()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_token()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	return {true, {}};
+	return validate<PublishRules>(umessage, std::chrono::system_clock::now());
 }
 
 ValidationResult isValidNotification(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_NOTIFICATION) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
-	if (!umessage.attributes().has_source()) {
-		return {false, Reason::BAD_SOURCE_URI};
-	}
-
-	if (!umessage.attributes().has_sink()) {
-		return {false, Reason::BAD_SINK_URI};
-	}
-
-	{
-		auto [valid, reason] =
-		    uri::isValidNotificationSource(umessage.attributes().source());
-		if (!valid) {
-			return {false, Reason::BAD_SOURCE_URI};
-		}
-	}
-
-	{
-		auto [valid, reason] =
-		    uri::isValidNotificationSink(umessage.attributes().sink());
-		if (!valid) {
-			return {false, Reason::BAD_SINK_URI};
-		}
-	}
-
-	if (umessage.attributes().has_commstatus()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_reqid()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_permission_level()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	if (umessage.attributes().has_token()) {
-		return {false, Reason::DISALLOWED_FIELD_SET};
-	}
-
-	return {true, {}};
+	return validate<NotificationRules>(umessage,
+	                                   std::chrono::system_clock::now());
 }
 
 }  // namespace uprotocol::datamodel::validator::message
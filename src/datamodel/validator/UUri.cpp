@@ -11,36 +11,137 @@
 
 #include "up-cpp/datamodel/validator/UUri.h"
 
+#include "up-cpp/datamodel/PackedUUri.h"
+
 namespace {
 
 constexpr size_t AUTHORITY_SPEC_MAX_LENGTH = 128;
 // TODO(max) try to find a better name
 constexpr auto START_OF_TOPICS = 0x8000;
 constexpr auto MAX_RESOURCE_ID = 0xFFFF;
+constexpr uint32_t WILDCARD_SERVICE_ID = 0xFFFF;
+constexpr uint32_t WILDCARD_INSTANCE_ID = 0xFFFF0000;
+constexpr uint32_t WILDCARD_VERSION = 0xFF;
+constexpr uint32_t WILDCARD_RESOURCE_ID = 0xFFFF;
 
+using uprotocol::datamodel::validator::uri::Classification;
 using uprotocol::datamodel::validator::uri::Reason;
 using uprotocol::datamodel::validator::uri::ValidationResult;
 
-ValidationResult uriCommonValidChecks(const uprotocol::v1::UUri& uuri) {
-	if (uuri.ue_version_major() == 0) {
+// The fields of a URI that classification depends on, so that v1::UUri and
+// PackedUUri share one implementation
+struct UriFields {
+	std::string_view authority;
+	bool wildcard_authority;
+	bool local;
+	uint32_t ue_id;
+	uint32_t ue_version_major;
+	uint32_t resource_id;
+};
+
+ValidationResult uriCommonValidChecks(const UriFields& uri) {
+	if (uri.ue_version_major == 0) {
 		return {false, Reason::RESERVED_VERSION};
 	}
 
-	if (uuri.ue_version_major() > std::numeric_limits<uint8_t>::max()) {
+	if (uri.ue_version_major > std::numeric_limits<uint8_t>::max()) {
 		return {false, Reason::VERSION_OVERFLOW};
 	}
 
-	if (uuri.resource_id() > std::numeric_limits<uint16_t>::max()) {
+	if (uri.resource_id > std::numeric_limits<uint16_t>::max()) {
 		return {false, Reason::RESOURCE_OVERFLOW};
 	}
 
-	if (uuri.authority_name().size() > AUTHORITY_SPEC_MAX_LENGTH) {
+	if (uri.authority.size() > AUTHORITY_SPEC_MAX_LENGTH) {
 		return {false, Reason::AUTHORITY_TOO_LONG};
 	}
 
 	return {true, {}};
 }
 
+// Shared by all of the message-type forms, which disallow wildcards and then
+// only differ in their allowed resource IDs
+ValidationResult checkForm(const Classification& uri_class,
+                           Classification::Mask form) {
+	if (uri_class.hasAny(Classification::ANY_WILDCARD)) {
+		return {false, Reason::DISALLOWED_WILDCARD};
+	}
+	if (!uri_class.has(form)) {
+		return {false, Reason::BAD_RESOURCE_ID};
+	}
+	return {true, std::nullopt};
+}
+
+Classification classifyFields(const UriFields& uri) {
+	using C = Classification;
+	Classification result;
+	auto& mask = result.mask;
+
+	if (uri.wildcard_authority) {
+		mask |= C::WILDCARD_AUTHORITY;
+	}
+	if ((uri.ue_id & WILDCARD_SERVICE_ID) == WILDCARD_SERVICE_ID) {
+		mask |= C::WILDCARD_SERVICE_ID;
+	}
+	if ((uri.ue_id & WILDCARD_INSTANCE_ID) == WILDCARD_INSTANCE_ID) {
+		mask |= C::WILDCARD_INSTANCE_ID;
+	}
+	if (uri.ue_version_major == WILDCARD_VERSION) {
+		mask |= C::WILDCARD_VERSION;
+	}
+	if (uri.resource_id == WILDCARD_RESOURCE_ID) {
+		mask |= C::WILDCARD_RESOURCE_ID;
+	}
+	if (uri.local) {
+		mask |= C::LOCAL;
+	}
+
+	const auto resource_id = uri.resource_id;
+	const bool is_topic_resource =
+	    (resource_id >= START_OF_TOPICS) && (resource_id <= MAX_RESOURCE_ID);
+	if (is_topic_resource) {
+		mask |= C::SUBSCRIPTION;
+	}
+
+	// All message-type forms disallow wildcards, then differ only in the
+	// allowed range of resource IDs
+	if (!result.hasAny(C::ANY_WILDCARD)) {
+		if (resource_id == 0) {
+			mask |= C::RPC_RESPONSE | C::NOTIFICATION_SINK;
+			if (!result.has(C::LOCAL)) {
+				mask |= C::DEFAULT_ENTITY;
+			}
+		} else if (resource_id < START_OF_TOPICS) {
+			mask |= C::RPC_METHOD;
+		} else if (is_topic_resource) {
+			mask |= C::PUBLISH_TOPIC | C::NOTIFICATION_SOURCE;
+		}
+	}
+
+	if (!std::all_of(uri.authority.begin(), uri.authority.end(), isspace)) {
+		result.empty_failure = Reason::EMPTY;
+	} else if (uri.ue_id != 0) {
+		result.empty_failure = Reason::RESERVED_RESOURCE;
+	} else if (uri.ue_version_major != 0) {
+		result.empty_failure = Reason::RESERVED_VERSION;
+	} else if (resource_id != 0) {
+		result.empty_failure = Reason::BAD_RESOURCE_ID;
+	} else {
+		mask |= C::EMPTY;
+	}
+
+	if (result.has(C::EMPTY)) {
+		result.filter_failure = Reason::EMPTY;
+	} else {
+		result.filter_failure = std::get<1>(uriCommonValidChecks(uri));
+	}
+	if (!result.filter_failure) {
+		mask |= C::FILTER;
+	}
+
+	return result;
+}
+
 }  // namespace
 
 namespace uprotocol::datamodel::validator::uri {
@@ -102,159 +203,127 @@ bool verify_no_wildcards(const v1::UUri& uuri) {
 	       !has_wildcard_version(uuri) && !has_wildcard_resource_id(uuri);
 }
 
-ValidationResult isValid(const v1::UUri& uuri) {
-	{
-		auto [valid, reason] = isValidRpcMethod(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
-	}
+Classification classify(const v1::UUri& uuri) {
+	return classifyFields({uuri.authority_name(), has_wildcard_authority(uuri),
+	                       isLocal(uuri), uuri.ue_id(), uuri.ue_version_major(),
+	                       uuri.resource_id()});
+}
 
-	{
-		auto [valid, reason] = isValidRpcResponse(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
-	}
+Classification classify(const PackedUUri& uri) {
+	// Wildcard and local authorities are recognized by their reserved IDs.
+	// The remaining authority checks read the interned name, which does not
+	// take a lock.
+	return classifyFields(
+	    {uri.authorityName(),
+	     uri.authorityId() == PackedUUri::WILDCARD_AUTHORITY, uri.isLocal(),
+	     uri.ueId(), uri.ueVersionMajor(), uri.resourceId()});
+}
 
-	{
-		auto [valid, reason] = isValidPublishTopic(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
+ValidationResult isValidFilter(const Classification& uri_class) {
+	if (uri_class.filter_failure) {
+		return {false, uri_class.filter_failure};
 	}
+	return {true, std::nullopt};
+}
 
-	{
-		auto [valid, reason] = isValidNotificationSource(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
-	}
+ValidationResult isValidRpcMethod(const Classification& uri_class) {
+	return checkForm(uri_class, Classification::RPC_METHOD);
+}
 
-	return isValidNotificationSink(uuri);
+ValidationResult isValidRpcResponse(const Classification& uri_class) {
+	return checkForm(uri_class, Classification::RPC_RESPONSE);
 }
 
-ValidationResult isValidFilter(const v1::UUri& uuri) {
-	auto [is_empty, empty_reason] = isEmpty(uuri);
-	if (is_empty) {
-		return {false, Reason::EMPTY};
+ValidationResult isValidDefaultEntity(const Classification& uri_class) {
+	if (uri_class.has(Classification::LOCAL)) {
+		return {false, Reason::LOCAL_AUTHORITY};
 	}
+	return checkForm(uri_class, Classification::DEFAULT_ENTITY);
+}
 
-	auto [common_valid, common_fail_reason] = uriCommonValidChecks(uuri);
-	if (!common_valid) {
-		return {common_valid, common_fail_reason};
-	}
+ValidationResult isValidPublishTopic(const Classification& uri_class) {
+	return checkForm(uri_class, Classification::PUBLISH_TOPIC);
+}
 
-	return {true, {}};
+ValidationResult isValidNotificationSource(const Classification& uri_class) {
+	return checkForm(uri_class, Classification::NOTIFICATION_SOURCE);
 }
 
-ValidationResult isValidRpcMethod(const v1::UUri& uuri) {
-	// disallow wildcards
-	if (!verify_no_wildcards(uuri)) {
-		return {false, Reason::DISALLOWED_WILDCARD};
-	}
+ValidationResult isValidNotificationSink(const Classification& uri_class) {
+	return checkForm(uri_class, Classification::NOTIFICATION_SINK);
+}
 
-	// check resource ID [0x0001, 0x7FFF]
-	if (uuri.resource_id() == 0 || uuri.resource_id() >= START_OF_TOPICS) {
+ValidationResult isValidSubscription(const Classification& uri_class) {
+	if (!uri_class.has(Classification::SUBSCRIPTION)) {
 		return {false, Reason::BAD_RESOURCE_ID};
 	}
-
 	return {true, std::nullopt};
 }
 
-ValidationResult isValidRpcResponse(const v1::UUri& uuri) {
-	// disallow wildcards
-	if (!verify_no_wildcards(uuri)) {
-		return {false, Reason::DISALLOWED_WILDCARD};
-	}
-
-	if (uuri.resource_id() != 0) {
-		return {false, Reason::BAD_RESOURCE_ID};
+ValidationResult isEmpty(const Classification& uri_class) {
+	if (uri_class.empty_failure) {
+		return {false, uri_class.empty_failure};
 	}
 	return {true, std::nullopt};
 }
 
-ValidationResult isValidDefaultEntity(const v1::UUri& uuri) {
-	if (isLocal(uuri)) {
-		return {false, Reason::LOCAL_AUTHORITY};
-	}
-
-	return isValidRpcResponse(uuri);
+bool isLocal(const Classification& uri_class) {
+	return uri_class.has(Classification::LOCAL);
 }
 
-ValidationResult isValidDefaultSource(const v1::UUri& uuri) {
-	return isValidDefaultEntity(uuri);
+bool verify_no_wildcards(const Classification& uri_class) {
+	return !uri_class.hasAny(Classification::ANY_WILDCARD);
 }
 
-ValidationResult isValidPublishTopic(const v1::UUri& uuri) {
-	// disallow wildcards
-	if (!verify_no_wildcards(uuri)) {
-		return {false, Reason::DISALLOWED_WILDCARD};
+ValidationResult isValid(const v1::UUri& uuri) {
+	constexpr auto VALID_FORMS =
+	    Classification::RPC_METHOD | Classification::RPC_RESPONSE |
+	    Classification::PUBLISH_TOPIC | Classification::NOTIFICATION_SOURCE;
+	const auto uri_class = classify(uuri);
+	if (uri_class.hasAny(VALID_FORMS)) {
+		return {true, std::nullopt};
 	}
+	return isValidNotificationSink(uri_class);
+}
 
-	if ((uuri.resource_id() < START_OF_TOPICS) ||
-	    (uuri.resource_id() > MAX_RESOURCE_ID)) {
-		return {false, Reason::BAD_RESOURCE_ID};
-	}
+ValidationResult isValidFilter(const v1::UUri& uuri) {
+	return isValidFilter(classify(uuri));
+}
 
-	return {true, std::nullopt};
+ValidationResult isValidRpcMethod(const v1::UUri& uuri) {
+	return isValidRpcMethod(classify(uuri));
 }
 
-ValidationResult isValidNotificationSource(const v1::UUri& uuri) {
-	// disallow wildcards
-	if (!verify_no_wildcards(uuri)) {
-		return {false, Reason::DISALLOWED_WILDCARD};
-	}
+ValidationResult isValidRpcResponse(const v1::UUri& uuri) {
+	return isValidRpcResponse(classify(uuri));
+}
 
-	if ((uuri.resource_id() < START_OF_TOPICS) ||
-	    (uuri.resource_id() > MAX_RESOURCE_ID)) {
-		return {false, Reason::BAD_RESOURCE_ID};
-	}
+ValidationResult isValidDefaultEntity(const v1::UUri& uuri) {
+	return isValidDefaultEntity(classify(uuri));
+}
 
-	return {true, std::nullopt};
+ValidationResult isValidDefaultSource(const v1::UUri& uuri) {
+	return isValidDefaultEntity(uuri);
 }
 
-ValidationResult isValidNotificationSink(const v1::UUri& uuri) {
-	// disallow wildcards
-	if (!verify_no_wildcards(uuri)) {
-		return {false, Reason::DISALLOWED_WILDCARD};
-	}
+ValidationResult isValidPublishTopic(const v1::UUri& uuri) {
+	return isValidPublishTopic(classify(uuri));
+}
 
-	if (uuri.resource_id() != 0) {
-		return {false, Reason::BAD_RESOURCE_ID};
-	}
+ValidationResult isValidNotificationSource(const v1::UUri& uuri) {
+	return isValidNotificationSource(classify(uuri));
+}
 
-	return {true, std::nullopt};
+ValidationResult isValidNotificationSink(const v1::UUri& uuri) {
+	return isValidNotificationSink(classify(uuri));
 }
 
 ValidationResult isValidSubscription(const v1::UUri& uuri) {
-	if (uuri.resource_id() < START_OF_TOPICS ||
-	    uuri.resource_id() > MAX_RESOURCE_ID) {
-		return {false, Reason::BAD_RESOURCE_ID};
-	}
-
-	return {true, std::nullopt};
+	return isValidSubscription(classify(uuri));
 }
 
 ValidationResult isEmpty(const v1::UUri& uuri) {
-	if (!std::all_of(uuri.authority_name().begin(), uuri.authority_name().end(),
-	                 isspace)) {
-		return {false, Reason::EMPTY};
-	}
-
-	if (uuri.ue_id() != 0) {
-		return {false, Reason::RESERVED_RESOURCE};
-	}
-
-	if (uuri.ue_version_major() != 0) {
-		return {false, Reason::RESERVED_VERSION};
-	}
-
-	if (uuri.resource_id() != 0) {
-		return {false, Reason::BAD_RESOURCE_ID};
-	}
-
-	return {true, std::nullopt};
+	return isEmpty(classify(uuri));
 }
 
 bool isLocal(const v1::UUri& uuri) { return (uuri.authority_name().empty()); }
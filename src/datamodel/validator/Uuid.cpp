@@ -55,6 +55,11 @@ std::string_view message(Reason reason) {
 }
 
 ValidationResult isUuid(const uprotocol::v1::UUID& uuid) {
+	return isUuid(uuid, std::chrono::system_clock::now());
+}
+
+ValidationResult isUuid(const uprotocol::v1::UUID& uuid,
+                        std::chrono::system_clock::time_point now) {
 	uint8_t version = internalGetVersion(uuid);
 	if (version != UUID_VERSION_7) {
 		return {false, Reason::WRONG_VERSION};
@@ -66,9 +71,8 @@ ValidationResult isUuid(const uprotocol::v1::UUID& uuid) {
 	}
 
 	auto timestamp = getUuidTimestamp(uuid);
-	auto current_time = std::chrono::system_clock::now();
 
-	if (timestamp > current_time) {
+	if (timestamp > now) {
 		return {false, Reason::FROM_THE_FUTURE};
 	}
 
@@ -77,15 +81,36 @@ ValidationResult isUuid(const uprotocol::v1::UUID& uuid) {
 
 ValidationResult isExpired(const uprotocol::v1::UUID& uuid,
                            std::chrono::milliseconds ttl) {
-	auto [valid, reason] = isUuid(uuid);
+	return isExpired(uuid, ttl, std::chrono::system_clock::now());
+}
+
+ValidationResult isExpired(const uprotocol::v1::UUID& uuid,
+                           std::chrono::milliseconds ttl,
+                           std::chrono::system_clock::time_point now) {
+	auto [valid, reason] = isUuid(uuid, now);
 	if (!valid) {
 		return {false, reason};
 	}
 
 	auto timestamp = getUuidTimestamp(uuid);
-	auto current_time = std::chrono::system_clock::now();
 
-	if ((current_time - timestamp) > ttl) {
+	if ((now - timestamp) > ttl) {
+		return {true, Reason::EXPIRED};
+	}
+
+	return {false, std::nullopt};
+}
+
+ValidationResult isExpired(const uprotocol::v1::UUID& uuid,
+                           std::chrono::milliseconds ttl,
+                           const utils::CoarseClock& clock) {
+	auto now = clock.now();
+	auto [valid, reason] = isUuid(uuid, now + clock.resolution());
+	if (!valid) {
+		return {false, reason};
+	}
+
+	if ((now - getUuidTimestamp(uuid)) > ttl) {
 		return {true, Reason::EXPIRED};
 	}
 
@@ -134,4 +159,24 @@ std::chrono::milliseconds getRemainingTime(const uprotocol::v1::UUID& uuid,
 	return std::max(ttl - elapsed_time, 0ms);
 }
 
+std::chrono::milliseconds getElapsedTime(const uprotocol::v1::UUID& uuid,
+                                         const utils::CoarseClock& clock) {
+	auto now = clock.now();
+	auto [valid, reason] = isUuid(uuid, now + clock.resolution());
+	if (!valid) {
+		throw InvalidUuid(message(reason.value()));
+	}
+
+	auto elapsed =
+	    std::chrono::duration_cast<Milliseconds>(now - getUuidTimestamp(uuid));
+	return std::max(elapsed, 0ms);
+}
+
+std::chrono::milliseconds getRemainingTime(const uprotocol::v1::UUID& uuid,
+                                           std::chrono::milliseconds ttl,
+                                           const utils::CoarseClock& clock) {
+	auto elapsed_time = getElapsedTime(uuid, clock);
+	return std::max(ttl - elapsed_time, 0ms);
+}
+
 }  // namespace uprotocol::datamodel::validator::uuid
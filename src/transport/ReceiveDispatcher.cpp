@@ -0,0 +1,309 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/transport/ReceiveDispatcher.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// @brief Maximum number of messages delivered from a strand before it goes
+///        to the back of the ready queue, so that one busy listener cannot
+///        monopolize a worker.
+constexpr size_t BATCH_SIZE = 32;
+
+// Identifies the worker running on the current thread, so that strands
+// rescheduled from a worker stay on that worker.
+thread_local const void* current_dispatcher = nullptr;
+thread_local size_t current_worker = 0;
+
+}  // namespace
+
+namespace uprotocol::transport {
+
+ReceiveDispatcher::ReceiveDispatcher(Options options)
+    : options_(options) {
+	if (options_.queue_capacity == 0) {
+		throw std::invalid_argument(
+		    "ReceiveDispatcher queue capacity cannot be zero");
+	}
+
+	auto threads = options_.threads;
+	if (threads == 0) {
+		threads = std::max(1U, std::thread::hardware_concurrency());
+	}
+
+	// All workers must exist before any start, as they steal from each other
+	workers_.reserve(threads);
+	for (size_t i = 0; i < threads; ++i) {
+		workers_.push_back(std::make_unique<Worker>());
+	}
+	for (size_t i = 0; i < threads; ++i) {
+		workers_[i]->thread = std::thread([this, i]() { work(i); });
+	}
+}
+
+ReceiveDispatcher::ReceiveDispatcher() : ReceiveDispatcher(Options{}) {}
+
+ReceiveDispatcher::~ReceiveDispatcher() {
+	{
+		std::lock_guard const lock(idle_mtx_);
+		stop_ = true;
+		wake_.notify_all();
+		drained_.notify_all();
+	}
+
+	// Release anything blocked in dispatch()
+	{
+		std::shared_lock const lock(strands_mtx_);
+		for (auto& [listener, strand] : strands_) {
+			std::lock_guard const strand_lock(strand->mtx);
+			strand->removed = true;
+			strand->space.notify_all();
+		}
+	}
+
+	for (auto& worker : workers_) {
+		worker->thread.join();
+	}
+}
+
+bool ReceiveDispatcher::dispatch(const Listener& listener,
+                                 const v1::UMessage& message) {
+	return enqueue(listener, message);
+}
+
+bool ReceiveDispatcher::dispatch(const Listener& listener,
+                                 v1::UMessage&& message) {
+	return enqueue(listener, std::move(message));
+}
+
+template <typename Message>
+bool ReceiveDispatcher::enqueue(const Listener& listener,
+                                Message&& message) {
+	auto strand = strandFor(listener);
+	size_t evicted = 0;
+	bool needs_scheduling = false;
+	{
+		std::unique_lock lock(strand->mtx);
+		if (!strand->removed &&
+		    (strand->queue.size() >= options_.queue_capacity)) {
+			switch (options_.overflow) {
+				case OverflowPolicy::DROP_NEWEST:
+					++dropped_;
+					return false;
+
+				case OverflowPolicy::DROP_OLDEST:
+					strand->queue.pop_front();
+					++dropped_;
+					++evicted;
+					break;
+
+				case OverflowPolicy::BLOCK:
+					strand->space.wait(lock, [this, &strand]() {
+						return strand->removed || (strand->queue.size() <
+						                           options_.queue_capacity);
+					});
+					break;
+			}
+		}
+
+		if (strand->removed) {
+			++dropped_;
+			return false;
+		}
+
+		strand->queue.emplace_back(std::forward<Message>(message));
+		++outstanding_;
+		if (!strand->scheduled) {
+			strand->scheduled = true;
+			needs_scheduling = true;
+		}
+	}
+
+	finished(evicted);
+	if (needs_scheduling) {
+		schedule(std::move(strand));
+	}
+	return true;
+}
+
+void ReceiveDispatcher::remove(const Listener& listener) {
+	std::shared_ptr<Strand> strand;
+	{
+		std::unique_lock const lock(strands_mtx_);
+		auto found = strands_.find(listener);
+		if (found == strands_.end()) {
+			return;
+		}
+		strand = std::move(found->second);
+		strands_.erase(found);
+	}
+
+	size_t discarded = 0;
+	{
+		std::lock_guard const lock(strand->mtx);
+		strand->removed = true;
+		discarded = strand->queue.size();
+		strand->queue.clear();
+		strand->space.notify_all();
+	}
+	dropped_ += discarded;
+	finished(discarded);
+}
+
+void ReceiveDispatcher::drain() {
+	std::unique_lock lock(idle_mtx_);
+	drained_.wait(lock, [this]() { return stop_ || (outstanding_ == 0); });
+}
+
+ReceiveDispatcher::Stats ReceiveDispatcher::stats() const {
+	Stats stats;
+	stats.delivered = delivered_;
+	stats.dropped = dropped_;
+	stats.failed = failed_;
+	return stats;
+}
+
+std::shared_ptr<ReceiveDispatcher::Strand> ReceiveDispatcher::strandFor(
+    const Listener& listener) {
+	{
+		std::shared_lock const lock(strands_mtx_);
+		auto found = strands_.find(listener);
+		if (found != strands_.end()) {
+			return found->second;
+		}
+	}
+
+	std::unique_lock const lock(strands_mtx_);
+	auto [found, inserted] = strands_.try_emplace(listener);
+	if (inserted) {
+		found->second = std::make_shared<Strand>(listener);
+	}
+	return found->second;
+}
+
+void ReceiveDispatcher::schedule(std::shared_ptr<Strand> strand) {
+	size_t index = 0;
+	if (current_dispatcher == this) {
+		index = current_worker;
+	} else {
+		index = next_worker_++ % workers_.size();
+	}
+
+	// Counted before it is queued so that a worker taking it never sees the
+	// count go below zero. A worker woken early just retries.
+	{
+		std::lock_guard const lock(idle_mtx_);
+		++ready_;
+	}
+	{
+		auto& worker = *workers_[index];
+		std::lock_guard const lock(worker.mtx);
+		worker.ready.push_back(std::move(strand));
+	}
+	wake_.notify_one();
+}
+
+std::shared_ptr<ReceiveDispatcher::Strand> ReceiveDispatcher::take(
+    size_t worker) {
+	while (true) {
+		{
+			std::unique_lock lock(idle_mtx_);
+			wake_.wait(lock, [this]() { return stop_ || (ready_ > 0); });
+			if (stop_) {
+				return nullptr;
+			}
+		}
+
+		// Own queue first, oldest first. Steal the newest from the others.
+		for (size_t i = 0; i < workers_.size(); ++i) {
+			auto& victim = *workers_[(worker + i) % workers_.size()];
+			std::shared_ptr<Strand> strand;
+			{
+				std::lock_guard const lock(victim.mtx);
+				if (victim.ready.empty()) {
+					continue;
+				}
+				if (i == 0) {
+					strand = std::move(victim.ready.front());
+					victim.ready.pop_front();
+				} else {
+					strand = std::move(victim.ready.back());
+					victim.ready.pop_back();
+				}
+			}
+			std::lock_guard const lock(idle_mtx_);
+			--ready_;
+			return strand;
+		}
+		std::this_thread::yield();
+	}
+}
+
+bool ReceiveDispatcher::run(Strand& strand) {
+	for (size_t i = 0; i < BATCH_SIZE; ++i) {
+		v1::UMessage message;
+		{
+			std::lock_guard const lock(strand.mtx);
+			if (strand.queue.empty()) {
+				strand.scheduled = false;
+				return false;
+			}
+			message = std::move(strand.queue.front());
+			strand.queue.pop_front();
+			strand.space.notify_one();
+		}
+
+		try {
+			strand.listener(message);
+			++delivered_;
+		} catch (const std::exception& e) {
+			++failed_;
+			spdlog::error("ReceiveDispatcher listener threw: {}", e.what());
+		}
+		finished(1);
+	}
+
+	std::lock_guard const lock(strand.mtx);
+	if (strand.queue.empty()) {
+		strand.scheduled = false;
+		return false;
+	}
+	return true;
+}
+
+void ReceiveDispatcher::finished(size_t count) {
+	if ((count > 0) && (outstanding_.fetch_sub(count) == count)) {
+		std::lock_guard const lock(idle_mtx_);
+		drained_.notify_all();
+	}
+}
+
+void ReceiveDispatcher::work(size_t worker) {
+	current_dispatcher = this;
+	current_worker = worker;
+
+	while (auto strand = take(worker)) {
+		if (run(*strand)) {
+			// Batch limit reached with messages left. Go to the back of the
+			// line behind the other ready listeners.
+			schedule(std::move(strand));
+		}
+	}
+}
+
+}  // namespace uprotocol::transport
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/transport/SendScheduler.h"
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "up-cpp/datamodel/validator/UMessage.h"
+
+namespace {
+
+namespace message_validator = uprotocol::datamodel::validator::message;
+using uprotocol::v1::UCode;
+using uprotocol::v1::UPriority;
+using uprotocol::v1::UStatus;
+
+UStatus makeStatus(UCode code, std::string&& message = {}) {
+	UStatus status;
+	status.set_code(code);
+	if (!message.empty()) {
+		status.set_message(std::move(message));
+	}
+	return status;
+}
+
+UPriority priorityFor(size_t index) {
+	const auto cs0 = static_cast<size_t>(UPriority::UPRIORITY_CS0);
+	return static_cast<UPriority>(cs0 + index);
+}
+
+// Sends a queued message. Messages are validated when they are queued, but
+// may have expired by the time they reach the front of the queue.
+UStatus sendQueued(uprotocol::transport::UTransport& transport,
+                   const uprotocol::v1::UMessage& message) {
+	try {
+		return transport.send(message);
+	} catch (const message_validator::InvalidUMessage& e) {
+		auto [valid, reason] = message_validator::isValid(message);
+		const bool expired =
+		    !valid && (*reason == message_validator::Reason::ID_EXPIRED);
+		return makeStatus(
+		    expired ? UCode::DEADLINE_EXCEEDED : UCode::INVALID_ARGUMENT,
+		    e.what());
+	} catch (const std::exception& e) {
+		return makeStatus(UCode::INTERNAL, e.what());
+	}
+}
+
+}  // namespace
+
+namespace uprotocol::transport {
+
+SendScheduler::SendScheduler(std::shared_ptr<UTransport> transport,
+                             Options options)
+    : transport_(std::move(transport)), options_(std::move(options)) {
+	if (!transport_) {
+		throw NullTransport("transport cannot be null");
+	}
+	if (options_.queue_capacity == 0) {
+		throw std::invalid_argument(
+		    "SendScheduler queue capacity cannot be zero");
+	}
+	if ((options_.low_watermark > options_.high_watermark) ||
+	    (options_.high_watermark > options_.queue_capacity)) {
+		throw std::invalid_argument(
+		    "SendScheduler watermarks must satisfy low <= high <= capacity");
+	}
+	for (const auto weight : options_.weights) {
+		if (weight == 0) {
+			throw std::invalid_argument(
+			    "SendScheduler priority weights cannot be zero");
+		}
+	}
+
+	dispatcher_ = std::thread([this]() { dispatch(); });
+}
+
+SendScheduler::SendScheduler(std::shared_ptr<UTransport> transport)
+    : SendScheduler(std::move(transport), Options{}) {}
+
+SendScheduler::~SendScheduler() {
+	{
+		std::lock_guard const lock(queues_mtx_);
+		stop_ = true;
+		wake_dispatcher_.notify_one();
+		flushed_.notify_all();
+	}
+	dispatcher_.join();
+}
+
+v1::UStatus SendScheduler::enqueue(v1::UMessage&& message,
+                                   SendCallback&& on_sent) {
+	auto [valid, reason] = message_validator::isValid(message);
+	if (!valid) {
+		throw message_validator::InvalidUMessage(
+		    "Invalid UMessage | " +
+		    std::string(message_validator::message(*reason)));
+	}
+
+	const auto index = indexFor(message.attributes().priority());
+	bool became_congested = false;
+	{
+		std::lock_guard const lock(queues_mtx_);
+		auto& queue = queues_[index];
+		if (queue.entries.size() >= options_.queue_capacity) {
+			++queue.rejected;
+			return makeStatus(UCode::RESOURCE_EXHAUSTED,
+			                  "Send queue for this priority is full");
+		}
+
+		queue.entries.push_back(
+		    {std::move(message), std::move(on_sent), Clock::now()});
+		++queue.enqueued;
+		++queued_;
+		if (!queue.congested &&
+		    (queue.entries.size() >= options_.high_watermark)) {
+			queue.congested = true;
+			became_congested = true;
+		}
+		wake_dispatcher_.notify_one();
+	}
+
+	if (became_congested) {
+		signal(index);
+	}
+	return makeStatus(UCode::OK);
+}
+
+bool SendScheduler::congested(v1::UPriority priority) const {
+	return queues_[indexFor(priority)].congested;
+}
+
+SendScheduler::PriorityStats SendScheduler::stats(
+    v1::UPriority priority) const {
+	const auto& queue = queues_[indexFor(priority)];
+	PriorityStats stats;
+	{
+		std::lock_guard const lock(queues_mtx_);
+		stats.depth = queue.entries.size();
+		stats.enqueued = queue.enqueued;
+		stats.rejected = queue.rejected;
+		stats.dispatched = queue.dispatched;
+		stats.congested = queue.congested;
+	}
+	stats.queue_latency = queue.queue_latency.snapshot();
+	return stats;
+}
+
+void SendScheduler::flush() {
+	std::unique_lock lock(queues_mtx_);
+	flushed_.wait(lock,
+	              [this]() { return stop_ || ((queued_ == 0) && !sending_); });
+}
+
+size_t SendScheduler::indexFor(v1::UPriority priority) {
+	if ((priority < v1::UPriority::UPRIORITY_CS0) ||
+	    (priority > v1::UPriority::UPRIORITY_CS6)) {
+		priority = v1::UPriority::UPRIORITY_CS1;
+	}
+	return static_cast<size_t>(priority - v1::UPriority::UPRIORITY_CS0);
+}
+
+SendScheduler::Queue& SendScheduler::next() {
+	if (options_.policy == Policy::WEIGHTED) {
+		for (size_t i = PRIORITIES; i-- > 0;) {
+			auto& queue = queues_[i];
+			if (!queue.entries.empty() && (queue.credit > 0)) {
+				--queue.credit;
+				return queue;
+			}
+		}
+		// Every non-empty queue has used its weight, so start a new round
+		for (size_t i = 0; i < PRIORITIES; ++i) {
+			queues_[i].credit = options_.weights[i];
+		}
+	}
+
+	for (size_t i = PRIORITIES; i-- > 0;) {
+		auto& queue = queues_[i];
+		if (!queue.entries.empty()) {
+			if (queue.credit > 0) {
+				--queue.credit;
+			}
+			return queue;
+		}
+	}
+	// Unreachable while queued_ > 0
+	throw std::logic_error("SendScheduler dispatched from empty queues");
+}
+
+void SendScheduler::dispatch() {
+	std::unique_lock lock(queues_mtx_);
+	while (true) {
+		wake_dispatcher_.wait(lock,
+		                      [this]() { return stop_ || (queued_ > 0); });
+		if (stop_) {
+			break;
+		}
+
+		auto& queue = next();
+		const auto index = static_cast<size_t>(&queue - queues_.data());
+		auto entry = std::move(queue.entries.front());
+		queue.entries.pop_front();
+		--queued_;
+		++queue.dispatched;
+		bool cleared = false;
+		if (queue.congested &&
+		    (queue.entries.size() <= options_.low_watermark)) {
+			queue.congested = false;
+			cleared = true;
+		}
+		sending_ = true;
+		lock.unlock();
+
+		queue.queue_latency.observe(Clock::now() - entry.enqueued);
+		if (cleared) {
+			signal(index);
+		}
+
+		auto status = sendQueued(*transport_, entry.message);
+		if (entry.on_sent) {
+			entry.on_sent(status);
+		}
+
+		lock.lock();
+		sending_ = false;
+		if (queued_ == 0) {
+			flushed_.notify_all();
+		}
+	}
+
+	// Stopping, so cancel anything left in the queues
+	std::array<std::deque<Entry>, PRIORITIES> remaining;
+	for (size_t i = 0; i < PRIORITIES; ++i) {
+		remaining[i].swap(queues_[i].entries);
+	}
+	queued_ = 0;
+	lock.unlock();
+
+	static const auto cancelled = makeStatus(
+	    UCode::CANCELLED, "SendScheduler was destroyed before sending");
+	for (auto& entries : remaining) {
+		for (auto& entry : entries) {
+			if (entry.on_sent) {
+				entry.on_sent(cancelled);
+			}
+		}
+	}
+}
+
+void SendScheduler::signal(size_t index) {
+	if (!options_.on_backpressure) {
+		return;
+	}
+
+	// Changes are made under queues_mtx_, but notified outside of it. Notify
+	// whatever the state is now so that the last notification for a queue
+	// always matches its current state.
+	std::lock_guard const lock(signal_mtx_);
+	const bool congested = queues_[index].congested;
+	if (congested != signalled_[index]) {
+		signalled_[index] = congested;
+		options_.on_backpressure(priorityFor(index), congested);
+	}
+}
+
+}  // namespace uprotocol::transport
@@ -11,11 +11,69 @@
 
 #include "up-cpp/transport/UTransport.h"
 
+#include <array>
+#include <string>
 #include <utility>
 
 #include "up-cpp/datamodel/validator/UMessage.h"
 #include "up-cpp/datamodel/validator/UUri.h"
 #include "up-cpp/utils/Expected.h"
+#include "up-cpp/utils/Metrics.h"
+#include "up-cpp/utils/Tracing.h"
+
+namespace {
+
+namespace metrics = uprotocol::utils::metrics;
+using uprotocol::datamodel::validator::message::Reason;
+
+constexpr size_t NUM_REASONS =
+    static_cast<size_t>(Reason::WRONG_MESSAGE_TYPE) + 1;
+
+struct SendMetrics {
+	metrics::Counter& sent;
+	metrics::Counter& failed;
+	std::array<metrics::Counter*, NUM_REASONS> invalid;
+
+	static SendMetrics& get() {
+		static SendMetrics send_metrics = [] {
+			auto& registry = metrics::Registry::global();
+			SendMetrics m{
+			    registry.counter("up_transport_send_total",
+			                     "Messages sent through the transport"),
+			    registry.counter("up_transport_send_failed_total",
+			                     "Sends that returned a non-OK status"),
+			    {}};
+			for (size_t i = 0; i < NUM_REASONS; ++i) {
+				m.invalid[i] = &registry.counter(
+				    "up_transport_send_invalid_total{reason=\"" +
+				        std::string(uprotocol::datamodel::validator::message::
+				                        name(static_cast<Reason>(i))) +
+				        "\"}",
+				    "Messages rejected by validation before sending");
+			}
+			return m;
+		}();
+		return send_metrics;
+	}
+
+	static void invalidMessage(Reason reason) {
+		if (metrics::enabled()) {
+			get().invalid[static_cast<size_t>(reason)]->increment();
+		}
+	}
+
+	static void sendResult(const uprotocol::v1::UStatus& status) {
+		if (metrics::enabled()) {
+			auto& send_metrics = get();
+			send_metrics.sent.increment();
+			if (status.code() != uprotocol::v1::UCode::OK) {
+				send_metrics.failed.increment();
+			}
+		}
+	}
+};
+
+}  // namespace
 
 namespace uprotocol::transport {
 
@@ -35,11 +93,50 @@ UTransport::UTransport(v1::UUri entity_uri)
 v1::UStatus UTransport::send(const v1::UMessage& message) {
 	auto [msgOk, reason] = message_validator::isValid(message);
 	if (!msgOk) {
+		SendMetrics::invalidMessage(*reason);
 		throw message_validator::InvalidUMessage(
 		    "Invalid UMessage | " +
 		    std::string(message_validator::message(*reason)));
 	}
+	UP_CPP_TRACE(VALIDATED, message.attributes().id());
+
+	auto status = sendImpl(message);
+	UP_CPP_TRACE(SENT, message.attributes().id(), status.code());
+	SendMetrics::sendResult(status);
+	return status;
+}
+
+v1::UStatus UTransport::send(v1::UMessage&& message,
+                             datamodel::builder::Payload&& payload) {
+	if (!message.payload().empty()) {
+		throw message_validator::InvalidUMessage(
+		    "Invalid UMessage | Payload provided separately from a message "
+		    "that already has one");
+	}
+	message.mutable_attributes()->set_payload_format(payload.format());
+
+	auto [msgOk, reason] = message_validator::isValid(message);
+	if (!msgOk) {
+		SendMetrics::invalidMessage(*reason);
+		throw message_validator::InvalidUMessage(
+		    "Invalid UMessage | " +
+		    std::string(message_validator::message(*reason)));
+	}
+	UP_CPP_TRACE(VALIDATED, message.attributes().id());
+
+#ifdef UP_CPP_TRACING
+	// The message is moved into the transport, so keep the ID for tracing
+	const auto id = message.attributes().id();
+#endif
+	auto status = sendPayloadImpl(std::move(message), std::move(payload));
+	UP_CPP_TRACE(SENT, id, status.code());
+	SendMetrics::sendResult(status);
+	return status;
+}
 
+v1::UStatus UTransport::sendPayloadImpl(
+    v1::UMessage&& message, datamodel::builder::Payload&& payload) {
+	std::move(payload).buildInto(message);
 	return sendImpl(message);
 }
 
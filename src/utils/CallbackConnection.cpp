@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/CallbackConnection.h"
+
+namespace uprotocol::utils::callbacks::detail {
+
+metrics::Histogram& callbackDuration() {
+	static auto& histogram = metrics::Registry::global().histogram(
+	    "up_callback_duration_seconds",
+	    "Time spent in callbacks, including transport listeners");
+	return histogram;
+}
+
+}  // namespace uprotocol::utils::callbacks::detail
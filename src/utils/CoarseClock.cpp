@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/CoarseClock.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace uprotocol::utils {
+
+CoarseClock::CoarseClock(std::chrono::milliseconds resolution, Source source)
+    : resolution_(resolution), source_(std::move(source)) {
+	if (resolution_ < std::chrono::milliseconds::zero()) {
+		throw std::invalid_argument("CoarseClock resolution is negative");
+	}
+
+	refresh();
+
+	if (resolution_ > std::chrono::milliseconds::zero()) {
+		thread_ = std::thread([this]() { refreshLoop(); });
+	}
+}
+
+CoarseClock::~CoarseClock() {
+	{
+		std::lock_guard const lock(mtx_);
+		stop_ = true;
+	}
+	stop_cv_.notify_all();
+	if (thread_.joinable()) {
+		thread_.join();
+	}
+}
+
+void CoarseClock::refresh() {
+	Reading reading;
+	if (source_) {
+		reading = source_();
+	} else {
+		reading = {std::chrono::system_clock::now(),
+		           std::chrono::steady_clock::now()};
+	}
+
+	system_.store(reading.system.time_since_epoch().count(),
+	              std::memory_order_relaxed);
+	steady_.store(reading.steady.time_since_epoch().count(),
+	              std::memory_order_relaxed);
+}
+
+void CoarseClock::refreshLoop() {
+	std::unique_lock lock(mtx_);
+	while (!stop_cv_.wait_for(lock, resolution_, [this]() { return stop_; })) {
+		refresh();
+	}
+}
+
+CoarseClock& CoarseClock::global() {
+	// Never destroyed (nor its refresh thread stopped) so that it can still be
+	// read by static objects (e.g. an ExpiryFilter on a transport's receive
+	// thread) during process shutdown.
+	static auto* clock = new CoarseClock();  // NOLINT
+	return *clock;
+}
+
+}  // namespace uprotocol::utils
@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/Metrics.h"
+
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+using uprotocol::utils::metrics::Histogram;
+
+constexpr int64_t NS_PER_US = 1000;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr size_t SECONDS_DECIMALS = 9;
+
+/// @brief Splits "name{labels}" into "name" and "labels".
+std::pair<std::string_view, std::string_view> splitLabels(
+    std::string_view name) {
+	auto open = name.find('{');
+	if ((open == std::string_view::npos) || (name.back() != '}')) {
+		return {name, {}};
+	}
+	return {name.substr(0, open),
+	        name.substr(open + 1, name.size() - open - 2)};
+}
+
+/// @brief Formats a duration as decimal seconds without rounding.
+std::string toSeconds(std::chrono::nanoseconds duration) {
+	const auto ns = duration.count();
+	auto fraction = std::to_string(ns % NS_PER_SECOND);
+	fraction.insert(0, SECONDS_DECIMALS - fraction.size(), '0');
+	return std::to_string(ns / NS_PER_SECOND) + "." + fraction;
+}
+
+std::string withLabels(std::string_view base, std::string_view suffix,
+                       std::string_view labels, std::string_view extra = {}) {
+	std::string out(base);
+	out += suffix;
+	if (!labels.empty() || !extra.empty()) {
+		out += '{';
+		out += labels;
+		if (!labels.empty() && !extra.empty()) {
+			out += ',';
+		}
+		out += extra;
+		out += '}';
+	}
+	return out;
+}
+
+void appendHistogram(std::string& out, std::string_view name,
+                     const Histogram::Snapshot& snapshot) {
+	auto [base, labels] = splitLabels(name);
+	uint64_t cumulative = 0;
+	for (size_t i = 0; i < Histogram::BUCKETS; ++i) {
+		cumulative += snapshot.buckets[i];
+		std::string le = "le=\"";
+		le += (i + 1 < Histogram::BUCKETS)
+		          ? toSeconds(Histogram::upperBound(i))
+		          : std::string("+Inf");
+		le += '"';
+		out += withLabels(base, "_bucket", labels, le) + " " +
+		       std::to_string(cumulative) + "\n";
+	}
+	out += withLabels(base, "_sum", labels) + " " + toSeconds(snapshot.sum) +
+	       "\n";
+	out += withLabels(base, "_count", labels) + " " +
+	       std::to_string(snapshot.count) + "\n";
+}
+
+}  // namespace
+
+namespace uprotocol::utils::metrics {
+
+size_t detail::shardIndex() noexcept {
+	static std::atomic<size_t> next_shard{0};
+	thread_local const size_t shard =
+	    next_shard.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+	return shard;
+}
+
+uint64_t Counter::value() const noexcept {
+	uint64_t total = 0;
+	for (const auto& shard : shards_) {
+		total += shard.value.load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
+void Counter::reset() noexcept {
+	for (auto& shard : shards_) {
+		shard.value.store(0, std::memory_order_relaxed);
+	}
+}
+
+void Histogram::observe(std::chrono::nanoseconds duration) noexcept {
+	auto& shard = shards_[detail::shardIndex()];
+	shard.buckets[bucketFor(duration)].fetch_add(1, std::memory_order_relaxed);
+	shard.count.fetch_add(1, std::memory_order_relaxed);
+	shard.sum_ns.fetch_add(duration.count(), std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::snapshot() const noexcept {
+	Snapshot merged;
+	int64_t sum_ns = 0;
+	for (const auto& shard : shards_) {
+		for (size_t i = 0; i < BUCKETS; ++i) {
+			merged.buckets[i] +=
+			    shard.buckets[i].load(std::memory_order_relaxed);
+		}
+		merged.count += shard.count.load(std::memory_order_relaxed);
+		sum_ns += shard.sum_ns.load(std::memory_order_relaxed);
+	}
+	merged.sum = std::chrono::nanoseconds(sum_ns);
+	return merged;
+}
+
+void Histogram::reset() noexcept {
+	for (auto& shard : shards_) {
+		for (auto& bucket : shard.buckets) {
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		shard.count.store(0, std::memory_order_relaxed);
+		shard.sum_ns.store(0, std::memory_order_relaxed);
+	}
+}
+
+std::chrono::nanoseconds Histogram::upperBound(size_t bucket) noexcept {
+	if (bucket + 1 >= BUCKETS) {
+		return std::chrono::nanoseconds::max();
+	}
+	return std::chrono::nanoseconds(NS_PER_US << bucket);
+}
+
+size_t Histogram::bucketFor(std::chrono::nanoseconds duration) noexcept {
+	if (duration.count() <= NS_PER_US) {
+		return 0;
+	}
+	// Bucket i holds (2^(i-1), 2^i] microseconds, so the bucket is the bit
+	// width of the number of whole microseconds below the duration.
+	auto whole_us = static_cast<uint64_t>((duration.count() - 1) / NS_PER_US);
+	size_t bucket = 0;
+	while ((whole_us != 0) && (bucket + 1 < BUCKETS)) {
+		whole_us >>= 1U;
+		++bucket;
+	}
+	return bucket;
+}
+
+Registry& Registry::global() {
+	// Never destroyed so that metrics can still be updated by static objects
+	// (e.g. the RpcClient expiry worker) during process shutdown.
+	static auto* registry = new Registry();  // NOLINT
+	return *registry;
+}
+
+Counter& Registry::counter(const std::string& name, const std::string& help) {
+	std::lock_guard const lock(mutex_);
+	auto& slot = counters_[name];
+	if (!slot) {
+		addToFamily(name, Type::COUNTER, help);
+		slot = std::make_unique<Counter>();
+	}
+	return *slot;
+}
+
+Gauge& Registry::gauge(const std::string& name, const std::string& help) {
+	std::lock_guard const lock(mutex_);
+	auto& slot = gauges_[name];
+	if (!slot) {
+		addToFamily(name, Type::GAUGE, help);
+		slot = std::make_unique<Gauge>();
+	}
+	return *slot;
+}
+
+Histogram& Registry::histogram(const std::string& name,
+                               const std::string& help) {
+	std::lock_guard const lock(mutex_);
+	auto& slot = histograms_[name];
+	if (!slot) {
+		addToFamily(name, Type::HISTOGRAM, help);
+		slot = std::make_unique<Histogram>();
+	}
+	return *slot;
+}
+
+void Registry::addToFamily(const std::string& name, Type type,
+                           const std::string& help) {
+	std::string base(splitLabels(name).first);
+	auto [family, added] = families_.try_emplace(base, Family{type, help, {}});
+	if (!added && (family->second.type != type)) {
+		// Roll back the empty slot left by the caller's map lookup
+		switch (type) {
+			case Type::COUNTER:
+				counters_.erase(name);
+				break;
+			case Type::GAUGE:
+				gauges_.erase(name);
+				break;
+			case Type::HISTOGRAM:
+				histograms_.erase(name);
+				break;
+		}
+		throw std::invalid_argument(
+		    "Metric is already registered with a different type: " + base);
+	}
+	family->second.members.insert(name);
+}
+
+Registry::Snapshot Registry::snapshot() const {
+	std::lock_guard const lock(mutex_);
+	Snapshot snapshot;
+	for (const auto& [name, counter] : counters_) {
+		snapshot.counters.emplace(name, counter->value());
+	}
+	for (const auto& [name, gauge] : gauges_) {
+		snapshot.gauges.emplace(name, gauge->value());
+	}
+	for (const auto& [name, histogram] : histograms_) {
+		snapshot.histograms.emplace(name, histogram->snapshot());
+	}
+	return snapshot;
+}
+
+std::string Registry::exportText() const {
+	std::lock_guard const lock(mutex_);
+	std::string out;
+	for (const auto& [base, family] : families_) {
+		if (!family.help.empty()) {
+			out += "# HELP " + base + " " + family.help + "\n";
+		}
+		switch (family.type) {
+			case Type::COUNTER:
+				out += "# TYPE " + base + " counter\n";
+				for (const auto& name : family.members) {
+					out += name + " " +
+					       std::to_string(counters_.at(name)->value()) + "\n";
+				}
+				break;
+			case Type::GAUGE:
+				out += "# TYPE " + base + " gauge\n";
+				for (const auto& name : family.members) {
+					out += name + " " +
+					       std::to_string(gauges_.at(name)->value()) + "\n";
+				}
+				break;
+			case Type::HISTOGRAM:
+				out += "# TYPE " + base + " histogram\n";
+				for (const auto& name : family.members) {
+					appendHistogram(out, name,
+					                histograms_.at(name)->snapshot());
+				}
+				break;
+		}
+	}
+	return out;
+}
+
+void Registry::reset() {
+	std::lock_guard const lock(mutex_);
+	for (auto& [name, counter] : counters_) {
+		counter->reset();
+	}
+	for (auto& [name, gauge] : gauges_) {
+		gauge->reset();
+	}
+	for (auto& [name, histogram] : histograms_) {
+		histogram->reset();
+	}
+}
+
+}  // namespace uprotocol::utils::metrics
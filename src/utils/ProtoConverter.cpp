@@ -1,12 +1,48 @@
 #include "up-cpp/utils/ProtoConverter.h"
 
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <spdlog/spdlog.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
+#include <cstring>
 #include <optional>
 
 #include "up-cpp/datamodel/builder/Payload.h"
 #include "up-cpp/utils/Expected.h"
+#include "up-cpp/utils/ProtoReader.h"
+
+namespace {
+
+using google::protobuf::io::CodedOutputStream;
+
+// Same prefix as used by Any::PackFrom()
+constexpr std::string_view ANY_TYPE_URL_PREFIX = "type.googleapis.com/";
+
+// Field tags for Any's members: (field number << 3) | wire type 2
+// (length-delimited)
+constexpr uint32_t WIRETYPE_LENGTH_DELIMITED = 2;
+constexpr uint32_t ANY_TYPE_URL_TAG =
+    (static_cast<uint32_t>(google::protobuf::Any::kTypeUrlFieldNumber) << 3U) |
+    WIRETYPE_LENGTH_DELIMITED;
+constexpr uint32_t ANY_VALUE_TAG =
+    (static_cast<uint32_t>(google::protobuf::Any::kValueFieldNumber) << 3U) |
+    WIRETYPE_LENGTH_DELIMITED;
+
+size_t lengthDelimitedSize(uint32_t tag, size_t length) {
+	return CodedOutputStream::VarintSize32(tag) +
+	       CodedOutputStream::VarintSize32(static_cast<uint32_t>(length)) +
+	       length;
+}
+
+uint8_t* writeLengthDelimitedHeader(uint32_t tag, size_t length,
+                                    uint8_t* target) {
+	target = CodedOutputStream::WriteTagToArray(tag, target);
+	return CodedOutputStream::WriteVarint32ToArray(
+	    static_cast<uint32_t>(length), target);
+}
+
+}  // namespace
 
 namespace uprotocol::utils {
 google::protobuf::Timestamp ProtoConverter::ConvertToProtoTimestamp(
@@ -116,4 +152,61 @@ NotificationsRequest ProtoConverter::BuildNotificationsRequest(
 	return notifications_request;
 }
 
+std::optional<ProtoConverter::AnyFields> ProtoConverter::parseAny(
+    std::string_view serialized) {
+	AnyFields fields;
+	ProtoReader reader(serialized);
+	while (reader.next()) {
+		if (reader.wireType() != ProtoReader::WireType::LENGTH_DELIMITED) {
+			continue;
+		}
+		// As with parsing, the last occurrence of a field wins
+		switch (reader.fieldNumber()) {
+			case google::protobuf::Any::kTypeUrlFieldNumber:
+				fields.type_url = *reader.bytes();
+				break;
+			case google::protobuf::Any::kValueFieldNumber:
+				fields.value = *reader.bytes();
+				break;
+			default:
+				break;
+		}
+	}
+	if (reader.failed()) {
+		return std::nullopt;
+	}
+	return fields;
+}
+
+bool ProtoConverter::anyTypeMatches(std::string_view type_url,
+                                    std::string_view full_name) {
+	return (type_url.size() > full_name.size()) &&
+	       (type_url[type_url.size() - full_name.size() - 1] == '/') &&
+	       (type_url.substr(type_url.size() - full_name.size()) == full_name);
+}
+
+size_t ProtoConverter::writeAnyEnvelope(std::string& out,
+                                        std::string_view full_name,
+                                        size_t value_size) {
+	const size_t type_url_size = ANY_TYPE_URL_PREFIX.size() + full_name.size();
+	size_t total_size = lengthDelimitedSize(ANY_TYPE_URL_TAG, type_url_size);
+	// Like any other proto3 bytes field, an empty value is omitted
+	if (value_size > 0) {
+		total_size += lengthDelimitedSize(ANY_VALUE_TAG, value_size);
+	}
+	out.resize(total_size);
+
+	auto* const begin = reinterpret_cast<uint8_t*>(out.data());
+	auto* target =
+	    writeLengthDelimitedHeader(ANY_TYPE_URL_TAG, type_url_size, begin);
+	std::memcpy(target, ANY_TYPE_URL_PREFIX.data(), ANY_TYPE_URL_PREFIX.size());
+	target += ANY_TYPE_URL_PREFIX.size();
+	std::memcpy(target, full_name.data(), full_name.size());
+	target += full_name.size();
+	if (value_size > 0) {
+		target = writeLengthDelimitedHeader(ANY_VALUE_TAG, value_size, target);
+	}
+	return static_cast<size_t>(target - begin);
+}
+
 }  // namespace uprotocol::utils
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/ProtoReader.h"
+
+#include <limits>
+
+namespace {
+
+constexpr int TAG_TYPE_BITS = 3;
+constexpr uint32_t TAG_TYPE_MASK = (1U << TAG_TYPE_BITS) - 1;
+constexpr int VARINT_PAYLOAD_BITS = 7;
+constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7F;
+constexpr uint8_t VARINT_CONTINUE = 0x80;
+constexpr size_t MAX_VARINT_BYTES = 10;
+constexpr size_t FIXED64_BYTES = 8;
+constexpr size_t FIXED32_BYTES = 4;
+
+}  // namespace
+
+namespace uprotocol::utils {
+
+bool ProtoReader::next() noexcept {
+	if (failed_ || remaining_.empty()) {
+		return false;
+	}
+
+	uint64_t tag = 0;
+	if (!readVarint(tag) || (tag > std::numeric_limits<uint32_t>::max())) {
+		return fail();
+	}
+	field_number_ = static_cast<uint32_t>(tag >> TAG_TYPE_BITS);
+	if (field_number_ == 0) {
+		return fail();
+	}
+
+	size_t length = 0;
+	switch (static_cast<uint32_t>(tag) & TAG_TYPE_MASK) {
+		case static_cast<uint32_t>(WireType::VARINT):
+			wire_type_ = WireType::VARINT;
+			return readVarint(varint_) || fail();
+
+		case static_cast<uint32_t>(WireType::FIXED64):
+			wire_type_ = WireType::FIXED64;
+			length = FIXED64_BYTES;
+			break;
+
+		case static_cast<uint32_t>(WireType::LENGTH_DELIMITED): {
+			wire_type_ = WireType::LENGTH_DELIMITED;
+			uint64_t encoded_length = 0;
+			if (!readVarint(encoded_length) ||
+			    (encoded_length > remaining_.size())) {
+				return fail();
+			}
+			length = static_cast<size_t>(encoded_length);
+			break;
+		}
+
+		case static_cast<uint32_t>(WireType::FIXED32):
+			wire_type_ = WireType::FIXED32;
+			length = FIXED32_BYTES;
+			break;
+
+		default:
+			return fail();
+	}
+
+	if (length > remaining_.size()) {
+		return fail();
+	}
+	bytes_ = remaining_.substr(0, length);
+	remaining_.remove_prefix(length);
+	return true;
+}
+
+std::optional<uint64_t> ProtoReader::varint() const noexcept {
+	if (wire_type_ != WireType::VARINT) {
+		return std::nullopt;
+	}
+	return varint_;
+}
+
+std::optional<std::string_view> ProtoReader::bytes() const noexcept {
+	if (wire_type_ != WireType::LENGTH_DELIMITED) {
+		return std::nullopt;
+	}
+	return bytes_;
+}
+
+std::optional<std::string_view> ProtoReader::findBytes(
+    std::string_view serialized, uint32_t field_number) noexcept {
+	std::optional<std::string_view> found;
+	ProtoReader reader(serialized);
+	while (reader.next()) {
+		if ((reader.fieldNumber() == field_number) &&
+		    (reader.wireType() == WireType::LENGTH_DELIMITED)) {
+			found = reader.bytes();
+		}
+	}
+	if (reader.failed()) {
+		return std::nullopt;
+	}
+	return found;
+}
+
+bool ProtoReader::readVarint(uint64_t& value) noexcept {
+	value = 0;
+	for (size_t i = 0; (i < MAX_VARINT_BYTES) && (i < remaining_.size());
+	     ++i) {
+		const auto byte = static_cast<uint8_t>(remaining_[i]);
+		value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK)
+		         << (i * VARINT_PAYLOAD_BITS);
+		if ((byte & VARINT_CONTINUE) == 0) {
+			remaining_.remove_prefix(i + 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ProtoReader::fail() noexcept {
+	failed_ = true;
+	remaining_ = {};
+	return false;
+}
+
+}  // namespace uprotocol::utils
@@ -0,0 +1,453 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/SharedMemory.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using uprotocol::utils::ShmDescriptor;
+
+constexpr std::string_view DESCRIPTOR_MAGIC = "uPSM";
+constexpr uint8_t DESCRIPTOR_VERSION = 1;
+constexpr size_t MAX_NAME_LENGTH = 255;
+constexpr size_t FIELD_SIZE = sizeof(uint64_t);
+constexpr size_t BITS_PER_BYTE = 8;
+
+constexpr uint32_t SEGMENT_MAGIC = 0x7550534D;  // "uPSM"
+constexpr uint32_t SEGMENT_VERSION = 1;
+
+// Placed at the start of every segment. The data region begins on the
+// following page so that receivers can map it separately, read-only.
+struct SegmentHeader {
+	uint32_t magic{SEGMENT_MAGIC};
+	uint32_t version{SEGMENT_VERSION};
+	std::atomic<uint64_t> generation{1};
+	std::atomic<uint32_t> refs{1};
+	uint64_t capacity{0};
+};
+
+// The header is shared between processes, so its atomics must not rely on
+// process-local locks.
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+size_t pageSize() {
+	static const auto PAGE_SIZE = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	return PAGE_SIZE;
+}
+
+size_t roundUpToPage(size_t size) {
+	const auto page = pageSize();
+	return ((size + page - 1) / page) * page;
+}
+
+void appendBigEndian(std::string& out, uint64_t value) {
+	for (size_t i = FIELD_SIZE; i > 0; --i) {
+		out.push_back(static_cast<char>(value >> ((i - 1) * BITS_PER_BYTE)));
+	}
+}
+
+uint64_t readBigEndian(std::string_view in) {
+	uint64_t value = 0;
+	for (size_t i = 0; i < FIELD_SIZE; ++i) {
+		value = (value << BITS_PER_BYTE) | static_cast<uint8_t>(in[i]);
+	}
+	return value;
+}
+
+[[noreturn]] void throwErrno(const char* what) {
+	throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace
+
+namespace uprotocol::utils {
+
+////////////////////////////////////////////////////////////////////////////
+// ShmDescriptor
+
+std::string ShmDescriptor::serialize() const {
+	if (name.size() > MAX_NAME_LENGTH) {
+		throw std::length_error("Shared memory segment name is too long");
+	}
+	std::string out;
+	out.reserve(DESCRIPTOR_MAGIC.size() + 2 + name.size() + 3 * FIELD_SIZE);
+	out.append(DESCRIPTOR_MAGIC);
+	out.push_back(static_cast<char>(DESCRIPTOR_VERSION));
+	out.push_back(static_cast<char>(name.size()));
+	out.append(name);
+	appendBigEndian(out, generation);
+	appendBigEndian(out, offset);
+	appendBigEndian(out, length);
+	return out;
+}
+
+Expected<ShmDescriptor, ShmDescriptor::ParseError> ShmDescriptor::deserialize(
+    std::string_view bytes) {
+	using DescriptorOrError = Expected<ShmDescriptor, ParseError>;
+
+	if (bytes.substr(0, DESCRIPTOR_MAGIC.size()) != DESCRIPTOR_MAGIC) {
+		return DescriptorOrError(Unexpected<ParseError>(ParseError::BAD_MAGIC));
+	}
+	bytes.remove_prefix(DESCRIPTOR_MAGIC.size());
+
+	if (bytes.size() < 2) {
+		return DescriptorOrError(
+		    Unexpected<ParseError>(ParseError::WRONG_LENGTH));
+	}
+	if (static_cast<uint8_t>(bytes[0]) != DESCRIPTOR_VERSION) {
+		return DescriptorOrError(
+		    Unexpected<ParseError>(ParseError::BAD_VERSION));
+	}
+	const auto name_length = static_cast<uint8_t>(bytes[1]);
+	bytes.remove_prefix(2);
+
+	if (bytes.size() != name_length + 3 * FIELD_SIZE) {
+		return DescriptorOrError(
+		    Unexpected<ParseError>(ParseError::WRONG_LENGTH));
+	}
+
+	ShmDescriptor descriptor;
+	descriptor.name = bytes.substr(0, name_length);
+	bytes.remove_prefix(name_length);
+	descriptor.generation = readBigEndian(bytes);
+	descriptor.offset = readBigEndian(bytes.substr(FIELD_SIZE));
+	descriptor.length = readBigEndian(bytes.substr(2 * FIELD_SIZE));
+	return DescriptorOrError(std::move(descriptor));
+}
+
+std::string_view message(ShmDescriptor::ParseError error) {
+	switch (error) {
+		case ShmDescriptor::ParseError::BAD_MAGIC:
+			return "Data is not a shared memory descriptor";
+		case ShmDescriptor::ParseError::BAD_VERSION:
+			return "Shared memory descriptor version is not supported";
+		case ShmDescriptor::ParseError::WRONG_LENGTH:
+			return "Shared memory descriptor has the wrong length";
+		default:
+			return "Unknown error.";
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+// ShmSegment
+
+// A segment created by a ShmPool, mapped read-write into this process.
+// Unlinked once neither the pool nor any ShmSegment handle references it.
+struct ShmSegment::State {
+	std::string name;
+	uint8_t* base{nullptr};
+	size_t mapped_size{0};
+
+	State(std::string segment_name, uint8_t* segment_base, size_t size)
+	    : name(std::move(segment_name)),
+	      base(segment_base),
+	      mapped_size(size) {}
+
+	State(const State&) = delete;
+	State& operator=(const State&) = delete;
+
+	~State() {
+		munmap(base, mapped_size);
+		shm_unlink(name.c_str());
+	}
+
+	[[nodiscard]] SegmentHeader& header() const {
+		return *std::launder(reinterpret_cast<SegmentHeader*>(base));
+	}
+
+	[[nodiscard]] uint8_t* data() const { return base + pageSize(); }
+};
+
+ShmSegment::ShmSegment(std::shared_ptr<State> state)
+    : state_(std::move(state)) {}
+
+ShmSegment::ShmSegment(ShmSegment&& other) noexcept = default;
+
+ShmSegment& ShmSegment::operator=(ShmSegment&& other) noexcept {
+	if (this != &other) {
+		if (state_) {
+			state_->header().refs.fetch_sub(1);
+		}
+		state_ = std::move(other.state_);
+	}
+	return *this;
+}
+
+ShmSegment::~ShmSegment() {
+	if (state_) {
+		state_->header().refs.fetch_sub(1);
+	}
+}
+
+Span<uint8_t> ShmSegment::data() const {
+	return {state_->data(), capacity()};
+}
+
+size_t ShmSegment::capacity() const { return state_->header().capacity; }
+
+ShmDescriptor ShmSegment::describe(size_t length, size_t offset) const {
+	if ((offset > capacity()) || (length > capacity() - offset)) {
+		throw std::out_of_range("Range extends past end of shared memory");
+	}
+	ShmDescriptor descriptor;
+	descriptor.name = state_->name;
+	descriptor.generation = state_->header().generation.load();
+	descriptor.offset = offset;
+	descriptor.length = length;
+	return descriptor;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// ShmPool
+
+struct ShmPool::Impl {
+	std::string prefix;
+	mutable std::mutex mutex;
+	std::vector<std::shared_ptr<ShmSegment::State>> segments;
+	size_t next_id{0};
+
+	// Claims a released segment. The generation is advanced before the
+	// reference is taken: a receiver that takes a reference after the
+	// advance will see the new generation and back out, and one that takes a
+	// reference before the claim will make the claim fail.
+	static bool tryClaim(ShmSegment::State& state) {
+		auto& header = state.header();
+		if (header.refs.load() != 0) {
+			return false;
+		}
+		header.generation.fetch_add(1);
+		uint32_t expected = 0;
+		return header.refs.compare_exchange_strong(expected, 1);
+	}
+
+	std::shared_ptr<ShmSegment::State> create(size_t size) {
+		const auto capacity = roundUpToPage(size == 0 ? 1 : size);
+		const auto mapped_size = pageSize() + capacity;
+		auto name = "/" + prefix + "-" + std::to_string(getpid()) + "-" +
+		            std::to_string(next_id++);
+
+		const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+		                        S_IRUSR | S_IWUSR);
+		if (fd < 0) {
+			throwErrno("shm_open");
+		}
+		if (ftruncate(fd, static_cast<off_t>(mapped_size)) != 0) {
+			const int error = errno;
+			close(fd);
+			shm_unlink(name.c_str());
+			throw std::system_error(error, std::generic_category(),
+			                        "ftruncate");
+		}
+		void* base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+		                  MAP_SHARED, fd, 0);
+		close(fd);
+		if (base == MAP_FAILED) {
+			const int error = errno;
+			shm_unlink(name.c_str());
+			throw std::system_error(error, std::generic_category(), "mmap");
+		}
+
+		auto* header = new (base) SegmentHeader;
+		header->capacity = capacity;
+		return std::make_shared<ShmSegment::State>(
+		    std::move(name), static_cast<uint8_t*>(base), mapped_size);
+	}
+};
+
+ShmPool::ShmPool(std::string prefix) : impl_(std::make_unique<Impl>()) {
+	// Leaves room for "/" and "-<pid>-<n>" within MAX_NAME_LENGTH
+	constexpr size_t MAX_PREFIX_LENGTH = 200;
+	if (prefix.empty() || (prefix.size() > MAX_PREFIX_LENGTH) ||
+	    (prefix.find('/') != std::string::npos)) {
+		throw std::invalid_argument("Invalid shared memory pool prefix");
+	}
+	impl_->prefix = std::move(prefix);
+}
+
+ShmPool::~ShmPool() = default;
+
+ShmSegment ShmPool::allocate(size_t size) {
+	std::lock_guard const lock(impl_->mutex);
+	for (const auto& state : impl_->segments) {
+		if ((state->header().capacity >= size) && Impl::tryClaim(*state)) {
+			return ShmSegment(state);
+		}
+	}
+	auto state = impl_->create(size);
+	impl_->segments.push_back(state);
+	return ShmSegment(std::move(state));
+}
+
+size_t ShmPool::size() const {
+	std::lock_guard const lock(impl_->mutex);
+	return impl_->segments.size();
+}
+
+////////////////////////////////////////////////////////////////////////////
+// ShmView
+
+// A receiver's mappings of a segment: the header read-write (to maintain the
+// reference count) and the data region read-only.
+struct ShmView::Mapping {
+	void* header{MAP_FAILED};
+	const void* data{MAP_FAILED};
+	size_t data_size{0};
+	bool holds_ref{false};
+
+	Mapping() = default;
+	Mapping(const Mapping&) = delete;
+	Mapping& operator=(const Mapping&) = delete;
+
+	~Mapping() {
+		if (holds_ref) {
+			segmentHeader().refs.fetch_sub(1);
+		}
+		if (data != MAP_FAILED) {
+			// munmap() does not modify the data, but takes a non-const pointer
+			munmap(const_cast<void*>(data), data_size);  // NOLINT
+		}
+		if (header != MAP_FAILED) {
+			munmap(header, pageSize());
+		}
+	}
+
+	[[nodiscard]] SegmentHeader& segmentHeader() const {
+		return *std::launder(reinterpret_cast<SegmentHeader*>(header));
+	}
+};
+
+ShmView::ShmView(std::unique_ptr<Mapping> mapping, Span<const uint8_t> data)
+    : mapping_(std::move(mapping)), data_(data) {}
+
+ShmView::ShmView(ShmView&&) noexcept = default;
+ShmView& ShmView::operator=(ShmView&&) noexcept = default;
+ShmView::~ShmView() = default;
+
+ShmView::ViewOrError ShmView::open(const ShmDescriptor& descriptor) {
+	auto mapping = std::make_unique<Mapping>();
+
+	const int fd = shm_open(descriptor.name.c_str(), O_RDWR, 0);
+	if (fd < 0) {
+		return ViewOrError(Unexpected<OpenError>(OpenError::UNAVAILABLE));
+	}
+
+	struct stat info {};
+	if ((fstat(fd, &info) != 0) ||
+	    (static_cast<size_t>(info.st_size) <= pageSize())) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::UNAVAILABLE));
+	}
+
+	mapping->header = mmap(nullptr, pageSize(), PROT_READ | PROT_WRITE,
+	                       MAP_SHARED, fd, 0);
+	if (mapping->header == MAP_FAILED) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::UNAVAILABLE));
+	}
+
+	auto& header = mapping->segmentHeader();
+	if ((header.magic != SEGMENT_MAGIC) ||
+	    (header.version != SEGMENT_VERSION)) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::UNAVAILABLE));
+	}
+
+	// Take the reference before checking the generation. See
+	// ShmPool::Impl::tryClaim() for the other half of this handshake.
+	header.refs.fetch_add(1);
+	mapping->holds_ref = true;
+	if (header.generation.load() != descriptor.generation) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::STALE));
+	}
+
+	// The capacity comes from the writer, so it must not be trusted to fit
+	// within the segment. Reading past the end would raise SIGBUS.
+	const auto capacity = header.capacity;
+	const auto file_capacity = static_cast<size_t>(info.st_size) - pageSize();
+	if (capacity > file_capacity) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::OUT_OF_RANGE));
+	}
+	if ((descriptor.offset > capacity) ||
+	    (descriptor.length > capacity - descriptor.offset)) {
+		close(fd);
+		return ViewOrError(Unexpected<OpenError>(OpenError::OUT_OF_RANGE));
+	}
+
+	mapping->data_size = capacity;
+	mapping->data = mmap(nullptr, capacity, PROT_READ, MAP_SHARED, fd,
+	                     static_cast<off_t>(pageSize()));
+	close(fd);
+	if (mapping->data == MAP_FAILED) {
+		return ViewOrError(Unexpected<OpenError>(OpenError::UNAVAILABLE));
+	}
+
+	Span<const uint8_t> data(
+	    static_cast<const uint8_t*>(mapping->data) + descriptor.offset,
+	    descriptor.length);
+	return ViewOrError(ShmView(std::move(mapping), data));
+}
+
+ShmView::ViewOrError ShmView::open(const v1::UMessage& message) {
+	if (message.attributes().payload_format() !=
+	    v1::UPayloadFormat::UPAYLOAD_FORMAT_SHM) {
+		return ViewOrError(Unexpected<OpenError>(OpenError::WRONG_FORMAT));
+	}
+	auto descriptor = ShmDescriptor::deserialize(message.payload());
+	if (!descriptor) {
+		return ViewOrError(Unexpected<OpenError>(OpenError::BAD_DESCRIPTOR));
+	}
+	return open(*descriptor);
+}
+
+Span<const uint8_t> ShmView::data() const { return data_; }
+
+std::string_view ShmView::view() const {
+	return {reinterpret_cast<const char*>(data_.data()), data_.size()};
+}
+
+std::string_view message(ShmView::OpenError error) {
+	switch (error) {
+		case ShmView::OpenError::WRONG_FORMAT:
+			return "Message payload format is not UPAYLOAD_FORMAT_SHM";
+		case ShmView::OpenError::BAD_DESCRIPTOR:
+			return "Message payload is not a shared memory descriptor";
+		case ShmView::OpenError::UNAVAILABLE:
+			return "Shared memory segment does not exist or could not be "
+			       "mapped";
+		case ShmView::OpenError::STALE:
+			return "Shared memory segment has been reused since the "
+			       "descriptor was created";
+		case ShmView::OpenError::OUT_OF_RANGE:
+			return "Described range extends past the end of the shared "
+			       "memory segment";
+		default:
+			return "Unknown error.";
+	}
+}
+
+}  // namespace uprotocol::utils
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/Tracing.h"
+
+#include <stdexcept>
+
+namespace {
+
+// Accessed with the std::atomic_* shared_ptr functions only
+std::shared_ptr<uprotocol::utils::tracing::Sink> installed_sink;  // NOLINT
+
+}  // namespace
+
+namespace uprotocol::utils::tracing {
+
+std::string_view name(Probe probe) {
+	switch (probe) {
+		case Probe::BUILT:
+			return "BUILT";
+		case Probe::VALIDATED:
+			return "VALIDATED";
+		case Probe::SENT:
+			return "SENT";
+		case Probe::RECEIVED:
+			return "RECEIVED";
+		case Probe::DISPATCHED:
+			return "DISPATCHED";
+		case Probe::RPC_COMPLETED:
+			return "RPC_COMPLETED";
+		case Probe::RPC_EXPIRED:
+			return "RPC_EXPIRED";
+		default:
+			return "UNKNOWN";
+	}
+}
+
+void setSink(std::shared_ptr<Sink> sink) {
+	const bool active = static_cast<bool>(sink);
+	std::atomic_store(&installed_sink, std::move(sink));
+	detail::active.store(active, std::memory_order_relaxed);
+}
+
+std::shared_ptr<Sink> getSink() { return std::atomic_load(&installed_sink); }
+
+void detail::emit(Probe probe, const v1::UUID& id, v1::UCode code) {
+	auto sink = std::atomic_load(&installed_sink);
+	if (!sink) {
+		return;
+	}
+	Event event;
+	event.probe = probe;
+	event.id = id;
+	event.when = std::chrono::steady_clock::now();
+	event.code = code;
+	sink->record(event);
+}
+
+RingBufferSink::RingBufferSink(size_t capacity) : capacity_(capacity) {
+	if (capacity == 0) {
+		throw std::invalid_argument("RingBufferSink capacity cannot be zero");
+	}
+	events_.reserve(capacity);
+}
+
+void RingBufferSink::record(const Event& event) {
+	std::lock_guard const lock(mutex_);
+	if (events_.size() < capacity_) {
+		events_.push_back(event);
+	} else {
+		events_[next_] = event;
+	}
+	next_ = (next_ + 1) % capacity_;
+	++recorded_;
+}
+
+std::vector<Event> RingBufferSink::events() const {
+	std::lock_guard const lock(mutex_);
+	std::vector<Event> ordered;
+	ordered.reserve(events_.size());
+	if (events_.size() == capacity_) {
+		const auto oldest = events_.begin() + static_cast<ptrdiff_t>(next_);
+		ordered.insert(ordered.end(), oldest, events_.end());
+		ordered.insert(ordered.end(), events_.begin(), oldest);
+	} else {
+		ordered = events_;
+	}
+	return ordered;
+}
+
+size_t RingBufferSink::overwritten() const {
+	std::lock_guard const lock(mutex_);
+	return recorded_ - events_.size();
+}
+
+void RingBufferSink::clear() {
+	std::lock_guard const lock(mutex_);
+	events_.clear();
+	next_ = 0;
+	recorded_ = 0;
+}
+
+}  // namespace uprotocol::utils::tracing
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/communication/ExpiryFilter.h>
+#include <up-cpp/communication/NotificationSink.h>
+#include <up-cpp/communication/RpcServer.h>
+#include <up-cpp/communication/Subscriber.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "UTransportMock.h"
+
+namespace {
+
+using uprotocol::communication::ExpiryFilter;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::test::UTransportMock;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPriority;
+using uprotocol::v1::UUri;
+
+constexpr std::chrono::milliseconds SHORT_TTL(1);
+
+class ExpiryFilterTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		transport_ = std::make_shared<UTransportMock>(getEntity());
+	}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	ExpiryFilterTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getEntity() {
+		UUri uri;
+		uri.set_authority_name("expiry-test");
+		uri.set_ue_id(0x10001);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(0);
+		return uri;
+	}
+
+	static UUri getRemote(uint32_t resource_id) {
+		UUri uri;
+		uri.set_authority_name("expiry-test");
+		uri.set_ue_id(0x10002);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	// Publishes with a TTL that has already elapsed
+	static UMessage expiredPublish() {
+		auto message = UMessageBuilder::publish(getRemote(0x8001))
+		                   .withTtl(SHORT_TTL)
+		                   .build();
+		std::this_thread::sleep_for(SHORT_TTL * 5);
+		return message;
+	}
+
+	std::shared_ptr<UTransportMock> transport_;
+
+public:
+	~ExpiryFilterTest() override = default;
+};
+
+TEST_F(ExpiryFilterTest, DropsOnlyExpired) {  // NOLINT
+	ExpiryFilter filter;
+	size_t delivered = 0;
+	auto listener = filter.wrap([&delivered](const UMessage&) { ++delivered; });
+
+	// No TTL, never expires
+	listener(UMessageBuilder::publish(getRemote(0x8001)).build());
+	// TTL not yet elapsed
+	listener(UMessageBuilder::publish(getRemote(0x8001))
+	             .withTtl(std::chrono::minutes(1))
+	             .build());
+	EXPECT_EQ(delivered, 2);
+	EXPECT_EQ(filter.dropped(), 0);
+
+	auto expired = expiredPublish();
+	EXPECT_TRUE(ExpiryFilter::isExpired(expired));
+	listener(expired);
+	EXPECT_EQ(delivered, 2);
+	EXPECT_EQ(filter.dropped(), 1);
+
+	// Copies share the count; separate filters do not
+	auto copy = filter;
+	EXPECT_TRUE(copy.drop(expired));
+	EXPECT_EQ(filter.dropped(), 2);
+	EXPECT_EQ(ExpiryFilter().dropped(), 0);
+
+	// Empty listeners stay empty
+	EXPECT_FALSE(filter.wrap(std::function<void(const UMessage&)>{}));
+}
+
+TEST_F(ExpiryFilterTest, Subscriber) {  // NOLINT
+	size_t delivered = 0;
+	auto subscriber = uprotocol::communication::Subscriber::subscribe(
+	    transport_, getRemote(0x8001),
+	    [&delivered](const UMessage&) { ++delivered; });
+	ASSERT_TRUE(subscriber);
+
+	transport_->mockMessage(
+	    UMessageBuilder::publish(getRemote(0x8001)).build());
+	transport_->mockMessage(expiredPublish());
+	EXPECT_EQ(delivered, 1);
+	EXPECT_EQ(subscriber.value()->expiredDropped(), 1);
+}
+
+TEST_F(ExpiryFilterTest, NotificationSink) {  // NOLINT
+	size_t delivered = 0;
+	auto sink = uprotocol::communication::NotificationSink::create(
+	    transport_, [&delivered](const UMessage&) { ++delivered; },
+	    getRemote(0x8001));
+	ASSERT_TRUE(sink);
+
+	auto notification =
+	    UMessageBuilder::notification(getRemote(0x8001), getEntity())
+	        .withTtl(SHORT_TTL)
+	        .build();
+	std::this_thread::sleep_for(SHORT_TTL * 5);
+	transport_->mockMessage(notification);
+	EXPECT_EQ(delivered, 0);
+	EXPECT_EQ(sink.value()->expiredDropped(), 1);
+}
+
+TEST_F(ExpiryFilterTest, RpcServer) {  // NOLINT
+	constexpr uint32_t METHOD_ID = 0x0101;
+	auto method = getEntity();
+	method.set_resource_id(METHOD_ID);
+
+	size_t handled = 0;
+	auto server = uprotocol::communication::RpcServer::create(
+	    transport_, method, [&handled](const UMessage&) {
+		    ++handled;
+		    return std::nullopt;
+	    });
+	ASSERT_TRUE(server);
+
+	auto request = UMessageBuilder::request(UUri(method), getRemote(0),
+	                                        UPriority::UPRIORITY_CS4,
+	                                        SHORT_TTL)
+	                   .build();
+	std::this_thread::sleep_for(SHORT_TTL * 5);
+	transport_->mockMessage(request);
+
+	// No work done and no response sent
+	EXPECT_EQ(handled, 0);
+	EXPECT_EQ(transport_->getSendCount(), 0);
+	EXPECT_EQ(server.value()->expiredDropped(), 1);
+}
+
+}  // namespace
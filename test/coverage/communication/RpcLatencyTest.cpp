@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/RpcLatency.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/serializer/UUri.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+#include "UTransportMock.h"
+
+namespace {
+
+using uprotocol::communication::RpcCallTiming;
+using uprotocol::communication::RpcClient;
+using uprotocol::communication::RpcLatencyRecorder;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::test::UTransportMock;
+using uprotocol::v1::UCode;
+using uprotocol::v1::UUri;
+using Stage = RpcLatencyRecorder::Stage;
+using UriSerializer = uprotocol::datamodel::serializer::uri::AsString;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+class RpcLatencyTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	RpcLatencyTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getEntity() {
+		UUri uri;
+		uri.set_authority_name("latency-test");
+		uri.set_ue_id(0x10001);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(0);
+		return uri;
+	}
+
+	static UUri getMethod(uint32_t resource_id = 0x0101) {
+		UUri method;
+		method.set_authority_name("latency-test");
+		method.set_ue_id(0x10002);
+		method.set_ue_version_major(1);
+		method.set_resource_id(resource_id);
+		return method;
+	}
+
+	// Builds a timing where each stage takes the given number of
+	// microseconds
+	static RpcCallTiming makeTiming(const UUri& method, int64_t build,
+	                                int64_t send, int64_t wait,
+	                                int64_t callback) {
+		RpcCallTiming timing;
+		timing.method = method;
+		timing.build = std::chrono::steady_clock::now();
+		timing.send_start = timing.build + microseconds(build);
+		timing.send_end = timing.send_start + microseconds(send);
+		timing.response = timing.send_end + microseconds(wait);
+		timing.callback_done = timing.response + microseconds(callback);
+		return timing;
+	}
+
+public:
+	~RpcLatencyTest() override = default;
+};
+
+// Delivers the response to each request from within send(), as a loopback
+// or synchronous transport might
+class InlineResponseTransport : public UTransportMock {
+public:
+	using UTransportMock::UTransportMock;
+
+private:
+	[[nodiscard]] uprotocol::v1::UStatus sendImpl(
+	    const uprotocol::v1::UMessage& message) override {
+		mockMessage(UMessageBuilder::response(message).build());
+		uprotocol::v1::UStatus status;
+		status.set_code(UCode::OK);
+		return status;
+	}
+};
+
+TEST_F(RpcLatencyTest, AggregatesPerMethod) {  // NOLINT
+	RpcLatencyRecorder recorder(milliseconds(1));
+	recorder.record(makeTiming(getMethod(), 1, 2, 3, 4));
+	recorder.record(makeTiming(getMethod(), 1, 2, 3, 4));
+	auto failed = makeTiming(getMethod(0x0102), 1, 1, 1, 1);
+	failed.code = UCode::DEADLINE_EXCEEDED;
+	recorder.record(failed);
+
+	auto stats = recorder.methodStats();
+	ASSERT_EQ(stats.size(), 2);
+
+	const auto& first = stats.at(UriSerializer::serialize(getMethod()));
+	EXPECT_EQ(first.calls, 2);
+	EXPECT_EQ(first.failed, 0);
+	EXPECT_EQ(first[Stage::BUILD].sum, microseconds(2));
+	EXPECT_EQ(first[Stage::SEND].sum, microseconds(4));
+	EXPECT_EQ(first[Stage::WAIT].sum, microseconds(6));
+	EXPECT_EQ(first[Stage::CALLBACK].sum, microseconds(8));
+	EXPECT_EQ(first[Stage::TOTAL].sum, microseconds(20));
+	EXPECT_EQ(first[Stage::TOTAL].count, 2);
+
+	const auto& second = stats.at(UriSerializer::serialize(getMethod(0x0102)));
+	EXPECT_EQ(second.calls, 1);
+	EXPECT_EQ(second.failed, 1);
+
+	// None of these reached the slow call threshold
+	EXPECT_TRUE(recorder.slowCalls().empty());
+
+	recorder.reset();
+	stats = recorder.methodStats();
+	EXPECT_EQ(stats.at(UriSerializer::serialize(getMethod())).calls, 0);
+}
+
+TEST_F(RpcLatencyTest, SlowCallRing) {  // NOLINT
+	constexpr size_t CAPACITY = 2;
+	RpcLatencyRecorder recorder(microseconds(10), CAPACITY);
+
+	// Total of 10us meets the threshold; 9us does not
+	recorder.record(makeTiming(getMethod(1), 1, 1, 4, 4));
+	recorder.record(makeTiming(getMethod(2), 1, 1, 3, 4));
+	recorder.record(makeTiming(getMethod(3), 1, 1, 4, 4));
+	recorder.record(makeTiming(getMethod(4), 0, 0, 100, 0));
+
+	auto slow = recorder.slowCalls();
+	ASSERT_EQ(slow.size(), CAPACITY);
+	EXPECT_EQ(slow[0].method.resource_id(), 3);
+	EXPECT_EQ(slow[1].method.resource_id(), 4);
+	EXPECT_EQ(slow[1].total(), microseconds(100));
+
+	recorder.reset();
+	EXPECT_TRUE(recorder.slowCalls().empty());
+
+	EXPECT_THROW(RpcLatencyRecorder(milliseconds(1), 0), std::invalid_argument);
+}
+
+TEST_F(RpcLatencyTest, RecordsClientCalls) {  // NOLINT
+	auto transport = std::make_shared<UTransportMock>(getEntity());
+	transport->getSendStatus().set_code(UCode::OK);
+	auto recorder = std::make_shared<RpcLatencyRecorder>(milliseconds(0));
+
+	RpcClient client(transport, uprotocol::v1::UPriority::UPRIORITY_CS4,
+	                 milliseconds(10));
+	EXPECT_FALSE(client.latencyRecorder());
+	client.setLatencyRecorder(recorder);
+	EXPECT_EQ(client.latencyRecorder(), recorder);
+
+	{
+		auto invoked = client.invokeMethod(getMethod());
+		const auto request = transport->getMessage();
+		transport->mockMessage(UMessageBuilder::response(request).build());
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+		EXPECT_TRUE(invoked.get());
+
+		auto slow = recorder->slowCalls();
+		ASSERT_EQ(slow.size(), 1);
+		EXPECT_EQ(slow[0].method.resource_id(), getMethod().resource_id());
+		EXPECT_EQ(slow[0].request_id.lsb(), request.attributes().id().lsb());
+		EXPECT_EQ(slow[0].code, UCode::OK);
+		EXPECT_LE(slow[0].build, slow[0].send_start);
+		EXPECT_LE(slow[0].send_start, slow[0].send_end);
+		EXPECT_LE(slow[0].send_end, slow[0].response);
+		EXPECT_LE(slow[0].response, slow[0].callback_done);
+	}
+
+	{
+		auto invoked = client.invokeMethod(getMethod());
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+		EXPECT_FALSE(invoked.get());
+
+		auto slow = recorder->slowCalls();
+		ASSERT_EQ(slow.size(), 2);
+		EXPECT_EQ(slow[1].code, UCode::DEADLINE_EXCEEDED);
+		EXPECT_GE(slow[1].response - slow[1].send_end, milliseconds(9));
+	}
+
+	transport->getSendStatus().set_code(UCode::UNAVAILABLE);
+	std::ignore = client.invokeMethod(getMethod());
+
+	auto stats = recorder->methodStats();
+	const auto& method = stats.at(UriSerializer::serialize(getMethod()));
+	EXPECT_EQ(method.calls, 3);
+	EXPECT_EQ(method.failed, 2);
+
+	// Calls made without a recorder are not recorded
+	client.setLatencyRecorder(nullptr);
+	transport->getSendStatus().set_code(UCode::OK);
+	std::ignore = client.invokeMethod(getMethod());
+	EXPECT_EQ(recorder->slowCalls().size(), 3);
+}
+
+TEST_F(RpcLatencyTest, RecordsResponseDuringSend) {  // NOLINT
+	auto transport = std::make_shared<InlineResponseTransport>(getEntity());
+	auto recorder = std::make_shared<RpcLatencyRecorder>(milliseconds(0));
+
+	RpcClient client(transport, uprotocol::v1::UPriority::UPRIORITY_CS4,
+	                 std::chrono::seconds(10));
+	client.setLatencyRecorder(recorder);
+
+	auto invoked = client.invokeMethod(getMethod());
+	ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+	          std::future_status::ready);
+	EXPECT_TRUE(invoked.get());
+
+	// Not recorded until send() has returned, and the send is considered
+	// to have ended when the response arrived
+	auto slow = recorder->slowCalls();
+	ASSERT_EQ(slow.size(), 1);
+	EXPECT_EQ(slow[0].code, UCode::OK);
+	EXPECT_LE(slow[0].build, slow[0].send_start);
+	EXPECT_LE(slow[0].send_start, slow[0].send_end);
+	EXPECT_EQ(slow[0].send_end, slow[0].response);
+	EXPECT_LE(slow[0].response, slow[0].callback_done);
+
+	auto stats = recorder->methodStats();
+	const auto& method = stats.at(UriSerializer::serialize(getMethod()));
+	EXPECT_EQ(method.calls, 1);
+	EXPECT_EQ(method[Stage::WAIT].sum, microseconds(0));
+	EXPECT_GE(method[Stage::SEND].sum, microseconds(0));
+}
+
+}  // namespace
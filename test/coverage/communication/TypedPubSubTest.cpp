@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <google/protobuf/any.pb.h>
+#include <gtest/gtest.h>
+#include <up-cpp/communication/TypedPublisher.h>
+#include <up-cpp/communication/TypedSubscriber.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <uprotocol/v1/uri.pb.h>
+
+#include <vector>
+
+#include "UTransportMock.h"
+
+namespace {
+
+using uprotocol::communication::TypedPublisher;
+using uprotocol::communication::TypedSubscriber;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::datamodel::serializer::protobuf::AsAny;
+using uprotocol::test::UTransportMock;
+using uprotocol::v1::UAttributes;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UPriority;
+using uprotocol::v1::UUri;
+
+class TypedPubSubTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		UUri source;
+		source.set_authority_name("10.0.0.1");
+		source.set_ue_id(0x00011101);
+		source.set_ue_version_major(0xF1);
+		source.set_resource_id(0x0);
+		transport_ = std::make_shared<UTransportMock>(source);
+	}
+
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TypedPubSubTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getTopic() {
+		UUri topic;
+		topic.set_authority_name("10.0.0.1");
+		topic.set_ue_id(0x00011101);
+		topic.set_ue_version_major(0xF8);
+		topic.set_resource_id(0x8101);
+		return topic;
+	}
+
+	static UUri getValue(const std::string& authority) {
+		UUri value;
+		value.set_authority_name(authority);
+		value.set_ue_id(0x1234);
+		return value;
+	}
+
+	static UMessage makeMessage(UPayloadFormat format,
+	                            const std::string& payload) {
+		auto message = UMessageBuilder::publish(getTopic()).build();
+		message.mutable_attributes()->set_payload_format(format);
+		message.set_payload(payload);
+		return message;
+	}
+
+	std::shared_ptr<UTransportMock> transport_;
+
+public:
+	~TypedPubSubTest() override = default;
+};
+
+TEST_F(TypedPubSubTest, PublishProtobuf) {  // NOLINT
+	TypedPublisher<UUri> publisher(transport_, getTopic(),
+	                               UPriority::UPRIORITY_CS3);
+	const auto value = getValue("published");
+
+	auto status = publisher.publish(value);
+	EXPECT_EQ(status.code(), uprotocol::v1::UCode::OK);
+	EXPECT_EQ(transport_->getSendCount(), 1);
+
+	auto message = transport_->getMessage();
+	EXPECT_EQ(message.attributes().payload_format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF);
+	EXPECT_EQ(message.attributes().priority(), UPriority::UPRIORITY_CS3);
+	EXPECT_EQ(message.payload(), value.SerializeAsString());
+}
+
+TEST_F(TypedPubSubTest, PublishAny) {  // NOLINT
+	TypedPublisher<UUri, AsAny<UUri>> publisher(transport_, getTopic());
+	const auto value = getValue("published");
+
+	auto status = publisher.publish(value);
+	EXPECT_EQ(status.code(), uprotocol::v1::UCode::OK);
+
+	auto message = transport_->getMessage();
+	EXPECT_EQ(message.attributes().payload_format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY);
+	google::protobuf::Any any;
+	ASSERT_TRUE(any.ParseFromString(message.payload()));
+	UUri unpacked;
+	ASSERT_TRUE(any.UnpackTo(&unpacked));
+	EXPECT_EQ(unpacked.SerializeAsString(), value.SerializeAsString());
+}
+
+TEST_F(TypedPubSubTest, PublishNullTransport) {  // NOLINT
+	EXPECT_THROW(TypedPublisher<UUri>(nullptr, getTopic()),
+	             uprotocol::transport::NullTransport);
+}
+
+TEST_F(TypedPubSubTest, SubscribeReceivesValues) {  // NOLINT
+	std::vector<std::string> received;
+	std::vector<const UUri*> addresses;
+	size_t errors = 0;
+
+	auto subscriber = TypedSubscriber<UUri>::subscribe(
+	    transport_, getTopic(),
+	    [&](const UUri& value, const UAttributes& attributes) {
+		    EXPECT_EQ(attributes.payload_format(),
+		              UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF);
+		    received.push_back(value.authority_name());
+		    addresses.push_back(&value);
+	    },
+	    [&errors](const UMessage&) { ++errors; });
+	ASSERT_TRUE(subscriber);
+
+	TypedPublisher<UUri> publisher(transport_, getTopic());
+	for (const auto* authority : {"first", "second"}) {
+		EXPECT_EQ(publisher.publish(getValue(authority)).code(),
+		          uprotocol::v1::UCode::OK);
+		transport_->mockMessage(transport_->getMessage());
+	}
+
+	ASSERT_EQ(received.size(), 2);
+	EXPECT_EQ(received[0], "first");
+	EXPECT_EQ(received[1], "second");
+	// The same object is reused for every message on this thread
+	EXPECT_EQ(addresses[0], addresses[1]);
+	EXPECT_EQ(errors, 0);
+}
+
+TEST_F(TypedPubSubTest, SubscribeRejectsBadMessages) {  // NOLINT
+	size_t values = 0;
+	std::vector<std::string> errors;
+
+	auto subscriber = TypedSubscriber<UUri, AsAny<UUri>>::subscribe(
+	    transport_, getTopic(),
+	    [&values](const UUri&, const UAttributes&) { ++values; },
+	    [&errors](const UMessage& message) {
+		    errors.push_back(message.payload());
+	    });
+	ASSERT_TRUE(subscriber);
+
+	constexpr auto ANY =
+	    UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY;
+	google::protobuf::Any other;
+	other.PackFrom(UAttributes());
+
+	// Right payload, wrong format
+	transport_->mockMessage(
+	    makeMessage(UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF,
+	                getValue("a").SerializeAsString()));
+	// Right format, payload is not an Any
+	transport_->mockMessage(makeMessage(ANY, std::string("\xff\xff", 2)));
+	// Right format, Any holds a different type
+	transport_->mockMessage(makeMessage(ANY, other.SerializeAsString()));
+
+	EXPECT_EQ(values, 0);
+	EXPECT_EQ(errors.size(), 3);
+
+	// Errors are dropped without an error callback
+	auto quiet = TypedSubscriber<UUri>::subscribe(
+	    transport_, getTopic(),
+	    [&values](const UUri&, const UAttributes&) { ++values; });
+	ASSERT_TRUE(quiet);
+	transport_->mockMessage(makeMessage(ANY, other.SerializeAsString()));
+	EXPECT_EQ(values, 0);
+}
+
+TEST_F(TypedPubSubTest, SubscribeRegistrationFailure) {  // NOLINT
+	transport_->getRegisterListenerStatus().set_code(
+	    uprotocol::v1::UCode::RESOURCE_EXHAUSTED);
+	auto subscriber = TypedSubscriber<UUri>::subscribe(
+	    transport_, getTopic(), [](const UUri&, const UAttributes&) {});
+	ASSERT_FALSE(subscriber);
+	EXPECT_EQ(subscriber.error().code(),
+	          uprotocol::v1::UCode::RESOURCE_EXHAUSTED);
+}
+
+}  // namespace
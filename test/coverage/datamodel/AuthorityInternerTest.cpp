@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/AuthorityInterner.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uprotocol::datamodel {
+
+class TestAuthorityInterner : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestAuthorityInterner() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+public:
+	~TestAuthorityInterner() override = default;
+};
+
+TEST_F(TestAuthorityInterner, ReservedNames) {  // NOLINT
+	EXPECT_GE(AuthorityInterner::size(), 2);
+	EXPECT_EQ(AuthorityInterner::name(AuthorityInterner::LOCAL), "");
+	EXPECT_EQ(AuthorityInterner::name(AuthorityInterner::WILDCARD), "*");
+	EXPECT_EQ(AuthorityInterner::intern(""), AuthorityInterner::LOCAL);
+	EXPECT_EQ(AuthorityInterner::find("*"), AuthorityInterner::WILDCARD);
+}
+
+TEST_F(TestAuthorityInterner, InternIsStable) {  // NOLINT
+	const auto id = AuthorityInterner::intern("stable.example");
+	const auto view = AuthorityInterner::name(id);
+	EXPECT_EQ(view, "stable.example");
+
+	// Adding more names must not move existing ones
+	for (int i = 0; i < 1000; ++i) {
+		static_cast<void>(
+		    AuthorityInterner::intern("filler" + std::to_string(i)));
+	}
+	EXPECT_EQ(AuthorityInterner::intern("stable.example"), id);
+	EXPECT_EQ(AuthorityInterner::name(id).data(), view.data());
+}
+
+TEST_F(TestAuthorityInterner, FindDoesNotIntern) {  // NOLINT
+	const auto size_before = AuthorityInterner::size();
+	EXPECT_FALSE(AuthorityInterner::find("never.interned").has_value());
+	EXPECT_EQ(AuthorityInterner::size(), size_before);
+
+	const auto id = AuthorityInterner::intern("found.example");
+	EXPECT_EQ(AuthorityInterner::find("found.example"), id);
+	EXPECT_EQ(AuthorityInterner::size(), size_before + 1);
+}
+
+TEST_F(TestAuthorityInterner, UnknownIdThrows) {  // NOLINT
+	EXPECT_THROW(static_cast<void>(AuthorityInterner::name(  // NOLINT
+	                 static_cast<AuthorityInterner::Id>(
+	                     AuthorityInterner::size()))),
+	             std::out_of_range);
+}
+
+TEST_F(TestAuthorityInterner, ConcurrentReadersAndWriters) {  // NOLINT
+	constexpr int NUM_WRITERS = 2;
+	constexpr int NAMES_PER_WRITER = 2000;
+	const auto base = AuthorityInterner::intern("concurrent.base");
+
+	std::vector<std::thread> threads;
+	for (int w = 0; w < NUM_WRITERS; ++w) {
+		threads.emplace_back([w]() {
+			for (int i = 0; i < NAMES_PER_WRITER; ++i) {
+				const auto name =
+				    "writer" + std::to_string(w) + "." + std::to_string(i);
+				const auto id = AuthorityInterner::intern(name);
+				EXPECT_EQ(AuthorityInterner::name(id), name);
+			}
+		});
+	}
+	threads.emplace_back([base]() {
+		for (int i = 0; i < NUM_WRITERS * NAMES_PER_WRITER; ++i) {
+			EXPECT_EQ(AuthorityInterner::name(base), "concurrent.base");
+		}
+	});
+	for (auto& thread : threads) {
+		thread.join();
+	}
+}
+
+TEST_F(TestAuthorityInterner, ThrowsWhenFull) {  // NOLINT
+	for (auto i = AuthorityInterner::size(); i < AuthorityInterner::CAPACITY;
+	     ++i) {
+		static_cast<void>(
+		    AuthorityInterner::intern("fill" + std::to_string(i)));
+	}
+	EXPECT_EQ(AuthorityInterner::size(), AuthorityInterner::CAPACITY);
+	EXPECT_THROW(static_cast<void>(AuthorityInterner::intern("one.too.many")),
+	             std::length_error);
+	// Existing names are still available
+	EXPECT_EQ(AuthorityInterner::intern("*"), AuthorityInterner::WILDCARD);
+}
+
+}  // namespace uprotocol::datamodel
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/PackedUUri.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+
+#include <map>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace uprotocol::datamodel {
+
+class TestPackedUUri : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestPackedUUri() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+public:
+	~TestPackedUUri() override = default;
+};
+
+v1::UUri makeUri(const std::string& authority, uint32_t ue_id,
+                 uint32_t version, uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name(authority);
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(version);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+TEST_F(TestPackedUUri, DefaultIsEmptyLocal) {  // NOLINT
+	constexpr PackedUUri EMPTY;
+	static_assert(EMPTY.isLocal());
+	static_assert(EMPTY == PackedUUri(PackedUUri::LOCAL_AUTHORITY, 0, 0, 0));
+	EXPECT_EQ(EMPTY.authorityName(), "");
+	EXPECT_EQ(EMPTY, PackedUUri(v1::UUri()));
+}
+
+TEST_F(TestPackedUUri, FieldsRoundTrip) {  // NOLINT
+	constexpr PackedUUri PACKED(PackedUUri::WILDCARD_AUTHORITY, 0xFFFFFFFF,
+	                            0xFE, 0x8001);
+	static_assert(PACKED.ueId() == 0xFFFFFFFF);
+	static_assert(PACKED.ueVersionMajor() == 0xFE);
+	static_assert(PACKED.resourceId() == 0x8001);
+	static_assert(PACKED.authorityId() == PackedUUri::WILDCARD_AUTHORITY);
+	EXPECT_EQ(PACKED.authorityName(), "*");
+}
+
+TEST_F(TestPackedUUri, ConvertsToAndFromUUri) {  // NOLINT
+	const auto uri = makeUri("vehicle.example", 0x10010001, 0xFE, 0x8001);
+	const PackedUUri packed(uri);
+	EXPECT_FALSE(packed.isLocal());
+	EXPECT_EQ(packed.authorityName(), "vehicle.example");
+	EXPECT_EQ(packed.ueId(), 0x10010001);
+	EXPECT_EQ(packed.ueVersionMajor(), 0xFE);
+	EXPECT_EQ(packed.resourceId(), 0x8001);
+	EXPECT_EQ(packed.toUUri().SerializeAsString(), uri.SerializeAsString());
+
+	const auto local = makeUri("", 1, 1, 0);
+	EXPECT_TRUE(PackedUUri(local).isLocal());
+	EXPECT_EQ(PackedUUri(local).toUUri().SerializeAsString(),
+	          local.SerializeAsString());
+}
+
+TEST_F(TestPackedUUri, RejectsOutOfRangeFields) {  // NOLINT
+	EXPECT_THROW(PackedUUri(makeUri("a", 1, 0x100, 1)),  // NOLINT
+	             validator::uri::InvalidUUri);
+	EXPECT_THROW(PackedUUri(makeUri("a", 1, 1, 0x10000)),  // NOLINT
+	             validator::uri::InvalidUUri);
+}
+
+TEST_F(TestPackedUUri, LookupDoesNotIntern) {  // NOLINT
+	const auto uri = makeUri("lookup.example", 1, 1, 0x8000);
+	const auto interned_before = AuthorityInterner::size();
+	EXPECT_FALSE(PackedUUri::lookup(uri).has_value());
+	EXPECT_EQ(AuthorityInterner::size(), interned_before);
+
+	const PackedUUri packed(uri);
+	auto found = PackedUUri::lookup(uri);
+	ASSERT_TRUE(found.has_value());
+	EXPECT_EQ(*found, packed);
+
+	EXPECT_FALSE(PackedUUri::lookup(makeUri("lookup.example", 1, 0x100, 1))
+	                 .has_value());
+	EXPECT_FALSE(PackedUUri::lookup(makeUri("lookup.example", 1, 1, 0x10000))
+	                 .has_value());
+}
+
+TEST_F(TestPackedUUri, EqualAuthoritiesShareIds) {  // NOLINT
+	const PackedUUri first(makeUri("shared.example", 1, 1, 1));
+	const PackedUUri second(makeUri("shared.example", 2, 2, 2));
+	const PackedUUri other(makeUri("other.example", 1, 1, 1));
+	EXPECT_EQ(first.authorityId(), second.authorityId());
+	EXPECT_NE(first.authorityId(), other.authorityId());
+	EXPECT_EQ(first.authorityName().data(), second.authorityName().data());
+}
+
+TEST_F(TestPackedUUri, EqualityOrderingAndHash) {  // NOLINT
+	const PackedUUri base(makeUri("order.example", 0x1234, 1, 0x8000));
+	const PackedUUri same(makeUri("order.example", 0x1234, 1, 0x8000));
+	const PackedUUri higher_resource(
+	    makeUri("order.example", 0x1234, 1, 0x8001));
+	const PackedUUri higher_version(
+	    makeUri("order.example", 0x1234, 2, 0x0001));
+	const PackedUUri higher_ue_id(makeUri("order.example", 0x1235, 1, 0));
+
+	EXPECT_EQ(base, same);
+	EXPECT_EQ(std::hash<PackedUUri>{}(base), std::hash<PackedUUri>{}(same));
+	EXPECT_NE(base, higher_resource);
+	EXPECT_LT(base, higher_resource);
+	EXPECT_LT(higher_resource, higher_version);
+	EXPECT_LT(higher_version, higher_ue_id);
+	EXPECT_GT(higher_ue_id, base);
+	EXPECT_LE(base, same);
+	EXPECT_GE(base, same);
+
+	std::unordered_set<PackedUUri> set = {base, same, higher_resource,
+	                                      higher_version, higher_ue_id};
+	EXPECT_EQ(set.size(), 4);
+	std::map<PackedUUri, int> map = {{higher_ue_id, 2}, {base, 1}};
+	EXPECT_EQ(map.begin()->second, 1);
+}
+
+// Sequential authority IDs paired with sequential uE IDs must not collide
+TEST_F(TestPackedUUri, HashSeparatesAuthorityAndUeId) {  // NOLINT
+	EXPECT_NE(PackedUUri(2, 0x10001, 1, 1).hash(),
+	          PackedUUri(3, 0x10000, 1, 1).hash());
+
+	constexpr uint32_t COUNT = 64;
+	std::unordered_set<size_t> hashes;
+	for (uint32_t authority = 0; authority < COUNT; ++authority) {
+		for (uint32_t ue_id = 0; ue_id < COUNT; ++ue_id) {
+			hashes.insert(PackedUUri(authority, ue_id, 1, 1).hash());
+		}
+	}
+	EXPECT_EQ(hashes.size(), COUNT * COUNT);
+}
+
+TEST_F(TestPackedUUri, WildcardMatches) {  // NOLINT
+	const PackedUUri exact(makeUri("match.example", 0x00011234, 2, 0x8001));
+	const PackedUUri candidate = exact;
+	EXPECT_TRUE(exact.matches(candidate));
+
+	const PackedUUri any(makeUri("*", 0xFFFFFFFF, 0xFF, 0xFFFF));
+	EXPECT_TRUE(any.matches(candidate));
+	EXPECT_FALSE(candidate.matches(any));
+
+	// Each wildcard only relaxes its own field
+	EXPECT_TRUE(PackedUUri(makeUri("*", 0x00011234, 2, 0x8001))
+	                .matches(candidate));
+	EXPECT_TRUE(PackedUUri(makeUri("match.example", 0x0001FFFF, 2, 0x8001))
+	                .matches(candidate));
+	EXPECT_FALSE(PackedUUri(makeUri("match.example", 0x0002FFFF, 2, 0x8001))
+	                 .matches(candidate));
+	EXPECT_TRUE(PackedUUri(makeUri("match.example", 0xFFFF1234, 2, 0x8001))
+	                .matches(candidate));
+	EXPECT_FALSE(PackedUUri(makeUri("match.example", 0xFFFF4321, 2, 0x8001))
+	                 .matches(candidate));
+	EXPECT_TRUE(PackedUUri(makeUri("match.example", 0x00011234, 0xFF, 0x8001))
+	                .matches(candidate));
+	EXPECT_FALSE(PackedUUri(makeUri("match.example", 0x00011234, 3, 0xFFFF))
+	                 .matches(candidate));
+	EXPECT_TRUE(PackedUUri(makeUri("match.example", 0x00011234, 2, 0xFFFF))
+	                .matches(candidate));
+	EXPECT_FALSE(PackedUUri(makeUri("", 0x00011234, 2, 0x8001))
+	                 .matches(candidate));
+}
+
+TEST_F(TestPackedUUri, ConcurrentInterning) {  // NOLINT
+	constexpr size_t NUM_THREADS = 4;
+	constexpr size_t NUM_AUTHORITIES = 64;
+	std::vector<std::vector<PackedUUri::AuthorityId>> ids(NUM_THREADS);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < NUM_THREADS; ++t) {
+		threads.emplace_back([&ids, t]() {
+			for (size_t i = 0; i < NUM_AUTHORITIES; ++i) {
+				const auto uri =
+				    makeUri("concurrent" + std::to_string(i), 1, 1, 1);
+				ids[t].push_back(PackedUUri(uri).authorityId());
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	for (size_t t = 1; t < NUM_THREADS; ++t) {
+		EXPECT_EQ(ids[t], ids[0]);
+	}
+	for (size_t i = 0; i < NUM_AUTHORITIES; ++i) {
+		EXPECT_EQ(AuthorityInterner::name(ids[0][i]),
+		          "concurrent" + std::to_string(i));
+	}
+}
+
+}  // namespace uprotocol::datamodel
@@ -13,6 +13,10 @@
 #include <up-cpp/datamodel/builder/Payload.h>
 
 #include <chrono>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace uprotocol::datamodel::builder {
 
@@ -110,8 +114,7 @@ TEST_F(PayloadTest, CreateSerializedProtobufPayloadAndMoveTest) {  // NOLINT
 
 	// Act
 	Payload payload(uri_object);
-	const auto& [payload_reference, payload_format] = payload.buildCopy();
-	const void* original_address = payload_reference.data();
+	const void* original_address = payload.data().data();
 
 	// Assert
 	auto [payloadData, payloadFormat] = std::move(payload).buildMove();
@@ -613,8 +616,11 @@ TEST_F(PayloadTest, MoveAssignmentOperatorTest) {  // NOLINT
 	          uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF);
 }
 
-// Copy Assignment Operator Test
-TEST_F(PayloadTest, CopyAssignmentOperatorTest) {  // NOLINT
+// Payloads are move-only, so copies are made explicitly with clone()
+TEST_F(PayloadTest, CloneTest) {  // NOLINT
+	static_assert(!std::is_copy_constructible_v<Payload>);
+	static_assert(!std::is_copy_assignable_v<Payload>);
+
 	// Arrange
 	uprotocol::v1::UPayloadFormat format =
 	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT;
@@ -622,13 +628,175 @@ TEST_F(PayloadTest, CopyAssignmentOperatorTest) {  // NOLINT
 	Payload copied_payload(getTestStringPayload(), format);
 
 	// Act
-	copied_payload = original_payload;
+	copied_payload = original_payload.clone();
 
 	// Assert
 	auto [originalData, originalFormat] = original_payload.buildCopy();
 	auto [copiedData, copiedFormat] = copied_payload.buildCopy();
 	EXPECT_EQ(copiedData, originalData);
 	EXPECT_EQ(copiedFormat, originalFormat);
+	EXPECT_NE(copied_payload.data().data(), original_payload.data().data());
+
+	auto _ = std::move(original_payload).buildMove();
+	EXPECT_THROW(auto _ = original_payload.clone(),  // NOLINT
+	             Payload::PayloadMoved);
+}
+
+// Moved-from payloads behave as if buildMove() was called on them
+TEST_F(PayloadTest, MovedFromPayloadTest) {  // NOLINT
+	Payload original_payload(
+	    getTestStringPayload(),
+	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+
+	Payload moved_payload(std::move(original_payload));
+
+	EXPECT_EQ(moved_payload.data(), getTestStringPayload());
+	EXPECT_THROW(static_cast<void>(original_payload.data()),  // NOLINT
+	             Payload::PayloadMoved);
+	EXPECT_THROW(static_cast<void>(original_payload.format()),  // NOLINT
+	             Payload::PayloadMoved);
+}
+
+// Small payloads that must be copied are stored inside the Payload object
+TEST_F(PayloadTest, SmallPayloadStoredInlineTest) {  // NOLINT
+	const std::vector<uint8_t> small_bytes(Payload::INLINE_CAPACITY, 'x');
+	const std::vector<uint8_t> large_bytes(Payload::INLINE_CAPACITY + 1, 'x');
+	Payload small_payload(small_bytes,
+	                      uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
+	Payload large_payload(large_bytes,
+	                      uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
+
+	auto is_inside = [](const Payload& payload) {
+		const auto* begin = reinterpret_cast<const char*>(&payload);
+		const auto* bytes = payload.data().data();
+		return (bytes >= begin) && (bytes < begin + sizeof(Payload));
+	};
+	EXPECT_TRUE(is_inside(small_payload));
+	EXPECT_FALSE(is_inside(large_payload));
+
+	auto [small_data, small_format] = std::move(small_payload).buildMove();
+	EXPECT_EQ(small_data, std::string(small_bytes.begin(), small_bytes.end()));
+	EXPECT_EQ(small_format, uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
+	EXPECT_EQ(large_payload.data(),
+	          std::string(large_bytes.begin(), large_bytes.end()));
+}
+
+// Byte vectors passed by rvalue are adopted without copying
+TEST_F(PayloadTest, RValueByteArrayAdoptedTest) {  // NOLINT
+	auto bytes = getTestBytesPayload();
+	const void* original_address = bytes.data();
+
+	Payload payload(std::move(bytes),
+	                uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
+
+	EXPECT_EQ(payload.data().data(), original_address);
+	auto expected = getTestBytesPayload();
+	EXPECT_EQ(payload.data(), std::string(expected.begin(), expected.end()));
+
+	EXPECT_THROW(Payload(std::vector<uint8_t>{},  // NOLINT
+	                     static_cast<uprotocol::v1::UPayloadFormat>(
+	                         uprotocol::v1::UPayloadFormat_MAX + 1)),
+	             std::out_of_range);
+}
+
+// Shared buffers are referenced, not copied, until the message is built
+TEST_F(PayloadTest, SharedBufferPayloadTest) {  // NOLINT
+	auto buffer = std::make_shared<const std::string>(getTestStringPayload());
+
+	Payload payload(buffer,
+	                uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	auto clone = payload.clone();
+
+	EXPECT_EQ(payload.data().data(), buffer->data());
+	EXPECT_EQ(clone.data().data(), buffer->data());
+	EXPECT_EQ(buffer.use_count(), 3);
+
+	auto [payload_data, payload_format] = std::move(payload).buildMove();
+	EXPECT_EQ(payload_data, *buffer);
+	EXPECT_EQ(payload_format,
+	          uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_EQ(buffer.use_count(), 2);
+
+	EXPECT_THROW(Payload(Payload::SharedBuffer{},  // NOLINT
+	                     uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT),
+	             std::invalid_argument);
+	EXPECT_THROW(Payload(buffer,  // NOLINT
+	                     static_cast<uprotocol::v1::UPayloadFormat>(
+	                         uprotocol::v1::UPayloadFormat_MAX + 1)),
+	             std::out_of_range);
+}
+
+// Fragments are shared until contiguous bytes are needed
+TEST_F(PayloadTest, FragmentsPayloadTest) {  // NOLINT
+	auto header = std::make_shared<const std::string>("header:");
+	auto body = std::make_shared<const std::string>(getTestStringPayload());
+	const auto joined = *header + *body;
+
+	Payload payload(Payload::Fragments{header, body},
+	                uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_EQ(payload.size(), joined.size());
+
+	auto fragments = payload.fragments();
+	ASSERT_EQ(fragments.size(), 2);
+	EXPECT_EQ(fragments[0].data(), header->data());
+	EXPECT_EQ(fragments[1].data(), body->data());
+
+	auto clone = payload.clone();
+	EXPECT_EQ(body.use_count(), 3);
+	EXPECT_EQ(std::get<Payload::PayloadType::Data>(clone.buildCopy()),
+	          joined);
+
+	uprotocol::v1::UMessage message;
+	std::move(clone).buildInto(message);
+	EXPECT_EQ(message.payload(), joined);
+	EXPECT_EQ(body.use_count(), 2);
+
+	// data() joins the fragments into a cached copy, keeping the fragments
+	// so that views handed out earlier stay valid
+	EXPECT_EQ(payload.data(), joined);
+	EXPECT_EQ(payload.data().data(), payload.data().data());
+	EXPECT_EQ(body.use_count(), 2);
+	ASSERT_EQ(payload.fragments().size(), 2);
+	EXPECT_EQ(payload.fragments()[1].data(), body->data());
+
+	Payload sole_owner(
+	    Payload::Fragments{std::make_shared<const std::string>(joined)},
+	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	auto sole_views = sole_owner.fragments();
+	EXPECT_EQ(sole_owner.data(), joined);
+	EXPECT_EQ(sole_views[0], joined);
+
+	EXPECT_THROW(Payload(Payload::Fragments{header, nullptr},  // NOLINT
+	                     uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT),
+	             std::invalid_argument);
+	EXPECT_THROW(Payload(Payload::Fragments{header},  // NOLINT
+	                     static_cast<uprotocol::v1::UPayloadFormat>(
+	                         uprotocol::v1::UPayloadFormat_MAX + 1)),
+	             std::out_of_range);
+}
+
+// Building into a message moves strings and copies everything else once
+TEST_F(PayloadTest, BuildIntoMessageTest) {  // NOLINT
+	std::string large(Payload::INLINE_CAPACITY * 2, 'x');
+	const void* original_address = large.data();
+	Payload string_payload(std::move(large),
+	                       uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+
+	uprotocol::v1::UMessage message;
+	std::move(string_payload).buildInto(message);
+	EXPECT_EQ(message.payload().data(), original_address);
+	EXPECT_EQ(message.attributes().payload_format(),
+	          uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_THROW(std::move(string_payload).buildInto(message),  // NOLINT
+	             Payload::PayloadMoved);
+
+	Payload bytes_payload(getTestBytesPayload(),
+	                      uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
+	std::move(bytes_payload).buildInto(message);
+	auto expected = getTestBytesPayload();
+	EXPECT_EQ(message.payload(), std::string(expected.begin(), expected.end()));
+	EXPECT_EQ(message.attributes().payload_format(),
+	          uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_RAW);
 }
 
 }  // namespace uprotocol::datamodel::builder
@@ -570,4 +570,25 @@ TEST_F(TestUMessageBuilder,  // NOLINT
 	    datamodel::builder::UMessageBuilder::UnexpectedFormat);
 }
 
+TEST_F(TestUMessageBuilder, BuildAttributesForPayload) {  // NOLINT
+	auto builder = createFakeRequest();
+	std::string data = "test-data";
+	datamodel::builder::Payload payload(
+	    data, v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+
+	auto message = builder.buildAttributesFor(payload);
+	EXPECT_TRUE(message.payload().empty());
+	EXPECT_EQ(message.attributes().payload_format(),
+	          v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_TRUE(
+	    urisAreEqual(builder.attributes().sink(), message.attributes().sink()));
+	// The payload is left intact
+	EXPECT_EQ(payload.data(), data);
+
+	builder.withPayloadFormat(v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+	EXPECT_THROW(  // NOLINT
+	    { auto mismatched = builder.buildAttributesFor(payload); },
+	    datamodel::builder::UMessageBuilder::UnexpectedFormat);
+}
+
 }  // namespace uprotocol
@@ -15,6 +15,8 @@
 #include <up-cpp/datamodel/validator/UUri.h>
 #include <uprotocol/v1/uri.pb.h>
 
+#include <vector>
+
 namespace uprotocol::v1 {
 
 class TestUMessageValidator : public testing::Test {
@@ -1119,4 +1121,151 @@ TEST_F(TestUMessageValidator, IsValid) {  // NOLINT
 	}
 }
 
+TEST_F(TestUMessageValidator, IsValidAtTime) {  // NOLINT
+	using uprotocol::datamodel::validator::message::isValid;
+	using uprotocol::datamodel::validator::message::Reason;
+
+	auto source = getSource();
+	source.set_resource_id(0);
+	auto attributes = fakeRequest(source, getSink());
+	auto umessage = build(attributes);
+	const auto now = std::chrono::system_clock::now();
+
+	{
+		auto [valid, reason] = isValid(umessage, now);
+		EXPECT_TRUE(valid);
+		EXPECT_FALSE(reason.has_value());
+	}
+
+	// TTL is checked against the time provided, not the system clock
+	{
+		auto [valid, reason] = isValid(umessage, now + std::chrono::hours(1));
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, Reason::ID_EXPIRED);
+	}
+
+	// So is the ID timestamp
+	{
+		auto [valid, reason] = isValid(umessage, now - std::chrono::hours(1));
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, Reason::BAD_ID);
+	}
+
+	// Results match the overload that reads the clock
+	attributes.set_ttl(0);
+	umessage = build(attributes);
+	EXPECT_EQ(isValid(umessage, now), isValid(umessage));
+}
+
+TEST_F(TestUMessageValidator, AllFailures) {  // NOLINT
+	using uprotocol::datamodel::validator::message::allFailures;
+	using uprotocol::datamodel::validator::message::Reason;
+
+	auto source = getSource();
+	source.set_resource_id(0);
+	auto attributes = fakeRequest(source, getSink());
+	auto umessage = build(attributes);
+	const auto now = std::chrono::system_clock::now();
+
+	EXPECT_TRUE(allFailures(umessage, now).empty());
+
+	// Break three independent rules
+	attributes.set_ttl(0);
+	attributes.set_commstatus(UCode::INTERNAL);
+	attributes.mutable_sink()->set_resource_id(0);
+	umessage = build(attributes);
+	{
+		auto failures = allFailures(umessage, now);
+		EXPECT_EQ(failures.size(), 3);
+		EXPECT_TRUE(failures.contains(Reason::INVALID_TTL));
+		EXPECT_TRUE(failures.contains(Reason::DISALLOWED_FIELD_SET));
+		EXPECT_TRUE(failures.contains(Reason::BAD_SINK_URI));
+		EXPECT_FALSE(failures.contains(Reason::BAD_SOURCE_URI));
+
+		// isValid() reports the first failure in rule order
+		auto [valid, reason] =
+		    uprotocol::datamodel::validator::message::isValid(umessage, now);
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, Reason::BAD_SINK_URI);
+	}
+
+	// Common attribute failures are reported along with the type's
+	attributes.set_type(UMESSAGE_TYPE_UNSPECIFIED);
+	attributes.clear_id();
+	umessage = build(attributes);
+	{
+		auto failures = allFailures(umessage, now);
+		EXPECT_EQ(failures.size(), 2);
+		EXPECT_TRUE(failures.contains(Reason::BAD_ID));
+		EXPECT_TRUE(failures.contains(Reason::UNSPECIFIED_MESSAGE_TYPE));
+	}
+}
+
+TEST_F(TestUMessageValidator, ValidateBatch) {  // NOLINT
+	using uprotocol::datamodel::validator::message::BatchResult;
+	using uprotocol::datamodel::validator::message::Reason;
+	using uprotocol::datamodel::validator::message::validateBatch;
+
+	constexpr uint32_t PUBLISH_SOURCE_RESOURCE_ID = 0x8000;
+	auto request_source = getSource();
+	request_source.set_resource_id(0);
+	auto publish_source = getSource();
+	publish_source.set_resource_id(PUBLISH_SOURCE_RESOURCE_ID);
+
+	auto request = fakeRequest(request_source, getSink());
+	auto publish = fakePublish(publish_source);
+	auto bad_publish = fakePublish(request_source);
+
+	const std::vector<UMessage> messages{build(request), build(publish),
+	                                     build(bad_publish)};
+	const auto now = std::chrono::system_clock::now();
+
+	{
+		std::vector<BatchResult> results(messages.size() + 1,
+		                                 Reason::INVALID_TTL);
+		EXPECT_EQ(validateBatch(messages, now, results), 2);
+		EXPECT_FALSE(results[0].has_value());
+		EXPECT_FALSE(results[1].has_value());
+		EXPECT_EQ(results[2], Reason::BAD_SOURCE_URI);
+		// Entries past the batch are left alone
+		EXPECT_EQ(results[3], Reason::INVALID_TTL);
+	}
+
+	// Every message is checked against the provided time
+	{
+		std::vector<BatchResult> results(messages.size());
+		EXPECT_EQ(validateBatch(messages, now + std::chrono::hours(1), results),
+		          0);
+		EXPECT_EQ(results[0], Reason::ID_EXPIRED);
+		EXPECT_EQ(results[1], Reason::ID_EXPIRED);
+		EXPECT_EQ(results[2], Reason::ID_EXPIRED);
+	}
+
+	{
+		std::vector<BatchResult> results(messages.size());
+		EXPECT_EQ(validateBatch(messages, results), 2);
+		EXPECT_EQ(results[2], Reason::BAD_SOURCE_URI);
+	}
+
+	{
+		std::vector<BatchResult> results(messages.size() - 1);
+		EXPECT_THROW(validateBatch(messages, now, results), std::length_error);
+	}
+
+	{
+		std::vector<BatchResult> results;
+		EXPECT_EQ(validateBatch({}, now, results), 0);
+	}
+}
+
+TEST_F(TestUMessageValidator, ReasonNames) {  // NOLINT
+	using uprotocol::datamodel::validator::message::name;
+	using uprotocol::datamodel::validator::message::Reason;
+
+	EXPECT_EQ(name(Reason::BAD_ID), "BAD_ID");
+	EXPECT_EQ(name(Reason::ID_EXPIRED), "ID_EXPIRED");
+	EXPECT_EQ(name(Reason::WRONG_MESSAGE_TYPE), "WRONG_MESSAGE_TYPE");
+	EXPECT_EQ(name(static_cast<Reason>(-1)), "UNKNOWN");
+}
+
 }  // namespace uprotocol::v1
@@ -190,6 +190,53 @@ TEST_F(TestUUriSerializer, SerializeUUriToStringWithInvalidUUri) {  // NOLINT
 	             uprotocol::datamodel::validator::uri::InvalidUUri);
 }
 
+// Serialize into a caller-provided buffer and into a reused string
+TEST_F(TestUUriSerializer, SerializeUUriToBufferAndReusedString) {  // NOLINT
+	auto remote = buildValidTestURI();
+	auto local = buildValidTestURI("");
+
+	AsString::Buffer buffer{};
+	auto length = AsString::serialize(remote, buffer);
+	EXPECT_EQ(std::string_view(buffer.data(), length),
+	          "//192.168.1.10/10010001/FE/7500");
+
+	std::string reused;
+	AsString::serialize(remote, reused);
+	EXPECT_EQ(reused, "//192.168.1.10/10010001/FE/7500");
+	const auto* const storage = reused.data();
+	AsString::serialize(local, reused);
+	EXPECT_EQ(reused, "/10010001/FE/7500");
+	// Shrinking must reuse the existing storage rather than reallocate
+	EXPECT_EQ(reused.data(), storage);
+
+	uprotocol::v1::UUri test_u_uri;
+	EXPECT_THROW(AsString::serialize(test_u_uri, buffer),  // NOLINT
+	             uprotocol::datamodel::validator::uri::InvalidUUri);
+}
+
+// Field widths vary with their values, including zero and the longest URI
+TEST_F(TestUUriSerializer, SerializeUUriFieldWidths) {  // NOLINT
+	constexpr size_t AUTHORITY_MAX_LENGTH = 128;
+	constexpr uint32_t MAX_UE_ID = 0xFFFFFFFF;
+	constexpr uint32_t MAX_VERSION = 0xFF;
+	constexpr uint32_t MAX_RESOURCE_ID = 0xFFFF;
+
+	uprotocol::v1::UUri test_u_uri;
+	test_u_uri.set_ue_version_major(1);
+	EXPECT_EQ(AsString::serialize(test_u_uri), "/0/1/0");
+
+	test_u_uri.set_authority_name(std::string(AUTHORITY_MAX_LENGTH, 'a'));
+	test_u_uri.set_ue_id(MAX_UE_ID);
+	test_u_uri.set_ue_version_major(MAX_VERSION);
+	test_u_uri.set_resource_id(MAX_RESOURCE_ID);
+	AsString::Buffer buffer{};
+	auto length = AsString::serialize(test_u_uri, buffer);
+	EXPECT_EQ(length, AsString::MAX_LENGTH);
+	EXPECT_EQ(std::string(buffer.data(), length),
+	          "//" + std::string(AUTHORITY_MAX_LENGTH, 'a') +
+	              "/FFFFFFFF/FF/FFFF");
+}
+
 // Test deserialize by providing scheme "up:" which is allowed to have as per
 // spec
 TEST_F(TestUUriSerializer, DeSerializeUUriStringWithScheme) {  // NOLINT
@@ -449,4 +496,50 @@ TEST_F(TestUUriSerializer, DeSerializeUUriStringWithInvalidUUri) {  // NOLINT
 	             uprotocol::datamodel::validator::uri::InvalidUUri);
 }
 
+// Non-throwing deserialization of well-formed strings
+TEST_F(TestUUriSerializer, TryDeserializeUUriString) {  // NOLINT
+	auto maybe_uri =
+	    AsString::tryDeserialize("up://192.168.1.10/10010001/FE/7500");
+	ASSERT_TRUE(maybe_uri.has_value());
+	EXPECT_EQ(maybe_uri.value().authority_name(), "192.168.1.10");
+	EXPECT_EQ(maybe_uri.value().ue_id(), DEFAULT_UE_ID);
+	EXPECT_EQ(maybe_uri.value().ue_version_major(), DEFAULT_VERSION_MAJOR);
+	EXPECT_EQ(maybe_uri.value().resource_id(), DEFAULT_RESOURCE_ID);
+
+	// Round trip through the serializer, including a local URI
+	for (const auto& authority : {"192.168.1.10", ""}) {
+		const auto uri = buildValidTestURI(authority);
+		auto round_trip = AsString::tryDeserialize(AsString::serialize(uri));
+		ASSERT_TRUE(round_trip.has_value());
+		EXPECT_EQ(round_trip.value().SerializeAsString(),
+		          uri.SerializeAsString());
+	}
+}
+
+// Non-throwing deserialization reports why a string was rejected
+TEST_F(TestUUriSerializer, TryDeserializeUUriStringErrors) {  // NOLINT
+	const std::pair<std::string_view, ParseError> cases[] = {  // NOLINT
+	    {"", ParseError::EMPTY_STRING},
+	    {"192.168.1.10/10010001/FE/7500", ParseError::BAD_PREFIX},
+	    {"up:/192.168.1.10/10010001/FE/7500", ParseError::BAD_PREFIX},
+	    {"//192.168.1.10", ParseError::MISSING_SEGMENT},
+	    {"//192.168.1.10/FE/7500", ParseError::MISSING_SEGMENT},
+	    {"/FE/7500", ParseError::MISSING_SEGMENT},
+	    {"//192.168.1.10/10010001/FE/FE/7500", ParseError::BAD_NUMBER},
+	    {"/1102/FE/FE/7500", ParseError::BAD_NUMBER},
+	    {"/10010001/XYZ/7500", ParseError::BAD_NUMBER},
+	    {"/10010001//7500", ParseError::BAD_NUMBER},
+	    {"/100000000/FE/7500", ParseError::BAD_NUMBER},
+	    {"/0/0/0", ParseError::INVALID_URI},
+	    {"//192.168.1.10/1FFFE/FFFE/7500", ParseError::INVALID_URI},
+	    {"//192.168.1.10/1FFFE/FE/C0FFEEEE", ParseError::INVALID_URI}};
+
+	for (const auto& [uri_as_string, expected_error] : cases) {
+		auto maybe_uri = AsString::tryDeserialize(uri_as_string);
+		ASSERT_FALSE(maybe_uri.has_value()) << uri_as_string;
+		EXPECT_EQ(maybe_uri.error(), expected_error) << uri_as_string;
+		EXPECT_FALSE(message(maybe_uri.error()).empty());
+	}
+}
+
 }  // namespace uprotocol::datamodel::serializer::uri
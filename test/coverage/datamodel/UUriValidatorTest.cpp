@@ -10,8 +10,12 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <up-cpp/datamodel/PackedUUri.h>
 #include <up-cpp/datamodel/validator/UUri.h>
 
+#include <string>
+#include <vector>
+
 constexpr uint32_t DEFAULT_UE_ID = 0x00010001;
 constexpr uint32_t WILDCARD = 0xFFFF;
 
@@ -744,4 +748,97 @@ TEST_F(TestUUriValidator, ReasonMessages) {  // NOLINT
 	}
 }
 
+TEST_F(TestUUriValidator, ClassifyForms) {  // NOLINT
+	using C = Classification;
+	auto make_uri = [](const std::string& authority, uint32_t resource_id) {
+		uprotocol::v1::UUri uuri;
+		uuri.set_authority_name(authority);
+		uuri.set_ue_id(DEFAULT_UE_ID);
+		uuri.set_ue_version_major(1);
+		uuri.set_resource_id(resource_id);
+		return uuri;
+	};
+
+	constexpr uint32_t METHOD_ID = 0x0001;
+	constexpr uint32_t TOPIC_ID = 0x8001;
+
+	auto method = classify(make_uri(AUTHORITY_NAME, METHOD_ID));
+	EXPECT_EQ(method.mask, C::RPC_METHOD | C::FILTER);
+
+	auto response = classify(make_uri(AUTHORITY_NAME, 0));
+	EXPECT_EQ(response.mask, C::RPC_RESPONSE | C::NOTIFICATION_SINK |
+	                             C::DEFAULT_ENTITY | C::FILTER);
+
+	auto local_response = classify(make_uri("", 0));
+	EXPECT_EQ(local_response.mask, C::RPC_RESPONSE | C::NOTIFICATION_SINK |
+	                                   C::LOCAL | C::FILTER);
+
+	auto topic = classify(make_uri(AUTHORITY_NAME, TOPIC_ID));
+	EXPECT_EQ(topic.mask, C::PUBLISH_TOPIC | C::NOTIFICATION_SOURCE |
+	                          C::SUBSCRIPTION | C::FILTER);
+
+	auto empty = classify(uprotocol::v1::UUri());
+	EXPECT_EQ(empty.mask, C::RPC_RESPONSE | C::NOTIFICATION_SINK | C::LOCAL |
+	                          C::EMPTY);
+	EXPECT_EQ(empty.filter_failure, Reason::EMPTY);
+	EXPECT_FALSE(empty.empty_failure.has_value());
+}
+
+TEST_F(TestUUriValidator, ClassifyWildcards) {  // NOLINT
+	using C = Classification;
+	constexpr uint32_t WILDCARD_UE_ID = 0xFFFFFFFF;
+	constexpr uint32_t WILDCARD_VERSION = 0xFF;
+
+	uprotocol::v1::UUri uuri;
+	uuri.set_authority_name("*");
+	uuri.set_ue_id(WILDCARD_UE_ID);
+	uuri.set_ue_version_major(WILDCARD_VERSION);
+	uuri.set_resource_id(WILDCARD);
+
+	auto uri_class = classify(uuri);
+	EXPECT_TRUE(uri_class.has(C::ANY_WILDCARD));
+	EXPECT_TRUE(uri_class.has(C::SUBSCRIPTION | C::FILTER));
+	EXPECT_FALSE(uri_class.hasAny(C::RPC_METHOD | C::RPC_RESPONSE |
+	                              C::PUBLISH_TOPIC | C::NOTIFICATION_SINK));
+	EXPECT_FALSE(verify_no_wildcards(uri_class));
+
+	uuri.set_authority_name(AUTHORITY_NAME);
+	uuri.set_ue_id(DEFAULT_UE_ID);
+	uuri.set_ue_version_major(1);
+	uri_class = classify(uuri);
+	EXPECT_EQ(uri_class.mask & C::ANY_WILDCARD, C::WILDCARD_RESOURCE_ID);
+}
+
+TEST_F(TestUUriValidator, ClassifyPacked) {  // NOLINT
+	constexpr uint32_t TOPIC_ID = 0x8001;
+	constexpr size_t TOO_LONG = 129;
+	auto make_uri = [](const std::string& authority, uint32_t ue_id,
+	                   uint32_t version, uint32_t resource_id) {
+		uprotocol::v1::UUri uuri;
+		uuri.set_authority_name(authority);
+		uuri.set_ue_id(ue_id);
+		uuri.set_ue_version_major(version);
+		uuri.set_resource_id(resource_id);
+		return uuri;
+	};
+
+	const std::vector<uprotocol::v1::UUri> uris = {
+	    make_uri(AUTHORITY_NAME, DEFAULT_UE_ID, 1, 1),
+	    make_uri(AUTHORITY_NAME, DEFAULT_UE_ID, 1, 0),
+	    make_uri("", DEFAULT_UE_ID, 1, 0),
+	    make_uri(AUTHORITY_NAME, DEFAULT_UE_ID, 1, TOPIC_ID),
+	    make_uri("*", 0xFFFFFFFF, 0xFF, WILDCARD),
+	    make_uri("  ", 0, 0, 0),
+	    make_uri(std::string(TOO_LONG, 'a'), DEFAULT_UE_ID, 1, 1),
+	    uprotocol::v1::UUri()};
+
+	for (const auto& uuri : uris) {
+		auto expected = classify(uuri);
+		auto packed = classify(PackedUUri(uuri));
+		EXPECT_EQ(packed.mask, expected.mask) << uuri.ShortDebugString();
+		EXPECT_EQ(packed.filter_failure, expected.filter_failure);
+		EXPECT_EQ(packed.empty_failure, expected.empty_failure);
+	}
+}
+
 }  // namespace uprotocol::datamodel::validator::uri
@@ -62,6 +62,22 @@ TEST(UuidBuilderTest, WithTimeSource) {  // NOLINT
 	          fixed_time_ms.time_since_epoch().count());
 }
 
+// Test clock, which is available outside of test mode
+TEST(UuidBuilderTest, WithClock) {  // NOLINT
+	constexpr std::time_t FIXED_TIME_T = 1234567890;
+	auto fixed_time = std::chrono::system_clock::from_time_t(FIXED_TIME_T);
+	auto fixed_time_ms =
+	    std::chrono::time_point_cast<std::chrono::milliseconds>(fixed_time);
+	const utils::CoarseClock clock(std::chrono::hours(1), [fixed_time]() {
+		return utils::CoarseClock::Reading{fixed_time, {}};
+	});
+	auto builder = builder::UuidBuilder::getBuilder().withClock(clock);
+	auto uuid = builder.build();
+
+	EXPECT_EQ(uuid.msb() >> UUID_TIMESTAMP_SHIFT,
+	          fixed_time_ms.time_since_epoch().count());
+}
+
 // Test RandomSource
 TEST(UuidBuilderTest, WithRandomSource) {  // NOLINT
 	constexpr uint64_t FIXED_RANDOM_UINT = 0x1234567890ABCDEF;
@@ -201,6 +201,92 @@ TEST(DeserializerTest, DeserializeInvalidCharacter) {  // NOLINT
 	             std::invalid_argument);
 }
 
+// Test deserialization with a non-hex character in an otherwise valid layout
+TEST(DeserializerTest, DeserializeNonHexDigit) {  // NOLINT
+	std::string invalid_uuid_str = "12x45678-9abc-def0-fedc-ba9876543210";
+	EXPECT_THROW(static_cast<void>(AsString::deserialize(  // NOLINT
+	                 invalid_uuid_str)),
+	             std::invalid_argument);
+}
+
+// Test string serialization into a fixed-size buffer
+TEST_F(TestUuidSerializer, SerializeToBuffer) {  // NOLINT
+	constexpr uint64_t UUID_MSB = 0x00001234567890AB;
+	constexpr uint64_t UUID_LSB = 0xFEDCBA0987600000;
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(UUID_MSB);
+	uuid.set_lsb(UUID_LSB);
+
+	AsString::Buffer buffer{};
+	AsString::serialize(uuid, buffer);
+	EXPECT_EQ(std::string_view(buffer.data(), buffer.size()),
+	          "00001234-5678-90ab-fedc-ba0987600000");
+}
+
+// Test string serialization into a reused string
+TEST_F(TestUuidSerializer, SerializeToReusedString) {  // NOLINT
+	constexpr uint64_t UUID_MSB = 0x1234567890ABCDEF;
+	constexpr uint64_t UUID_LSB = 0xFEDCBA0987654321;
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(UUID_MSB);
+	uuid.set_lsb(UUID_LSB);
+
+	std::string out = "some previous, much longer contents of the string";
+	AsString::serialize(uuid, out);
+	EXPECT_EQ(out, "12345678-90ab-cdef-fedc-ba0987654321");
+
+	uuid.set_msb(0);
+	AsString::serialize(uuid, out);
+	EXPECT_EQ(out, "00000000-0000-0000-fedc-ba0987654321");
+}
+
+// Test non-throwing string deserialization
+TEST_F(TestUuidSerializer, TryDeserialize) {  // NOLINT
+	auto maybe_uuid =
+	    AsString::tryDeserialize("00001234-5678-90ab-feDc-ba0987600000");
+	ASSERT_TRUE(maybe_uuid.has_value());
+	EXPECT_EQ(maybe_uuid.value().msb(), 0x00001234567890aB);
+	EXPECT_EQ(maybe_uuid.value().lsb(), 0xFedcBA0987600000);
+}
+
+// Test non-throwing string deserialization of invalid strings
+TEST_F(TestUuidSerializer, TryDeserializeInvalid) {  // NOLINT
+	auto wrong_length = AsString::tryDeserialize("");
+	ASSERT_FALSE(wrong_length.has_value());
+	EXPECT_EQ(wrong_length.error(), ParseError::WRONG_LENGTH);
+
+	auto bad_separator =
+	    AsString::tryDeserialize("12345678-1234-5678+1234-567812345678");
+	ASSERT_FALSE(bad_separator.has_value());
+	EXPECT_EQ(bad_separator.error(), ParseError::BAD_SEPARATOR);
+
+	for (const auto* invalid : {"g2345678-1234-5678-1234-567812345678",
+	                            "12345678-1234-5678-1234-56781234567 ",
+	                            "12345678-+234-5678-1234-567812345678"}) {
+		auto bad_digit = AsString::tryDeserialize(invalid);
+		ASSERT_FALSE(bad_digit.has_value());
+		EXPECT_EQ(bad_digit.error(), ParseError::BAD_HEX_DIGIT);
+	}
+
+	EXPECT_FALSE(message(ParseError::BAD_HEX_DIGIT).empty());
+}
+
+// Test string round trip through the buffer and string_view interfaces
+TEST_F(TestUuidSerializer, BufferRoundTrip) {  // NOLINT
+	constexpr uint64_t UUID_MSB = 0x0192C0FFEE0070AB;
+	constexpr uint64_t UUID_LSB = 0x8000BEEF00C0FFEE;
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(UUID_MSB);
+	uuid.set_lsb(UUID_LSB);
+
+	AsString::Buffer buffer{};
+	AsString::serialize(uuid, buffer);
+	auto maybe_uuid = AsString::tryDeserialize({buffer.data(), buffer.size()});
+	ASSERT_TRUE(maybe_uuid.has_value());
+	EXPECT_EQ(maybe_uuid.value().msb(), UUID_MSB);
+	EXPECT_EQ(maybe_uuid.value().lsb(), UUID_LSB);
+}
+
 // Test byte serialization
 TEST_F(TestUuidSerializer, SerializeToBytes) {  // NOLINT
 	uprotocol::v1::UUID uuid;
@@ -242,6 +328,66 @@ TEST_F(TestUuidSerializer, DeserializeInvalidBytes) {  // NOLINT
 	             std::invalid_argument);
 }
 
+// Test byte serialization into a caller-provided array
+TEST_F(TestUuidSerializer, SerializeToByteBuffer) {  // NOLINT
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(0x1234567890ABCDEF);
+	uuid.set_lsb(0xFEDCBA0987654321);
+	constexpr AsBytes::Buffer EXPECTED_BYTES = {
+	    0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF,
+	    0xFE, 0xDC, 0xBA, 0x09, 0x87, 0x65, 0x43, 0x21};
+
+	AsBytes::Buffer buffer{};
+	AsBytes::serialize(uuid, buffer);
+	EXPECT_EQ(buffer, EXPECTED_BYTES);
+}
+
+// Test byte serialization into a slice of a larger region
+TEST_F(TestUuidSerializer, SerializeToByteSpan) {  // NOLINT
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(0x1234567890ABCDEF);
+	uuid.set_lsb(0xFEDCBA0987654321);
+	constexpr size_t HEADER_SIZE = 4;
+	std::vector<uint8_t> frame(HEADER_SIZE + AsBytes::LENGTH + 1, 0xAA);
+
+	uprotocol::utils::Span<uint8_t> region(frame);
+	AsBytes::serialize(uuid, region.subspan(HEADER_SIZE, AsBytes::LENGTH));
+
+	EXPECT_EQ(frame[HEADER_SIZE - 1], 0xAA);
+	EXPECT_EQ(frame[HEADER_SIZE], 0x12);
+	EXPECT_EQ(frame[HEADER_SIZE + AsBytes::LENGTH - 1], 0x21);
+	EXPECT_EQ(frame.back(), 0xAA);
+
+	auto uuid_back = AsBytes::deserialize(
+	    region.subspan(HEADER_SIZE, AsBytes::LENGTH));
+	EXPECT_EQ(uuid_back.msb(), uuid.msb());
+	EXPECT_EQ(uuid_back.lsb(), uuid.lsb());
+
+	EXPECT_THROW(AsBytes::serialize(uuid, region.first(AsBytes::LENGTH - 1)),
+	             std::invalid_argument);
+}
+
+// Test non-throwing byte deserialization
+TEST_F(TestUuidSerializer, TryDeserializeBytes) {  // NOLINT
+	constexpr AsBytes::Buffer UUID_BYTES = {
+	    0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF,
+	    0xFE, 0xDC, 0xBA, 0x09, 0x87, 0x65, 0x43, 0x21};
+
+	auto maybe_uuid = AsBytes::tryDeserialize(UUID_BYTES);
+	ASSERT_TRUE(maybe_uuid.has_value());
+	EXPECT_EQ(maybe_uuid.value().msb(), 0x1234567890ABCDEF);
+	EXPECT_EQ(maybe_uuid.value().lsb(), 0xFEDCBA0987654321);
+
+	uprotocol::utils::Span<const uint8_t> bytes(UUID_BYTES);
+	auto too_short = AsBytes::tryDeserialize(bytes.first(AsBytes::LENGTH - 1));
+	ASSERT_FALSE(too_short.has_value());
+	EXPECT_EQ(too_short.error(), ParseError::WRONG_LENGTH);
+
+	auto empty = AsBytes::tryDeserialize({});
+	ASSERT_FALSE(empty.has_value());
+	EXPECT_EQ(empty.error(), ParseError::WRONG_LENGTH);
+}
+
 // Test edge case: minimum values for msb and lsb
 TEST_F(TestUuidSerializer, SerializeDeserializeMinValues) {  // NOLINT
 	constexpr uint16_t NUM_BYTES = 16;
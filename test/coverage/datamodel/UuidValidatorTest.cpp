@@ -244,4 +244,51 @@ TEST_F(TestUuidValidator, InvalidUuidElapsedTime) {  // NOLINT
 	             validator::uuid::InvalidUuid);
 }
 
+// Checks against a CoarseClock use its cached time, tolerating timestamps up
+// to one resolution ahead of it
+TEST_F(TestUuidValidator, CoarseClockChecks) {  // NOLINT
+	constexpr uint64_t RESOLUTION_MS = 10;
+	constexpr std::chrono::milliseconds RESOLUTION(RESOLUTION_MS);
+	static constexpr uint64_t CACHED_MS = 1000000;
+	// Long resolution so that the source is only read at construction
+	utils::CoarseClock clock(std::chrono::hours(1), []() {
+		return utils::CoarseClock::Reading{
+		    std::chrono::system_clock::time_point(
+		        std::chrono::milliseconds(CACHED_MS)),
+		    {}};
+	});
+	utils::CoarseClock lenient(RESOLUTION, [&clock]() {
+		return utils::CoarseClock::Reading{clock.now(), {}};
+	});
+
+	constexpr uint64_t THIRTY_SECONDS_MS = 30000;
+	auto uuid = createFakeUuid(CACHED_MS - THIRTY_SECONDS_MS);
+	auto [expired, reason] =
+	    validator::uuid::isExpired(uuid, SIXTY_SECONDS, clock);
+	EXPECT_FALSE(expired);
+	std::tie(expired, reason) =
+	    validator::uuid::isExpired(uuid, std::chrono::seconds(10), clock);
+	EXPECT_TRUE(expired);
+	EXPECT_EQ(reason, validator::uuid::Reason::EXPIRED);
+	EXPECT_EQ(validator::uuid::getElapsedTime(uuid, clock), THIRTY_SECONDS);
+	EXPECT_EQ(validator::uuid::getRemainingTime(uuid, SIXTY_SECONDS, clock),
+	          THIRTY_SECONDS);
+
+	auto ahead = createFakeUuid(CACHED_MS + RESOLUTION_MS);
+	std::tie(expired, reason) =
+	    validator::uuid::isExpired(ahead, SIXTY_SECONDS, lenient);
+	EXPECT_FALSE(expired);
+	EXPECT_FALSE(reason);
+	EXPECT_EQ(validator::uuid::getElapsedTime(ahead, lenient),
+	          std::chrono::milliseconds(0));
+
+	auto future = createFakeUuid(CACHED_MS + RESOLUTION_MS + 1);
+	std::tie(expired, reason) =
+	    validator::uuid::isExpired(future, SIXTY_SECONDS, lenient);
+	EXPECT_FALSE(expired);
+	EXPECT_EQ(reason, validator::uuid::Reason::FROM_THE_FUTURE);
+	EXPECT_THROW(validator::uuid::getElapsedTime(future, lenient),  // NOLINT
+	             validator::uuid::InvalidUuid);
+}
+
 }  // namespace uprotocol::datamodel
@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/transport/ReceiveDispatcher.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using uprotocol::transport::ReceiveDispatcher;
+using uprotocol::v1::UMessage;
+using Connection =
+    uprotocol::utils::callbacks::Connection<void, const UMessage&>;
+using OverflowPolicy = ReceiveDispatcher::OverflowPolicy;
+
+// Holds listener calls until opened, and lets the test wait for a call to
+// be held.
+struct Gate {
+	void pass() {
+		std::unique_lock lock(mtx);
+		++waiting;
+		cv.notify_all();
+		cv.wait(lock, [this]() { return open; });
+	}
+
+	void waitForCall() {
+		std::unique_lock lock(mtx);
+		cv.wait(lock, [this]() { return waiting > 0; });
+	}
+
+	void release() {
+		std::lock_guard const lock(mtx);
+		open = true;
+		cv.notify_all();
+	}
+
+	std::mutex mtx;
+	std::condition_variable cv;
+	size_t waiting{0};
+	bool open{false};
+};
+
+class ReceiveDispatcherTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	ReceiveDispatcherTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	// Messages are numbered through the ID's lsb
+	static UMessage makeMessage(uint64_t sequence) {
+		UMessage message;
+		message.mutable_attributes()->mutable_id()->set_lsb(sequence);
+		return message;
+	}
+
+	static uint64_t sequenceOf(const UMessage& message) {
+		return message.attributes().id().lsb();
+	}
+
+	// Single worker, two message queue. The first message for the returned
+	// listener is held at the gate so that later messages stay queued.
+	struct Blocked {
+		explicit Blocked(OverflowPolicy overflow)
+		    : dispatcher(ReceiveDispatcher::Options{1, 2, overflow}) {
+			auto [h, c] = Connection::establish([this](const UMessage& m) {
+				if (sequenceOf(m) == 0) {
+					gate.pass();
+				}
+				received.push_back(sequenceOf(m));
+			});
+			handle = std::move(h);
+			listener = std::move(c);
+			EXPECT_TRUE(dispatcher.dispatch(listener, makeMessage(0)));
+			gate.waitForCall();
+		}
+
+		Gate gate;
+		std::vector<uint64_t> received;
+		ReceiveDispatcher dispatcher;
+		Connection::Handle handle;
+		ReceiveDispatcher::Listener listener;
+	};
+
+public:
+	~ReceiveDispatcherTest() override = default;
+};
+
+TEST_F(ReceiveDispatcherTest, OrderedPerListener) {  // NOLINT
+	constexpr size_t LISTENERS = 4;
+	constexpr uint64_t MESSAGES = 500;
+
+	ReceiveDispatcher dispatcher(
+	    ReceiveDispatcher::Options{4, MESSAGES, OverflowPolicy::BLOCK});
+	EXPECT_EQ(dispatcher.threads(), 4);
+
+	std::array<std::vector<uint64_t>, LISTENERS> received;
+	std::array<std::atomic<int>, LISTENERS> in_flight{};
+	std::atomic<bool> overlapped{false};
+	std::vector<Connection::Handle> handles;
+	std::vector<ReceiveDispatcher::Listener> listeners;
+	for (size_t i = 0; i < LISTENERS; ++i) {
+		auto [handle, listener] = Connection::establish(
+		    [&received, &in_flight, &overlapped, i](const UMessage& m) {
+			    if (++in_flight[i] != 1) {
+				    overlapped = true;
+			    }
+			    received[i].push_back(sequenceOf(m));
+			    --in_flight[i];
+		    });
+		handles.push_back(std::move(handle));
+		listeners.push_back(std::move(listener));
+	}
+
+	for (uint64_t sequence = 0; sequence < MESSAGES; ++sequence) {
+		for (auto& listener : listeners) {
+			EXPECT_TRUE(dispatcher.dispatch(listener, makeMessage(sequence)));
+		}
+	}
+	dispatcher.drain();
+
+	EXPECT_FALSE(overlapped);
+	for (const auto& sequences : received) {
+		ASSERT_EQ(sequences.size(), MESSAGES);
+		for (uint64_t sequence = 0; sequence < MESSAGES; ++sequence) {
+			EXPECT_EQ(sequences[sequence], sequence);
+		}
+	}
+	EXPECT_EQ(dispatcher.stats().delivered, LISTENERS * MESSAGES);
+	EXPECT_EQ(dispatcher.stats().dropped, 0);
+}
+
+TEST_F(ReceiveDispatcherTest, ParallelAcrossListeners) {  // NOLINT
+	ReceiveDispatcher dispatcher(ReceiveDispatcher::Options{2});
+
+	// The first listener can only return once the second has run, which
+	// requires them to be called on different workers.
+	std::promise<void> second_ran;
+	auto second_future = second_ran.get_future();
+	std::atomic<bool> first_saw_second{false};
+
+	auto [first_handle, first] = Connection::establish(
+	    [&second_future, &first_saw_second](const UMessage&) {
+		    first_saw_second = second_future.wait_for(std::chrono::seconds(
+		                           5)) == std::future_status::ready;
+	    });
+	auto [second_handle, second] = Connection::establish(
+	    [&second_ran](const UMessage&) { second_ran.set_value(); });
+
+	EXPECT_TRUE(dispatcher.dispatch(first, makeMessage(0)));
+	EXPECT_TRUE(dispatcher.dispatch(second, makeMessage(0)));
+	dispatcher.drain();
+	EXPECT_TRUE(first_saw_second);
+}
+
+TEST_F(ReceiveDispatcherTest, DropNewest) {  // NOLINT
+	Blocked blocked(OverflowPolicy::DROP_NEWEST);
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(1)));
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(2)));
+	EXPECT_FALSE(
+	    blocked.dispatcher.dispatch(blocked.listener, makeMessage(3)));
+
+	blocked.gate.release();
+	blocked.dispatcher.drain();
+	EXPECT_EQ(blocked.received, (std::vector<uint64_t>{0, 1, 2}));
+	EXPECT_EQ(blocked.dispatcher.stats().dropped, 1);
+	EXPECT_EQ(blocked.dispatcher.stats().delivered, 3);
+}
+
+TEST_F(ReceiveDispatcherTest, DropOldest) {  // NOLINT
+	Blocked blocked(OverflowPolicy::DROP_OLDEST);
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(1)));
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(2)));
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(3)));
+
+	blocked.gate.release();
+	blocked.dispatcher.drain();
+	EXPECT_EQ(blocked.received, (std::vector<uint64_t>{0, 2, 3}));
+	EXPECT_EQ(blocked.dispatcher.stats().dropped, 1);
+}
+
+TEST_F(ReceiveDispatcherTest, BlockUntilSpace) {  // NOLINT
+	Blocked blocked(OverflowPolicy::BLOCK);
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(1)));
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(2)));
+
+	auto third = std::async(std::launch::async, [&blocked]() {
+		return blocked.dispatcher.dispatch(blocked.listener, makeMessage(3));
+	});
+	EXPECT_EQ(third.wait_for(std::chrono::milliseconds(20)),
+	          std::future_status::timeout);
+
+	blocked.gate.release();
+	EXPECT_TRUE(third.get());
+	blocked.dispatcher.drain();
+	EXPECT_EQ(blocked.received, (std::vector<uint64_t>{0, 1, 2, 3}));
+	EXPECT_EQ(blocked.dispatcher.stats().dropped, 0);
+}
+
+TEST_F(ReceiveDispatcherTest, RemoveDiscardsQueued) {  // NOLINT
+	Blocked blocked(OverflowPolicy::DROP_NEWEST);
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(1)));
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(2)));
+	blocked.dispatcher.remove(blocked.listener);
+
+	blocked.gate.release();
+	blocked.dispatcher.drain();
+	EXPECT_EQ(blocked.received, (std::vector<uint64_t>{0}));
+	EXPECT_EQ(blocked.dispatcher.stats().dropped, 2);
+
+	// A removed listener can be used again
+	EXPECT_TRUE(blocked.dispatcher.dispatch(blocked.listener, makeMessage(4)));
+	blocked.dispatcher.drain();
+	EXPECT_EQ(blocked.received, (std::vector<uint64_t>{0, 4}));
+}
+
+TEST_F(ReceiveDispatcherTest, ListenerThrows) {  // NOLINT
+	ReceiveDispatcher dispatcher(ReceiveDispatcher::Options{1});
+	std::vector<uint64_t> received;
+	auto [handle, listener] =
+	    Connection::establish([&received](const UMessage& m) {
+		    if (sequenceOf(m) == 0) {
+			    throw std::runtime_error("listener failure");
+		    }
+		    received.push_back(sequenceOf(m));
+	    });
+
+	EXPECT_TRUE(dispatcher.dispatch(listener, makeMessage(0)));
+	EXPECT_TRUE(dispatcher.dispatch(listener, makeMessage(1)));
+	dispatcher.drain();
+	EXPECT_EQ(received, (std::vector<uint64_t>{1}));
+	EXPECT_EQ(dispatcher.stats().failed, 1);
+	EXPECT_EQ(dispatcher.stats().delivered, 1);
+}
+
+TEST_F(ReceiveDispatcherTest, InvalidOptions) {  // NOLINT
+	EXPECT_THROW(ReceiveDispatcher(ReceiveDispatcher::Options{1, 0}),
+	             std::invalid_argument);
+	ReceiveDispatcher dispatcher;
+	EXPECT_GE(dispatcher.threads(), 1);
+}
+
+}  // namespace
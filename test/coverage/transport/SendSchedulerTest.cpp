@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/validator/UMessage.h>
+#include <up-cpp/transport/SendScheduler.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::transport::SendScheduler;
+using uprotocol::v1::UCode;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPriority;
+using uprotocol::v1::UStatus;
+using uprotocol::v1::UUri;
+
+// Transport that records the priority of each message sent, and can hold
+// sends until released so that messages build up in the scheduler's queues.
+class GatedTransport : public uprotocol::transport::UTransport {
+public:
+	explicit GatedTransport(const UUri& uri)
+	    : uprotocol::transport::UTransport(uri) {}
+
+	void hold() {
+		std::lock_guard const lock(mtx_);
+		held_ = true;
+	}
+
+	void release() {
+		std::lock_guard const lock(mtx_);
+		held_ = false;
+		cv_.notify_all();
+	}
+
+	// Waits until a send is blocked by hold()
+	void waitForHeldSend() {
+		std::unique_lock lock(mtx_);
+		cv_.wait(lock, [this]() { return held_sends_ > 0; });
+	}
+
+	std::vector<UPriority> sent() const {
+		std::lock_guard const lock(mtx_);
+		return sent_;
+	}
+
+protected:
+	[[nodiscard]] UStatus sendImpl(const UMessage& message) override {
+		std::unique_lock lock(mtx_);
+		if (held_) {
+			++held_sends_;
+			cv_.notify_all();
+			cv_.wait(lock, [this]() { return !held_; });
+		}
+		sent_.push_back(message.attributes().priority());
+		UStatus status;
+		status.set_code(UCode::OK);
+		return status;
+	}
+
+	[[nodiscard]] UStatus registerListenerImpl(
+	    CallableConn&&, const UUri&, std::optional<UUri>&&) override {
+		UStatus status;
+		status.set_code(UCode::UNIMPLEMENTED);
+		return status;
+	}
+
+private:
+	mutable std::mutex mtx_;
+	std::condition_variable cv_;
+	bool held_{false};
+	size_t held_sends_{0};
+	std::vector<UPriority> sent_;
+};
+
+class SendSchedulerTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		UUri entity;
+		entity.set_authority_name("scheduler-test");
+		entity.set_ue_id(0x10001);
+		entity.set_ue_version_major(1);
+		entity.set_resource_id(0);
+		transport_ = std::make_shared<GatedTransport>(entity);
+	}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	SendSchedulerTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	UMessage makeMessage(UPriority priority) const {
+		constexpr uint32_t TOPIC_ID = 0x8001;
+		auto topic = transport_->getEntityUri();
+		topic.set_resource_id(TOPIC_ID);
+		return UMessageBuilder::publish(std::move(topic))
+		    .withPriority(priority)
+		    .build();
+	}
+
+	// Holds the transport with one CS0 message in the middle of being sent
+	// so that everything enqueued afterward waits in the queues.
+	void holdDispatcher(SendScheduler& scheduler) {
+		transport_->hold();
+		ASSERT_EQ(scheduler.enqueue(makeMessage(UPriority::UPRIORITY_CS0))
+		              .code(),
+		          UCode::OK);
+		transport_->waitForHeldSend();
+	}
+
+	void enqueue(SendScheduler& scheduler, UPriority priority, size_t count) {
+		for (size_t i = 0; i < count; ++i) {
+			ASSERT_EQ(scheduler.enqueue(makeMessage(priority)).code(),
+			          UCode::OK);
+		}
+	}
+
+	std::shared_ptr<GatedTransport> transport_;
+
+public:
+	~SendSchedulerTest() override = default;
+};
+
+TEST_F(SendSchedulerTest, StrictPriority) {  // NOLINT
+	SendScheduler scheduler(transport_);
+	holdDispatcher(scheduler);
+
+	enqueue(scheduler, UPriority::UPRIORITY_CS1, 3);
+	enqueue(scheduler, UPriority::UPRIORITY_CS6, 2);
+	enqueue(scheduler, UPriority::UPRIORITY_CS3, 1);
+	EXPECT_EQ(scheduler.stats(UPriority::UPRIORITY_CS1).depth, 3);
+
+	transport_->release();
+	scheduler.flush();
+
+	using P = UPriority;
+	EXPECT_EQ(transport_->sent(),
+	          (std::vector<UPriority>{P::UPRIORITY_CS0, P::UPRIORITY_CS6,
+	                                  P::UPRIORITY_CS6, P::UPRIORITY_CS3,
+	                                  P::UPRIORITY_CS1, P::UPRIORITY_CS1,
+	                                  P::UPRIORITY_CS1}));
+
+	auto stats = scheduler.stats(UPriority::UPRIORITY_CS1);
+	EXPECT_EQ(stats.depth, 0);
+	EXPECT_EQ(stats.enqueued, 3);
+	EXPECT_EQ(stats.dispatched, 3);
+	EXPECT_EQ(stats.rejected, 0);
+	EXPECT_EQ(stats.queue_latency.count, 3);
+	EXPECT_EQ(scheduler.stats(UPriority::UPRIORITY_CS6).queue_latency.count,
+	          2);
+}
+
+TEST_F(SendSchedulerTest, WeightedRoundRobin) {  // NOLINT
+	SendScheduler::Options options;
+	options.policy = SendScheduler::Policy::WEIGHTED;
+	options.weights = {1, 1, 1, 1, 1, 1, 2};
+	SendScheduler scheduler(transport_, options);
+	holdDispatcher(scheduler);
+
+	enqueue(scheduler, UPriority::UPRIORITY_CS1, 4);
+	enqueue(scheduler, UPriority::UPRIORITY_CS6, 6);
+
+	transport_->release();
+	scheduler.flush();
+
+	// CS1 is not starved: it gets one message per round while CS6 gets two
+	using P = UPriority;
+	EXPECT_EQ(
+	    transport_->sent(),
+	    (std::vector<UPriority>{
+	        P::UPRIORITY_CS0, P::UPRIORITY_CS6, P::UPRIORITY_CS6,
+	        P::UPRIORITY_CS1, P::UPRIORITY_CS6, P::UPRIORITY_CS6,
+	        P::UPRIORITY_CS1, P::UPRIORITY_CS6, P::UPRIORITY_CS6,
+	        P::UPRIORITY_CS1, P::UPRIORITY_CS1}));
+}
+
+TEST_F(SendSchedulerTest, Backpressure) {  // NOLINT
+	std::mutex signals_mtx;
+	std::vector<std::pair<UPriority, bool>> signals;
+
+	SendScheduler::Options options;
+	options.queue_capacity = 3;
+	options.high_watermark = 2;
+	options.low_watermark = 1;
+	options.on_backpressure = [&signals_mtx, &signals](UPriority priority,
+	                                                   bool congested) {
+		std::lock_guard const lock(signals_mtx);
+		signals.emplace_back(priority, congested);
+	};
+	SendScheduler scheduler(transport_, options);
+	holdDispatcher(scheduler);
+
+	enqueue(scheduler, UPriority::UPRIORITY_CS4, 1);
+	EXPECT_FALSE(scheduler.congested(UPriority::UPRIORITY_CS4));
+	enqueue(scheduler, UPriority::UPRIORITY_CS4, 2);
+	EXPECT_TRUE(scheduler.congested(UPriority::UPRIORITY_CS4));
+	EXPECT_FALSE(scheduler.congested(UPriority::UPRIORITY_CS5));
+
+	size_t sent_callbacks = 0;
+	auto status = scheduler.enqueue(makeMessage(UPriority::UPRIORITY_CS4),
+	                                [&sent_callbacks](const UStatus&) {
+		                                ++sent_callbacks;
+	                                });
+	EXPECT_EQ(status.code(), UCode::RESOURCE_EXHAUSTED);
+
+	// Other priorities are unaffected
+	enqueue(scheduler, UPriority::UPRIORITY_CS5, 1);
+
+	auto stats = scheduler.stats(UPriority::UPRIORITY_CS4);
+	EXPECT_EQ(stats.depth, 3);
+	EXPECT_EQ(stats.rejected, 1);
+	EXPECT_TRUE(stats.congested);
+
+	transport_->release();
+	scheduler.flush();
+	EXPECT_EQ(sent_callbacks, 0);
+	EXPECT_FALSE(scheduler.congested(UPriority::UPRIORITY_CS4));
+
+	std::lock_guard const lock(signals_mtx);
+	EXPECT_EQ(signals, (std::vector<std::pair<UPriority, bool>>{
+	                       {UPriority::UPRIORITY_CS4, true},
+	                       {UPriority::UPRIORITY_CS4, false}}));
+}
+
+TEST_F(SendSchedulerTest, SendCallbacks) {  // NOLINT
+	std::vector<UCode> results;
+	auto record = [&results](const UStatus& status) {
+		results.push_back(status.code());
+	};
+	std::thread releaser;
+
+	{
+		SendScheduler scheduler(transport_);
+		holdDispatcher(scheduler);
+
+		ASSERT_EQ(scheduler.enqueue(makeMessage(UPriority::UPRIORITY_CS2),
+		                            record)
+		              .code(),
+		          UCode::OK);
+
+		constexpr std::chrono::milliseconds TTL(1);
+		auto expiring = makeMessage(UPriority::UPRIORITY_CS1);
+		expiring.mutable_attributes()->set_ttl(TTL.count());
+		ASSERT_EQ(scheduler.enqueue(std::move(expiring), record).code(),
+		          UCode::OK);
+		std::this_thread::sleep_for(TTL * 5);
+
+		transport_->release();
+		scheduler.flush();
+		EXPECT_EQ(results,
+		          (std::vector<UCode>{UCode::OK, UCode::DEADLINE_EXCEEDED}));
+
+		// Left in the queue when the scheduler is destroyed
+		transport_->hold();
+		ASSERT_EQ(scheduler.enqueue(makeMessage(UPriority::UPRIORITY_CS0))
+		              .code(),
+		          UCode::OK);
+		transport_->waitForHeldSend();
+		ASSERT_EQ(scheduler.enqueue(makeMessage(UPriority::UPRIORITY_CS6),
+		                            record)
+		              .code(),
+		          UCode::OK);
+
+		releaser = std::thread([transport = transport_]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			transport->release();
+		});
+	}
+	releaser.join();
+	EXPECT_EQ(results, (std::vector<UCode>{UCode::OK, UCode::DEADLINE_EXCEEDED,
+	                                       UCode::CANCELLED}));
+}
+
+TEST_F(SendSchedulerTest, InvalidArguments) {  // NOLINT
+	EXPECT_THROW(SendScheduler(nullptr),
+	             uprotocol::transport::NullTransport);
+
+	SendScheduler::Options options;
+	options.queue_capacity = 0;
+	options.high_watermark = 0;
+	options.low_watermark = 0;
+	EXPECT_THROW(SendScheduler(transport_, options), std::invalid_argument);
+
+	options = {};
+	options.low_watermark = options.high_watermark + 1;
+	EXPECT_THROW(SendScheduler(transport_, options), std::invalid_argument);
+
+	options = {};
+	options.high_watermark = options.queue_capacity + 1;
+	EXPECT_THROW(SendScheduler(transport_, options), std::invalid_argument);
+
+	options = {};
+	options.weights[3] = 0;
+	EXPECT_THROW(SendScheduler(transport_, options), std::invalid_argument);
+
+	SendScheduler scheduler(transport_);
+	auto message = makeMessage(UPriority::UPRIORITY_CS1);
+	message.mutable_attributes()->clear_id();
+	EXPECT_THROW(std::ignore = scheduler.enqueue(std::move(message)),
+	             uprotocol::datamodel::validator::message::InvalidUMessage);
+	EXPECT_EQ(scheduler.stats(UPriority::UPRIORITY_CS1).enqueued, 0);
+}
+
+}  // namespace
@@ -158,6 +158,105 @@ TEST_F(TestUTransport, SendImplStatus) {  // NOLINT
 	EXPECT_EQ(result.code(), v1::UCode::PERMISSION_DENIED);
 }
 
+namespace {
+using Fragments = PayloadBuilder::Fragments;
+
+Fragments makeFragments() {
+	return {std::make_shared<const std::string>("[\"Arrival\", "),
+	        std::make_shared<const std::string>("\"Waterloo\"]")};
+}
+
+// Records the fragments it is given instead of a joined payload
+class GatherTransportMock : public test::UTransportMock {
+public:
+	using test::UTransportMock::UTransportMock;
+
+	std::vector<std::string> fragments;
+	v1::UMessage attributes_message;
+
+protected:
+	[[nodiscard]] v1::UStatus sendPayloadImpl(
+	    v1::UMessage&& message, PayloadBuilder&& payload) override {
+		attributes_message = std::move(message);
+		for (auto fragment : payload.fragments()) {
+			fragments.emplace_back(fragment);
+		}
+		return {};
+	}
+};
+}  // namespace
+
+TEST_F(TestUTransport, SendPayloadDefaultImpl) {  // NOLINT
+	auto transport_mock = makeMockTransport(getValidUri());
+	auto transport = makeTransport(transport_mock);
+
+	auto topic = getValidUri();
+	topic.set_resource_id(RESOURCE_ID_F00D);
+	PayloadBuilder payload(makeFragments(),
+	                       v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	auto message = builder.buildAttributesFor(payload);
+
+	auto result = transport->send(std::move(message), std::move(payload));
+
+	EXPECT_EQ(result.code(), v1::UCode::OK);
+	EXPECT_EQ(transport_mock->getSendCount(), 1);
+	EXPECT_EQ(transport_mock->getMessage().payload(),
+	          R"(["Arrival", "Waterloo"])");
+	EXPECT_EQ(transport_mock->getMessage().attributes().payload_format(),
+	          v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+}
+
+TEST_F(TestUTransport, SendPayloadFragments) {  // NOLINT
+	auto transport_mock = std::make_shared<GatherTransportMock>(getValidUri());
+	transport::UTransport& transport = *transport_mock;
+
+	auto topic = getValidUri();
+	topic.set_resource_id(RESOURCE_ID_F00D);
+	PayloadBuilder payload(makeFragments(),
+	                       v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+	auto message = UMessageBuilder::publish(std::move(topic)).build();
+
+	auto result = transport.send(std::move(message), std::move(payload));
+
+	EXPECT_EQ(result.code(), v1::UCode::OK);
+	EXPECT_EQ(transport_mock->getSendCount(), 0);
+	EXPECT_EQ(transport_mock->fragments,
+	          std::vector<std::string>({R"(["Arrival", )", R"("Waterloo"])"}));
+	EXPECT_TRUE(transport_mock->attributes_message.payload().empty());
+	// Format is taken from the payload
+	EXPECT_EQ(
+	    transport_mock->attributes_message.attributes().payload_format(),
+	    v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+}
+
+TEST_F(TestUTransport, SendPayloadInvalidMessage) {  // NOLINT
+	auto transport_mock = makeMockTransport(getValidUri());
+	auto transport = makeTransport(transport_mock);
+
+	auto topic = getValidUri();
+	topic.set_resource_id(RESOURCE_ID_F00D);
+	auto message = UMessageBuilder::publish(std::move(topic)).build();
+	auto with_payload = message;
+	with_payload.set_payload("already here");
+	message.mutable_attributes()->set_type(
+	    v1::UMessageType::UMESSAGE_TYPE_REQUEST);
+
+	EXPECT_THROW(  // NOLINT
+	    static_cast<void>(transport->send(
+	        std::move(message),
+	        PayloadBuilder(makeFragments(),
+	                       v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON))),
+	    InvalidUMessge);
+	EXPECT_THROW(  // NOLINT
+	    static_cast<void>(transport->send(
+	        std::move(with_payload),
+	        PayloadBuilder(makeFragments(),
+	                       v1::UPayloadFormat::UPAYLOAD_FORMAT_JSON))),
+	    InvalidUMessge);
+	EXPECT_EQ(transport_mock->getSendCount(), 0);
+}
+
 TEST_F(TestUTransport, RegisterListenerOk) {  // NOLINT
 	auto transport_mock = makeMockTransport(getValidUri());
 	auto transport = makeTransport(transport_mock);
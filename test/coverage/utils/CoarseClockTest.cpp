@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/validator/Uuid.h>
+#include <up-cpp/utils/CoarseClock.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+using uprotocol::utils::CoarseClock;
+
+class CoarseClockTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	CoarseClockTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	// Source that reads a time set by the test, for both clocks
+	struct FakeSource {
+		CoarseClock::Reading operator()() const {
+			auto since_epoch = std::chrono::milliseconds(ms->load());
+			return {CoarseClock::SystemTime(since_epoch),
+			        CoarseClock::SteadyTime(since_epoch)};
+		}
+
+		std::shared_ptr<std::atomic<int64_t>> ms =
+		    std::make_shared<std::atomic<int64_t>>(0);
+	};
+
+public:
+	~CoarseClockTest() override = default;
+};
+
+TEST_F(CoarseClockTest, ManualRefresh) {  // NOLINT
+	constexpr int64_t START_MS = 1000;
+	FakeSource source;
+	source.ms->store(START_MS);
+
+	CoarseClock clock(std::chrono::milliseconds(0), source);
+	EXPECT_EQ(clock.now().time_since_epoch(),
+	          std::chrono::milliseconds(START_MS));
+	EXPECT_EQ(clock.steadyNow().time_since_epoch(),
+	          std::chrono::milliseconds(START_MS));
+
+	// Without a refresh thread, changes are only seen after refresh()
+	source.ms->store(START_MS + 5);
+	EXPECT_EQ(clock.now().time_since_epoch(),
+	          std::chrono::milliseconds(START_MS));
+	clock.refresh();
+	EXPECT_EQ(clock.now().time_since_epoch(),
+	          std::chrono::milliseconds(START_MS + 5));
+	EXPECT_EQ(clock.steadyNow().time_since_epoch(),
+	          std::chrono::milliseconds(START_MS + 5));
+}
+
+TEST_F(CoarseClockTest, BackgroundRefresh) {  // NOLINT
+	FakeSource source;
+	CoarseClock clock(CoarseClock::DEFAULT_RESOLUTION, source);
+	EXPECT_EQ(clock.resolution(), CoarseClock::DEFAULT_RESOLUTION);
+
+	source.ms->store(1);
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while ((clock.now().time_since_epoch().count() == 0) &&
+	       (std::chrono::steady_clock::now() < deadline)) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(clock.now().time_since_epoch(), std::chrono::milliseconds(1));
+}
+
+TEST_F(CoarseClockTest, TracksSystemClock) {  // NOLINT
+	auto& clock = CoarseClock::global();
+	EXPECT_EQ(&clock, &CoarseClock::global());
+
+	auto before = std::chrono::system_clock::now();
+	auto steady_before = std::chrono::steady_clock::now();
+	// Allow generous slack for the refresh thread being descheduled
+	auto deadline = steady_before + std::chrono::seconds(5);
+	while ((clock.steadyNow() < steady_before) &&
+	       (std::chrono::steady_clock::now() < deadline)) {
+		std::this_thread::sleep_for(clock.resolution());
+	}
+
+	EXPECT_GE(clock.now(), before);
+	EXPECT_LE(clock.now(), std::chrono::system_clock::now());
+	EXPECT_GE(clock.steadyNow(), steady_before);
+	EXPECT_LE(clock.steadyNow(), std::chrono::steady_clock::now());
+}
+
+TEST_F(CoarseClockTest, MessageBuilder) {  // NOLINT
+	constexpr int64_t START_MS = 1000000;
+	FakeSource source;
+	source.ms->store(START_MS);
+	const CoarseClock clock(std::chrono::milliseconds(0), source);
+
+	uprotocol::v1::UUri topic;
+	topic.set_authority_name("clock-test");
+	topic.set_ue_id(0x10001);
+	topic.set_ue_version_major(1);
+	topic.set_resource_id(0x8001);
+
+	using uprotocol::datamodel::builder::UMessageBuilder;
+	auto message =
+	    UMessageBuilder::publish(std::move(topic)).withClock(clock).build();
+	EXPECT_EQ(uprotocol::datamodel::validator::uuid::getTime(
+	              message.attributes().id())
+	              .time_since_epoch(),
+	          std::chrono::milliseconds(START_MS));
+}
+
+TEST_F(CoarseClockTest, NegativeResolution) {  // NOLINT
+	EXPECT_THROW(CoarseClock(std::chrono::milliseconds(-1)),  // NOLINT
+	             std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/RpcServer.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/utils/Metrics.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "UTransportMock.h"
+
+namespace {
+
+using uprotocol::datamodel::builder::UMessageBuilder;
+using MaybePayload = std::optional<uprotocol::datamodel::builder::Payload>;
+using uprotocol::test::UTransportMock;
+using uprotocol::v1::UCode;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPriority;
+using uprotocol::v1::UUri;
+namespace metrics = uprotocol::utils::metrics;
+
+class MetricsTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		metrics::setEnabled(true);
+		metrics::Registry::global().reset();
+	}
+	void TearDown() override { metrics::setEnabled(false); }
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	MetricsTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getEntity(uint32_t ue_id) {
+		UUri uri;
+		uri.set_authority_name("metrics-test");
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(0);
+		return uri;
+	}
+
+	static UUri getMethod() {
+		constexpr uint32_t SERVER_ID = 0x10002;
+		constexpr uint32_t METHOD_ID = 0x0101;
+		auto method = getEntity(SERVER_ID);
+		method.set_resource_id(METHOD_ID);
+		return method;
+	}
+
+	static UMessage getPublish() {
+		constexpr uint32_t TOPIC_ID = 0x8001;
+		auto topic = getEntity(CLIENT_ID);
+		topic.set_resource_id(TOPIC_ID);
+		return UMessageBuilder::publish(std::move(topic)).build();
+	}
+
+	static uint64_t counter(const std::string& name) {
+		auto snapshot = metrics::Registry::global().snapshot();
+		auto found = snapshot.counters.find(name);
+		return (found == snapshot.counters.end()) ? 0 : found->second;
+	}
+
+	static constexpr uint32_t CLIENT_ID = 0x10001;
+
+public:
+	~MetricsTest() override = default;
+};
+
+TEST_F(MetricsTest, CounterAcrossThreads) {  // NOLINT
+	constexpr size_t THREADS = 8;
+	constexpr size_t INCREMENTS = 10000;
+
+	metrics::Registry registry;
+	auto& counter = registry.counter("test_total", "Test counter");
+
+	std::vector<std::thread> threads;
+	threads.reserve(THREADS);
+	for (size_t i = 0; i < THREADS; ++i) {
+		threads.emplace_back([&counter]() {
+			for (size_t j = 0; j < INCREMENTS; ++j) {
+				counter.increment();
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(counter.value(), THREADS * INCREMENTS);
+	EXPECT_EQ(registry.snapshot().counters.at("test_total"),
+	          THREADS * INCREMENTS);
+
+	counter.reset();
+	EXPECT_EQ(counter.value(), 0);
+}
+
+TEST_F(MetricsTest, HistogramBuckets) {  // NOLINT
+	using std::chrono::microseconds;
+	using std::chrono::nanoseconds;
+	using Histogram = metrics::Histogram;
+
+	EXPECT_EQ(Histogram::bucketFor(nanoseconds(0)), 0);
+	EXPECT_EQ(Histogram::bucketFor(microseconds(1)), 0);
+	EXPECT_EQ(Histogram::bucketFor(nanoseconds(1001)), 1);
+	EXPECT_EQ(Histogram::bucketFor(microseconds(2)), 1);
+	EXPECT_EQ(Histogram::bucketFor(microseconds(3)), 2);
+	EXPECT_EQ(Histogram::bucketFor(std::chrono::hours(1)),
+	          Histogram::BUCKETS - 1);
+
+	for (size_t i = 0; i + 1 < Histogram::BUCKETS; ++i) {
+		EXPECT_EQ(Histogram::bucketFor(Histogram::upperBound(i)), i);
+		EXPECT_EQ(Histogram::bucketFor(Histogram::upperBound(i) +
+		                               nanoseconds(1)),
+		          i + 1);
+	}
+	EXPECT_EQ(Histogram::upperBound(Histogram::BUCKETS - 1),
+	          nanoseconds::max());
+
+	Histogram histogram;
+	histogram.observe(microseconds(1));
+	histogram.observe(microseconds(3));
+	histogram.observe(microseconds(4));
+	auto snapshot = histogram.snapshot();
+	EXPECT_EQ(snapshot.count, 3);
+	EXPECT_EQ(snapshot.sum, microseconds(8));
+	EXPECT_EQ(snapshot.buckets[0], 1);
+	EXPECT_EQ(snapshot.buckets[1], 0);
+	EXPECT_EQ(snapshot.buckets[2], 2);
+
+	histogram.reset();
+	EXPECT_EQ(histogram.snapshot().count, 0);
+}
+
+TEST_F(MetricsTest, RegistrationReturnsExisting) {  // NOLINT
+	metrics::Registry registry;
+	auto& counter = registry.counter("test_total");
+	EXPECT_EQ(&counter, &registry.counter("test_total"));
+	EXPECT_NE(&counter, &registry.counter("test_total{label=\"a\"}"));
+	EXPECT_EQ(&registry.gauge("test_gauge"), &registry.gauge("test_gauge"));
+
+	EXPECT_THROW(registry.gauge("test_total"), std::invalid_argument);
+	EXPECT_THROW(registry.histogram("test_total{label=\"b\"}"),
+	             std::invalid_argument);
+	// A failed registration does not leave a metric behind
+	auto snapshot = registry.snapshot();
+	EXPECT_EQ(snapshot.counters.size(), 2);
+	EXPECT_EQ(snapshot.gauges.size(), 1);
+	EXPECT_TRUE(snapshot.histograms.empty());
+}
+
+TEST_F(MetricsTest, ExportText) {  // NOLINT
+	metrics::Registry registry;
+	registry.counter("test_total{reason=\"a\"}", "Test counter").increment(2);
+	registry.counter("test_total{reason=\"b\"}").increment();
+	registry.gauge("test_depth", "Test gauge").set(-3);
+	registry.histogram("test_seconds", "Test histogram")
+	    .observe(std::chrono::microseconds(3));
+
+	auto text = registry.exportText();
+	EXPECT_NE(text.find("# HELP test_total Test counter\n"
+	                    "# TYPE test_total counter\n"
+	                    "test_total{reason=\"a\"} 2\n"
+	                    "test_total{reason=\"b\"} 1\n"),
+	          std::string::npos);
+	EXPECT_NE(text.find("# TYPE test_depth gauge\ntest_depth -3\n"),
+	          std::string::npos);
+	EXPECT_NE(text.find("# TYPE test_seconds histogram\n"),
+	          std::string::npos);
+	EXPECT_NE(text.find("test_seconds_bucket{le=\"0.000002000\"} 0\n"
+	                    "test_seconds_bucket{le=\"0.000004000\"} 1\n"),
+	          std::string::npos);
+	EXPECT_NE(text.find("test_seconds_bucket{le=\"+Inf\"} 1\n"
+	                    "test_seconds_sum 0.000003000\n"
+	                    "test_seconds_count 1\n"),
+	          std::string::npos);
+}
+
+TEST_F(MetricsTest, DisabledIsNoOp) {  // NOLINT
+	metrics::setEnabled(false);
+	auto before = metrics::Registry::global().snapshot();
+
+	{
+		metrics::ScopedTimer timer([]() -> metrics::Histogram& {
+			ADD_FAILURE() << "Histogram looked up while disabled";
+			return metrics::Registry::global().histogram("unexpected");
+		});
+	}
+
+	auto transport = std::make_shared<UTransportMock>(getEntity(CLIENT_ID));
+	transport->getSendStatus().set_code(UCode::OK);
+	EXPECT_EQ(transport->send(getPublish()).code(), UCode::OK);
+	EXPECT_THROW(transport->send(UMessage()), std::exception);
+
+	auto after = metrics::Registry::global().snapshot();
+	EXPECT_EQ(before.counters, after.counters);
+	EXPECT_EQ(before.gauges, after.gauges);
+	EXPECT_EQ(before.histograms.size(), after.histograms.size());
+}
+
+TEST_F(MetricsTest, TransportSend) {  // NOLINT
+	auto transport = std::make_shared<UTransportMock>(getEntity(CLIENT_ID));
+	transport->getSendStatus().set_code(UCode::OK);
+	EXPECT_EQ(transport->send(getPublish()).code(), UCode::OK);
+
+	transport->getSendStatus().set_code(UCode::UNAVAILABLE);
+	EXPECT_EQ(transport->send(getPublish()).code(), UCode::UNAVAILABLE);
+
+	auto no_id = getPublish();
+	no_id.mutable_attributes()->clear_id();
+	EXPECT_THROW(transport->send(no_id), std::exception);
+
+	EXPECT_EQ(counter("up_transport_send_total"), 2);
+	EXPECT_EQ(counter("up_transport_send_failed_total"), 1);
+	EXPECT_EQ(counter("up_transport_send_invalid_total{reason=\"BAD_ID\"}"),
+	          1);
+}
+
+TEST_F(MetricsTest, RpcServer) {  // NOLINT
+	constexpr uint32_t SERVER_ID = 0x10002;
+	auto transport = std::make_shared<UTransportMock>(getEntity(SERVER_ID));
+	transport->getSendStatus().set_code(UCode::OK);
+	auto server = uprotocol::communication::RpcServer::create(
+	    transport, getMethod(), [](const UMessage&) -> MaybePayload {
+		    return std::nullopt;
+	    });
+	ASSERT_TRUE(server);
+
+	auto request =
+	    UMessageBuilder::request(getMethod(), getEntity(CLIENT_ID),
+	                             UPriority::UPRIORITY_CS4,
+	                             std::chrono::milliseconds(1000))
+	        .build();
+	transport->mockMessage(request);
+	transport->mockMessage(getPublish());
+
+	EXPECT_EQ(counter("up_rpc_server_requests_total"), 1);
+	EXPECT_EQ(counter("up_rpc_server_responses_total"), 1);
+	EXPECT_EQ(counter("up_rpc_server_requests_invalid_total"
+	                  "{reason=\"WRONG_MESSAGE_TYPE\"}"),
+	          1);
+
+	// Every delivery through the transport is a timed callback invocation
+	auto snapshot = metrics::Registry::global().snapshot();
+	EXPECT_EQ(snapshot.histograms.at("up_callback_duration_seconds").count,
+	          2);
+}
+
+TEST_F(MetricsTest, RpcClient) {  // NOLINT
+	auto transport = std::make_shared<UTransportMock>(getEntity(CLIENT_ID));
+	transport->getSendStatus().set_code(UCode::OK);
+
+	{
+		uprotocol::communication::RpcClient client(
+		    transport, UPriority::UPRIORITY_CS4, std::chrono::seconds(10));
+		auto invoked = client.invokeMethod(getMethod());
+
+		EXPECT_EQ(metrics::Registry::global().snapshot().gauges.at(
+		              "up_rpc_client_pending"),
+		          1);
+
+		transport->mockMessage(
+		    UMessageBuilder::response(transport->getMessage()).build());
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+		EXPECT_TRUE(invoked.get());
+
+		// No longer pending once the response is delivered, even though the
+		// request's TTL has not elapsed
+		EXPECT_EQ(metrics::Registry::global().snapshot().gauges.at(
+		              "up_rpc_client_pending"),
+		          0);
+	}
+
+	{
+		uprotocol::communication::RpcClient client(
+		    transport, UPriority::UPRIORITY_CS4,
+		    std::chrono::milliseconds(10));
+		auto invoked = client.invokeMethod(getMethod());
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+		auto result = invoked.get();
+		ASSERT_FALSE(result);
+		EXPECT_EQ(result.error().code(), UCode::DEADLINE_EXCEEDED);
+	}
+
+	EXPECT_EQ(counter("up_rpc_client_requests_total"), 2);
+	EXPECT_EQ(counter("up_rpc_client_responses_total"), 1);
+	EXPECT_EQ(counter("up_rpc_client_responses_failed_total"), 0);
+	EXPECT_EQ(counter("up_rpc_client_timeouts_total"), 1);
+	EXPECT_EQ(metrics::Registry::global().snapshot().gauges.at(
+	              "up_rpc_client_pending"),
+	          0);
+}
+
+}  // namespace
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include <up-cpp/utils/ProtoConverter.h>
+
+#include <string>
+
+namespace {
+
+using uprotocol::utils::ProtoConverter;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UUri;
+
+class ProtoConverterTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	ProtoConverterTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static uprotocol::core::usubscription::v3::SubscriptionRequest
+	getRequest() {
+		UUri topic;
+		topic.set_authority_name("proto-converter-test");
+		topic.set_ue_id(0x10001);
+		topic.set_ue_version_major(1);
+		topic.set_resource_id(0x8001);
+
+		return ProtoConverter::BuildSubscriptionRequest(
+		    topic, ProtoConverter::BuildSubscribeAttributes(
+		               std::nullopt, std::nullopt,
+		               std::chrono::milliseconds(100)));
+	}
+
+	static std::string packWithAny(const google::protobuf::Message& proto) {
+		google::protobuf::Any any;
+		any.PackFrom(proto);
+		return any.SerializeAsString();
+	}
+
+	static UMessage wrappedInAny(std::string payload) {
+		UMessage message;
+		message.set_payload(std::move(payload));
+		message.mutable_attributes()->set_payload_format(
+		    UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY);
+		return message;
+	}
+
+public:
+	~ProtoConverterTest() override = default;
+};
+
+TEST_F(ProtoConverterTest, PackToAnyMatchesAny) {  // NOLINT
+	auto request = getRequest();
+	EXPECT_EQ(ProtoConverter::packToAny(request), packWithAny(request));
+
+	// Empty value field is omitted, as Any does
+	UUri empty;
+	EXPECT_EQ(ProtoConverter::packToAny(empty), packWithAny(empty));
+}
+
+TEST_F(ProtoConverterTest, ProtoToPayloadRoundTrip) {  // NOLINT
+	auto request = getRequest();
+	auto payload = ProtoConverter::protoToPayload(request);
+	ASSERT_TRUE(payload);
+	EXPECT_EQ(payload->format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_PROTOBUF_WRAPPED_IN_ANY);
+	EXPECT_EQ(payload->data(), packWithAny(request));
+
+	UMessage message;
+	std::move(payload).value().buildInto(message);
+	auto extracted = ProtoConverter::extractFromProtobuf<
+	    uprotocol::core::usubscription::v3::SubscriptionRequest>(message);
+	ASSERT_TRUE(extracted);
+	EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+	    *extracted, request));
+}
+
+TEST_F(ProtoConverterTest, ParseAny) {  // NOLINT
+	auto request = getRequest();
+	const auto serialized = packWithAny(request);
+
+	auto fields = ProtoConverter::parseAny(serialized);
+	ASSERT_TRUE(fields);
+	EXPECT_EQ(fields->type_url,
+	          "type.googleapis.com/" + request.GetDescriptor()->full_name());
+	EXPECT_EQ(fields->value, request.SerializeAsString());
+	// Fields are views into the serialized data
+	EXPECT_GE(fields->value.data(), serialized.data());
+	EXPECT_LE(fields->value.data() + fields->value.size(),
+	          serialized.data() + serialized.size());
+
+	// Unknown fields are skipped
+	const std::string unknown_varint("\x18\x2a", 2);
+	auto with_unknown = ProtoConverter::parseAny(unknown_varint + serialized);
+	ASSERT_TRUE(with_unknown);
+	EXPECT_EQ(with_unknown->value, request.SerializeAsString());
+
+	auto empty = ProtoConverter::parseAny("");
+	ASSERT_TRUE(empty);
+	EXPECT_TRUE(empty->type_url.empty());
+	EXPECT_TRUE(empty->value.empty());
+
+	EXPECT_FALSE(ProtoConverter::parseAny(
+	    std::string_view(serialized).substr(0, serialized.size() - 1)));
+	EXPECT_FALSE(ProtoConverter::parseAny(std::string("\x0a\x05" "ab", 4)));
+	EXPECT_FALSE(ProtoConverter::parseAny(std::string("\x00\x01", 2)));
+}
+
+TEST_F(ProtoConverterTest, AnyTypeMatches) {  // NOLINT
+	EXPECT_TRUE(ProtoConverter::anyTypeMatches(
+	    "type.googleapis.com/uprotocol.v1.UUri", "uprotocol.v1.UUri"));
+	EXPECT_TRUE(ProtoConverter::anyTypeMatches("/uprotocol.v1.UUri",
+	                                           "uprotocol.v1.UUri"));
+	EXPECT_FALSE(ProtoConverter::anyTypeMatches("uprotocol.v1.UUri",
+	                                            "uprotocol.v1.UUri"));
+	EXPECT_FALSE(ProtoConverter::anyTypeMatches(
+	    "type.googleapis.com/xuprotocol.v1.UUri", "uprotocol.v1.UUri"));
+	EXPECT_FALSE(ProtoConverter::anyTypeMatches(
+	    "type.googleapis.com/uprotocol.v1.UUri", "uprotocol.v1.UMessage"));
+}
+
+TEST_F(ProtoConverterTest, ExtractFromAnyErrors) {  // NOLINT
+	auto request = getRequest();
+
+	// Wrong type in the Any
+	auto wrong_type = ProtoConverter::extractFromProtobuf<UUri>(
+	    wrappedInAny(packWithAny(request)));
+	ASSERT_FALSE(wrong_type);
+	EXPECT_EQ(wrong_type.error().code(), uprotocol::v1::UCode::INTERNAL);
+
+	// Not an Any at all
+	auto not_any = ProtoConverter::extractFromProtobuf<UUri>(
+	    wrappedInAny(std::string("\x0a\xff", 2)));
+	ASSERT_FALSE(not_any);
+	EXPECT_EQ(not_any.error().code(), uprotocol::v1::UCode::INTERNAL);
+
+	// Value is not a valid encoding of the named type
+	google::protobuf::Any any;
+	any.set_type_url("type.googleapis.com/uprotocol.v1.UUri");
+	any.set_value(std::string("\x0a\xff", 2));
+	auto bad_value = ProtoConverter::extractFromProtobuf<UUri>(
+	    wrappedInAny(any.SerializeAsString()));
+	ASSERT_FALSE(bad_value);
+	EXPECT_EQ(bad_value.error().code(), uprotocol::v1::UCode::INTERNAL);
+}
+
+}  // namespace
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/ProtoReader.h>
+#include <uprotocol/core/usubscription/v3/usubscription.pb.h>
+#include <uprotocol/v1/uri.pb.h>
+
+#include <string>
+
+namespace {
+
+using uprotocol::core::usubscription::v3::Update;
+using uprotocol::utils::ProtoReader;
+using uprotocol::v1::UUri;
+
+class ProtoReaderTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	ProtoReaderTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getTopic() {
+		UUri topic;
+		topic.set_authority_name("proto-reader-test");
+		topic.set_ue_id(0xFFFF8000);
+		topic.set_ue_version_major(1);
+		topic.set_resource_id(0x8001);
+		return topic;
+	}
+
+public:
+	~ProtoReaderTest() override = default;
+};
+
+TEST_F(ProtoReaderTest, ReadsAllFields) {  // NOLINT
+	const auto topic = getTopic();
+	const auto serialized = topic.SerializeAsString();
+
+	ProtoReader reader(serialized);
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.fieldNumber(), UUri::kAuthorityNameFieldNumber);
+	EXPECT_EQ(reader.wireType(), ProtoReader::WireType::LENGTH_DELIMITED);
+	EXPECT_EQ(reader.bytes(), topic.authority_name());
+	EXPECT_FALSE(reader.varint());
+
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.fieldNumber(), UUri::kUeIdFieldNumber);
+	EXPECT_EQ(reader.wireType(), ProtoReader::WireType::VARINT);
+	EXPECT_EQ(reader.varint(), topic.ue_id());
+	EXPECT_FALSE(reader.bytes());
+
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.fieldNumber(), UUri::kUeVersionMajorFieldNumber);
+	EXPECT_EQ(reader.varint(), topic.ue_version_major());
+
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.fieldNumber(), UUri::kResourceIdFieldNumber);
+	EXPECT_EQ(reader.varint(), topic.resource_id());
+
+	EXPECT_FALSE(reader.next());
+	EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(ProtoReaderTest, FixedWidthFields) {  // NOLINT
+	// Field 1 fixed64, field 2 fixed32, field 3 varint
+	const std::string serialized(
+	    "\x09\x01\x02\x03\x04\x05\x06\x07\x08"
+	    "\x15\x01\x02\x03\x04"
+	    "\x18\x2a",
+	    16);
+
+	ProtoReader reader(serialized);
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.wireType(), ProtoReader::WireType::FIXED64);
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.wireType(), ProtoReader::WireType::FIXED32);
+	ASSERT_TRUE(reader.next());
+	EXPECT_EQ(reader.fieldNumber(), 3);
+	EXPECT_EQ(reader.varint(), 42);
+	EXPECT_FALSE(reader.next());
+	EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(ProtoReaderTest, FindsNestedTopic) {  // NOLINT
+	Update update;
+	*update.mutable_topic() = getTopic();
+	update.mutable_subscriber()->mutable_uri()->set_authority_name("other");
+	update.mutable_status()->set_message("subscribed");
+	const auto serialized = update.SerializeAsString();
+
+	auto topic =
+	    ProtoReader::findBytes(serialized, Update::kTopicFieldNumber);
+	ASSERT_TRUE(topic);
+	EXPECT_EQ(*topic, getTopic().SerializeAsString());
+	// The topic is a view into the serialized data
+	EXPECT_GE(topic->data(), serialized.data());
+	EXPECT_LT(topic->data(), serialized.data() + serialized.size());
+
+	auto authority =
+	    ProtoReader::findBytes(*topic, UUri::kAuthorityNameFieldNumber);
+	EXPECT_EQ(authority, getTopic().authority_name());
+
+	EXPECT_FALSE(ProtoReader::findBytes(serialized, 1000));
+	// Not length-delimited
+	EXPECT_FALSE(ProtoReader::findBytes(*topic, UUri::kUeIdFieldNumber));
+}
+
+TEST_F(ProtoReaderTest, LastOccurrenceWins) {  // NOLINT
+	const std::string serialized("\x0a\x01" "a" "\x0a\x01" "b", 6);
+	EXPECT_EQ(ProtoReader::findBytes(serialized, 1), "b");
+}
+
+TEST_F(ProtoReaderTest, MalformedData) {  // NOLINT
+	const auto serialized = getTopic().SerializeAsString();
+
+	const std::string malformed[] = {
+	    // Truncated length-delimited field
+	    serialized.substr(0, 5),
+	    // Truncated varint
+	    std::string("\x10\xff", 2),
+	    // Field number zero
+	    std::string("\x00\x01", 2),
+	    // Group wire type
+	    std::string("\x0b\x0c", 2),
+	    // Truncated fixed32
+	    std::string("\x15\x01\x02", 3),
+	    // Varint longer than 10 bytes
+	    std::string("\x10") + std::string(10, '\xff') + std::string("\x01"),
+	};
+
+	for (const auto& data : malformed) {
+		ProtoReader reader(data);
+		while (reader.next()) {
+		}
+		EXPECT_TRUE(reader.failed());
+		EXPECT_FALSE(reader.next());
+		EXPECT_FALSE(ProtoReader::findBytes(data, 1));
+	}
+}
+
+TEST_F(ProtoReaderTest, EmptyData) {  // NOLINT
+	ProtoReader reader("");
+	EXPECT_FALSE(reader.next());
+	EXPECT_FALSE(reader.failed());
+	EXPECT_FALSE(ProtoReader::findBytes("", 1));
+}
+
+}  // namespace
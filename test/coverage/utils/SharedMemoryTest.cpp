@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <up-cpp/datamodel/builder/Payload.h>
+#include <up-cpp/utils/ProtoConverter.h>
+#include <up-cpp/utils/SharedMemory.h>
+#include <uprotocol/v1/uri.pb.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::utils::ShmDescriptor;
+using uprotocol::utils::ShmPool;
+using uprotocol::utils::ShmSegment;
+using uprotocol::utils::ShmView;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPayloadFormat;
+
+class SharedMemoryTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	SharedMemoryTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static void write(const ShmSegment& segment, std::string_view text,
+	                  size_t offset = 0) {
+		std::memcpy(segment.data().data() + offset, text.data(), text.size());
+	}
+
+	static UMessage messageFor(Payload&& payload) {
+		UMessage message;
+		std::move(payload).buildInto(message);
+		return message;
+	}
+
+public:
+	~SharedMemoryTest() override = default;
+};
+
+TEST_F(SharedMemoryTest, DescriptorRoundTrip) {
+	ShmDescriptor descriptor;
+	descriptor.name = "/some-segment";
+	descriptor.generation = 0x0102030405060708;
+	descriptor.offset = 4096;
+	descriptor.length = 12;
+
+	auto parsed = ShmDescriptor::deserialize(descriptor.serialize());
+	ASSERT_TRUE(parsed);
+	EXPECT_EQ(parsed->name, descriptor.name);
+	EXPECT_EQ(parsed->generation, descriptor.generation);
+	EXPECT_EQ(parsed->offset, descriptor.offset);
+	EXPECT_EQ(parsed->length, descriptor.length);
+}
+
+TEST_F(SharedMemoryTest, DescriptorParseErrors) {
+	ShmDescriptor descriptor;
+	descriptor.name = "/some-segment";
+	const auto serialized = descriptor.serialize();
+
+	auto bad_magic = ShmDescriptor::deserialize("not a descriptor at all");
+	ASSERT_FALSE(bad_magic);
+	EXPECT_EQ(bad_magic.error(), ShmDescriptor::ParseError::BAD_MAGIC);
+
+	auto bad_version = serialized;
+	bad_version[4] = 2;
+	auto parsed = ShmDescriptor::deserialize(bad_version);
+	ASSERT_FALSE(parsed);
+	EXPECT_EQ(parsed.error(), ShmDescriptor::ParseError::BAD_VERSION);
+
+	auto truncated = ShmDescriptor::deserialize(
+	    std::string_view(serialized).substr(0, serialized.size() - 1));
+	ASSERT_FALSE(truncated);
+	EXPECT_EQ(truncated.error(), ShmDescriptor::ParseError::WRONG_LENGTH);
+
+	auto extended = ShmDescriptor::deserialize(serialized + "x");
+	ASSERT_FALSE(extended);
+	EXPECT_EQ(extended.error(), ShmDescriptor::ParseError::WRONG_LENGTH);
+
+	descriptor.name = std::string(256, 'a');
+	EXPECT_THROW(static_cast<void>(descriptor.serialize()),
+	             std::length_error);
+}
+
+TEST_F(SharedMemoryTest, InvalidPoolPrefix) {
+	EXPECT_THROW(ShmPool(""), std::invalid_argument);
+	EXPECT_THROW(ShmPool("a/b"), std::invalid_argument);
+	EXPECT_THROW(ShmPool(std::string(201, 'a')), std::invalid_argument);
+}
+
+TEST_F(SharedMemoryTest, WriteAndOpen) {
+	ShmPool pool("up-cpp-test");
+	auto segment = pool.allocate(100);
+	EXPECT_GE(segment.capacity(), 100);
+	EXPECT_EQ(segment.data().size(), segment.capacity());
+	EXPECT_EQ(pool.size(), 1);
+
+	write(segment, "hello shared memory", 10);
+	auto view = ShmView::open(segment.describe(19, 10));
+	ASSERT_TRUE(view);
+	EXPECT_EQ(view->view(), "hello shared memory");
+	EXPECT_EQ(view->data().size(), 19);
+
+	// Writes through the segment are visible through existing views
+	write(segment, "j", 10);
+	EXPECT_EQ(view->view(), "jello shared memory");
+}
+
+TEST_F(SharedMemoryTest, DescribeOutOfRange) {
+	ShmPool pool("up-cpp-test");
+	auto segment = pool.allocate(16);
+	EXPECT_NO_THROW(
+	    static_cast<void>(segment.describe(segment.capacity())));
+	EXPECT_THROW(
+	    static_cast<void>(segment.describe(segment.capacity() + 1)),
+	    std::out_of_range);
+	EXPECT_THROW(static_cast<void>(segment.describe(1, segment.capacity())),
+	             std::out_of_range);
+
+	auto descriptor = segment.describe(1);
+	descriptor.offset = segment.capacity();
+	auto view = ShmView::open(descriptor);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::OUT_OF_RANGE);
+}
+
+// A segment whose header claims more capacity than the file holds is
+// rejected rather than mapped past its end
+TEST_F(SharedMemoryTest, CapacityLargerThanSegment) {
+	const auto page = static_cast<off_t>(sysconf(_SC_PAGESIZE));
+	ShmPool pool("up-cpp-test");
+	auto segment = pool.allocate(static_cast<size_t>(page) * 3);
+	auto descriptor = segment.describe(16);
+
+	const int fd = shm_open(descriptor.name.c_str(), O_RDWR, 0);
+	ASSERT_GE(fd, 0);
+	// Header page and one page of data
+	ASSERT_EQ(ftruncate(fd, page * 2), 0);
+	close(fd);
+
+	auto view = ShmView::open(descriptor);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::OUT_OF_RANGE);
+}
+
+TEST_F(SharedMemoryTest, SegmentReusedOnlyWhenReleased) {
+	ShmPool pool("up-cpp-test");
+	auto first = pool.allocate(16);
+	const auto first_descriptor = first.describe(4);
+
+	{
+		auto view = ShmView::open(first_descriptor);
+		ASSERT_TRUE(view);
+
+		// Writer released, but the view still holds a reference
+		{ auto released = std::move(first); }
+		auto second = pool.allocate(16);
+		EXPECT_EQ(pool.size(), 2);
+		EXPECT_NE(second.describe(4).name, first_descriptor.name);
+	}
+
+	// Both segments are now released, so no new one is created
+	auto third = pool.allocate(16);
+	EXPECT_EQ(pool.size(), 2);
+
+	ASSERT_EQ(third.describe(4).name, first_descriptor.name);
+	auto stale = ShmView::open(first_descriptor);
+	ASSERT_FALSE(stale);
+	EXPECT_EQ(stale.error(), ShmView::OpenError::STALE);
+}
+
+TEST_F(SharedMemoryTest, ReleasedSegmentIsStale) {
+	ShmPool pool("up-cpp-test");
+	ShmDescriptor descriptor;
+	{
+		auto segment = pool.allocate(16);
+		descriptor = segment.describe(4);
+	}
+	auto reused = pool.allocate(16);
+	ASSERT_EQ(reused.describe(4).name, descriptor.name);
+	EXPECT_NE(reused.describe(4).generation, descriptor.generation);
+
+	auto view = ShmView::open(descriptor);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::STALE);
+
+	// A failed open does not leave a reference behind
+	{ auto released = std::move(reused); }
+	auto again = pool.allocate(16);
+	EXPECT_EQ(pool.size(), 1);
+}
+
+TEST_F(SharedMemoryTest, LargerSegmentCreatedWhenNeeded) {
+	ShmPool pool("up-cpp-test");
+	{ auto small = pool.allocate(16); }
+	auto large = pool.allocate(1024 * 1024);
+	EXPECT_GE(large.capacity(), 1024 * 1024);
+	EXPECT_EQ(pool.size(), 2);
+}
+
+TEST_F(SharedMemoryTest, SegmentsUnlinkedWithPool) {
+	ShmDescriptor descriptor;
+	{
+		ShmPool pool("up-cpp-test");
+		auto segment = pool.allocate(16);
+		descriptor = segment.describe(4);
+	}
+	auto view = ShmView::open(descriptor);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::UNAVAILABLE);
+}
+
+TEST_F(SharedMemoryTest, OpenMissingSegment) {
+	ShmDescriptor descriptor;
+	descriptor.name = "/up-cpp-test-does-not-exist";
+	auto view = ShmView::open(descriptor);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::UNAVAILABLE);
+}
+
+TEST_F(SharedMemoryTest, OpenFromMessage) {
+	ShmPool pool("up-cpp-test");
+	auto segment = pool.allocate(64);
+	write(segment, "payload");
+
+	auto message = messageFor(Payload(segment, 7));
+	EXPECT_EQ(message.attributes().payload_format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_SHM);
+	EXPECT_LT(message.payload().size(), 64);
+
+	auto view = ShmView::open(message);
+	ASSERT_TRUE(view);
+	EXPECT_EQ(view->view(), "payload");
+
+	EXPECT_THROW(Payload(segment, segment.capacity() + 1), std::out_of_range);
+}
+
+TEST_F(SharedMemoryTest, OpenFromBadMessage) {
+	UMessage message;
+	message.set_payload("not a descriptor");
+	message.mutable_attributes()->set_payload_format(
+	    UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	auto view = ShmView::open(message);
+	ASSERT_FALSE(view);
+	EXPECT_EQ(view.error(), ShmView::OpenError::WRONG_FORMAT);
+
+	message.mutable_attributes()->set_payload_format(
+	    UPayloadFormat::UPAYLOAD_FORMAT_SHM);
+	auto bad_descriptor = ShmView::open(message);
+	ASSERT_FALSE(bad_descriptor);
+	EXPECT_EQ(bad_descriptor.error(), ShmView::OpenError::BAD_DESCRIPTOR);
+	EXPECT_FALSE(uprotocol::utils::message(bad_descriptor.error()).empty());
+}
+
+TEST_F(SharedMemoryTest, ExtractFromProtobuf) {
+	using uprotocol::utils::ProtoConverter;
+
+	uprotocol::v1::UUri uri;
+	uri.set_authority_name("shared-memory-authority");
+	uri.set_ue_id(0x8000);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(0x8001);
+	const auto serialized = uri.SerializeAsString();
+
+	ShmPool pool("up-cpp-test");
+	auto segment = pool.allocate(serialized.size());
+	write(segment, serialized);
+
+	auto message = messageFor(Payload(segment, serialized.size()));
+	auto extracted =
+	    ProtoConverter::extractFromProtobuf<uprotocol::v1::UUri>(message);
+	ASSERT_TRUE(extracted);
+	EXPECT_EQ(extracted->SerializeAsString(), serialized);
+
+	write(segment, "\xff\xff\xff");
+	auto corrupt =
+	    ProtoConverter::extractFromProtobuf<uprotocol::v1::UUri>(message);
+	ASSERT_FALSE(corrupt);
+	EXPECT_EQ(corrupt.error().code(), uprotocol::v1::UCode::INTERNAL);
+
+	{ auto released = std::move(segment); }
+	auto reused = pool.allocate(serialized.size());
+	auto stale =
+	    ProtoConverter::extractFromProtobuf<uprotocol::v1::UUri>(message);
+	ASSERT_FALSE(stale);
+	EXPECT_EQ(stale.error().code(), uprotocol::v1::UCode::UNAVAILABLE);
+}
+
+}  // namespace
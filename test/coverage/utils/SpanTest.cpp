@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/Span.h>
+
+#include <array>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using uprotocol::utils::Span;
+
+class SpanTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	SpanTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+public:
+	~SpanTest() override = default;
+};
+
+TEST_F(SpanTest, DefaultIsEmpty) {  // NOLINT
+	Span<int> span;
+	EXPECT_TRUE(span.empty());
+	EXPECT_EQ(span.size(), 0);
+	EXPECT_EQ(span.data(), nullptr);
+	EXPECT_EQ(span.begin(), span.end());
+}
+
+TEST_F(SpanTest, ViewsContainers) {  // NOLINT
+	std::vector<int> vec(5);
+	std::iota(vec.begin(), vec.end(), 0);
+	Span<int> from_vec(vec);
+	EXPECT_EQ(from_vec.data(), vec.data());
+	EXPECT_EQ(from_vec.size(), vec.size());
+	EXPECT_EQ(from_vec.size_bytes(), vec.size() * sizeof(int));
+
+	const std::array<char, 3> arr = {'a', 'b', 'c'};
+	Span<const char> from_arr(arr);
+	EXPECT_EQ(from_arr.front(), 'a');
+	EXPECT_EQ(from_arr.back(), 'c');
+
+	const std::string str = "hello";
+	Span<const char> from_str(str);
+	EXPECT_EQ(std::string(from_str.begin(), from_str.end()), str);
+}
+
+TEST_F(SpanTest, WritesThrough) {  // NOLINT
+	std::vector<int> vec(3, 0);
+	Span<int> span(vec);
+	span[1] = 42;
+	for (auto& value : span.subspan(2)) {
+		value = 7;
+	}
+	EXPECT_EQ(vec, (std::vector<int>{0, 42, 7}));
+}
+
+TEST_F(SpanTest, ConvertsToConst) {  // NOLINT
+	std::vector<int> vec = {1, 2, 3};
+	Span<int> mutable_span(vec);
+	Span<const int> const_span = mutable_span;
+	EXPECT_EQ(const_span.data(), vec.data());
+	EXPECT_EQ(const_span.size(), vec.size());
+}
+
+TEST_F(SpanTest, RejectsIncompatibleTypes) {  // NOLINT
+	// Must not be a hard error, so Span can be used in overload sets
+	EXPECT_FALSE((std::is_constructible_v<Span<const int>, int>));
+	EXPECT_FALSE((std::is_constructible_v<Span<int>, const std::vector<int>&>));
+	EXPECT_FALSE((std::is_constructible_v<Span<int>, std::vector<long>&>));
+}
+
+TEST_F(SpanTest, Slices) {  // NOLINT
+	std::vector<int> vec(10);
+	std::iota(vec.begin(), vec.end(), 0);
+	Span<const int> span(vec);
+
+	auto first = span.first(3);
+	EXPECT_EQ(first.size(), 3);
+	EXPECT_EQ(first.back(), 2);
+
+	auto last = span.last(3);
+	EXPECT_EQ(last.size(), 3);
+	EXPECT_EQ(last.front(), 7);
+
+	auto middle = span.subspan(4, 2);
+	EXPECT_EQ(middle.size(), 2);
+	EXPECT_EQ(middle[0], 4);
+	EXPECT_EQ(middle[1], 5);
+
+	EXPECT_TRUE(span.subspan(span.size()).empty());
+}
+
+TEST_F(SpanTest, SlicesOutOfRangeThrow) {  // NOLINT
+	std::vector<int> vec(4);
+	Span<const int> span(vec);
+	EXPECT_THROW(span.first(5), std::out_of_range);
+	EXPECT_THROW(span.last(5), std::out_of_range);
+	EXPECT_THROW(span.subspan(5), std::out_of_range);
+	EXPECT_THROW(span.subspan(2, 3), std::out_of_range);
+}
+
+}  // namespace
@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/Subscriber.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/utils/Tracing.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "UTransportMock.h"
+
+namespace {
+
+using MsgDiff = google::protobuf::util::MessageDifferencer;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::test::UTransportMock;
+using uprotocol::v1::UCode;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UUID;
+using uprotocol::v1::UUri;
+namespace tracing = uprotocol::utils::tracing;
+using tracing::Probe;
+
+class TracingTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		sink_ = std::make_shared<tracing::RingBufferSink>(SINK_CAPACITY);
+		tracing::setSink(sink_);
+	}
+	void TearDown() override { tracing::setSink(nullptr); }
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TracingTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri getEntity() {
+		UUri uri;
+		uri.set_authority_name("tracing-test");
+		uri.set_ue_id(0x10001);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(0);
+		return uri;
+	}
+
+	static UUri getTopic() {
+		constexpr uint32_t TOPIC_ID = 0x8001;
+		auto topic = getEntity();
+		topic.set_resource_id(TOPIC_ID);
+		return topic;
+	}
+
+	static UUID makeId(uint64_t lsb) {
+		UUID id;
+		id.set_msb(1);
+		id.set_lsb(lsb);
+		return id;
+	}
+
+	// Filters recorded events down to those about a single ID
+	std::vector<tracing::Event> eventsFor(const UUID& id) const {
+		std::vector<tracing::Event> matching;
+		for (const auto& event : sink_->events()) {
+			if (MsgDiff::Equals(event.id, id)) {
+				matching.push_back(event);
+			}
+		}
+		return matching;
+	}
+
+	static std::vector<Probe> probes(const std::vector<tracing::Event>& e) {
+		std::vector<Probe> result;
+		result.reserve(e.size());
+		for (const auto& event : e) {
+			result.push_back(event.probe);
+		}
+		return result;
+	}
+
+	std::shared_ptr<tracing::RingBufferSink> sink_;
+
+	static constexpr size_t SINK_CAPACITY = 64;
+
+public:
+	~TracingTest() override = default;
+};
+
+TEST_F(TracingTest, RingBufferKeepsNewest) {  // NOLINT
+	constexpr size_t CAPACITY = 3;
+	constexpr uint64_t EVENTS = 5;
+	tracing::RingBufferSink ring(CAPACITY);
+
+	for (uint64_t i = 0; i < EVENTS; ++i) {
+		tracing::Event event;
+		event.id = makeId(i);
+		ring.record(event);
+	}
+
+	auto events = ring.events();
+	ASSERT_EQ(events.size(), CAPACITY);
+	EXPECT_EQ(events[0].id.lsb(), 2);
+	EXPECT_EQ(events[1].id.lsb(), 3);
+	EXPECT_EQ(events[2].id.lsb(), 4);
+	EXPECT_EQ(ring.overwritten(), EVENTS - CAPACITY);
+
+	ring.clear();
+	EXPECT_TRUE(ring.events().empty());
+	EXPECT_EQ(ring.overwritten(), 0);
+
+	EXPECT_THROW(tracing::RingBufferSink(0), std::invalid_argument);
+}
+
+TEST_F(TracingTest, TraceToCallbackSink) {  // NOLINT
+	std::vector<tracing::Event> received;
+	tracing::setSink(std::make_shared<tracing::CallbackSink>(
+	    [&received](const tracing::Event& event) {
+		    received.push_back(event);
+	    }));
+
+	const auto before = std::chrono::steady_clock::now();
+	tracing::trace(Probe::SENT, makeId(1), UCode::UNAVAILABLE);
+
+	ASSERT_EQ(received.size(), 1);
+	EXPECT_EQ(received[0].probe, Probe::SENT);
+	EXPECT_EQ(received[0].id.lsb(), 1);
+	EXPECT_EQ(received[0].code, UCode::UNAVAILABLE);
+	EXPECT_GE(received[0].when, before);
+
+	tracing::setSink(nullptr);
+	EXPECT_FALSE(tracing::getSink());
+	tracing::trace(Probe::SENT, makeId(2));
+	EXPECT_EQ(received.size(), 1);
+}
+
+TEST_F(TracingTest, ProbeNames) {  // NOLINT
+	EXPECT_EQ(tracing::name(Probe::BUILT), "BUILT");
+	EXPECT_EQ(tracing::name(Probe::RPC_EXPIRED), "RPC_EXPIRED");
+	EXPECT_EQ(tracing::name(static_cast<Probe>(0xFF)), "UNKNOWN");
+}
+
+#ifdef UP_CPP_TRACING
+
+TEST_F(TracingTest, PublishAndReceive) {  // NOLINT
+	auto transport = std::make_shared<UTransportMock>(getEntity());
+	transport->getSendStatus().set_code(UCode::OK);
+
+	auto message = UMessageBuilder::publish(getTopic()).build();
+	EXPECT_EQ(transport->send(message).code(), UCode::OK);
+
+	auto sent = eventsFor(message.attributes().id());
+	EXPECT_EQ(probes(sent), (std::vector<Probe>{Probe::BUILT, Probe::VALIDATED,
+	                                            Probe::SENT}));
+	ASSERT_EQ(sent.size(), 3);
+	EXPECT_LE(sent[0].when, sent[1].when);
+	EXPECT_LE(sent[1].when, sent[2].when);
+
+	size_t delivered = 0;
+	auto subscriber = uprotocol::communication::Subscriber::subscribe(
+	    transport, getTopic(),
+	    [&delivered](const UMessage&) { ++delivered; });
+	ASSERT_TRUE(subscriber);
+	sink_->clear();
+
+	transport->mockMessage(message);
+	EXPECT_EQ(delivered, 1);
+	EXPECT_EQ(probes(eventsFor(message.attributes().id())),
+	          (std::vector<Probe>{Probe::RECEIVED, Probe::DISPATCHED}));
+}
+
+TEST_F(TracingTest, RpcCompletedAndExpired) {  // NOLINT
+	constexpr uint32_t METHOD_ID = 0x0101;
+	auto method = getEntity();
+	method.set_ue_id(0x10002);
+	method.set_resource_id(METHOD_ID);
+
+	auto transport = std::make_shared<UTransportMock>(getEntity());
+	transport->getSendStatus().set_code(UCode::OK);
+	uprotocol::communication::RpcClient client(
+	    transport, uprotocol::v1::UPriority::UPRIORITY_CS4,
+	    std::chrono::milliseconds(10));
+
+	{
+		auto invoked = client.invokeMethod(method);
+		const auto request = transport->getMessage();
+		auto response = UMessageBuilder::response(request).build();
+		transport->mockMessage(response);
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+
+		auto request_events = eventsFor(request.attributes().id());
+		EXPECT_EQ(probes(request_events),
+		          (std::vector<Probe>{Probe::BUILT, Probe::VALIDATED,
+		                              Probe::SENT, Probe::RPC_COMPLETED}));
+		EXPECT_EQ(probes(eventsFor(response.attributes().id())),
+		          (std::vector<Probe>{Probe::BUILT, Probe::RECEIVED,
+		                              Probe::DISPATCHED}));
+	}
+
+	{
+		auto invoked = client.invokeMethod(method);
+		const auto request = transport->getMessage();
+		ASSERT_EQ(invoked.wait_for(std::chrono::seconds(1)),
+		          std::future_status::ready);
+
+		auto request_events = eventsFor(request.attributes().id());
+		ASSERT_FALSE(request_events.empty());
+		EXPECT_EQ(request_events.back().probe, Probe::RPC_EXPIRED);
+		EXPECT_EQ(request_events.back().code, UCode::DEADLINE_EXCEEDED);
+	}
+}
+
+#endif  // UP_CPP_TRACING
+
+}  // namespace
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/communication/Publisher.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/RpcServer.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/utils/CallbackConnection.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "AllocationCounter.h"
+
+// Allocation budgets for hot paths, measured on the calling thread in steady
+// state (after a warm-up call). A test failing here means a change made one
+// of these paths allocate more often. If that is intended, raise the budget
+// in the same change and explain why. If a change reduces allocations,
+// lower the budget to lock the improvement in.
+
+namespace {
+
+using uprotocol::communication::Publisher;
+using uprotocol::communication::RpcClient;
+using uprotocol::communication::RpcServer;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::test::ScopedAllocationCounter;
+using uprotocol::v1::UMessage;
+using uprotocol::v1::UPayloadFormat;
+using uprotocol::v1::UUri;
+
+constexpr size_t REPETITIONS = 64;
+constexpr auto FORMAT = UPayloadFormat::UPAYLOAD_FORMAT_TEXT;
+
+// Transport that never allocates, so only the library's allocations are
+// counted
+class NonAllocatingTransport : public uprotocol::transport::UTransport {
+public:
+	explicit NonAllocatingTransport(const UUri& uri) : UTransport(uri) {}
+
+	void deliver(const UMessage& message) { listener_(message); }
+
+	[[nodiscard]] size_t sendCount() const { return send_count_; }
+
+protected:
+	[[nodiscard]] uprotocol::v1::UStatus sendImpl(
+	    const UMessage& /*message*/) override {
+		++send_count_;
+		return {};
+	}
+
+	[[nodiscard]] uprotocol::v1::UStatus registerListenerImpl(
+	    CallableConn&& listener, const UUri& /*source_filter*/,
+	    std::optional<UUri>&& /*sink_filter*/) override {
+		listener_ = std::move(listener);
+		return {};
+	}
+
+private:
+	CallableConn listener_;
+	size_t send_count_{0};
+};
+
+class AllocationBudgetTest : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	AllocationBudgetTest() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+		UUri uri;
+		uri.set_authority_name("10.0.0.1");
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	static UUri serverUri() { return makeUri(0x10001, 0); }
+	static UUri methodUri() { return makeUri(0x10001, 0x0001); }
+	static UUri clientUri() { return makeUri(0x10002, 0); }
+	static UUri topicUri() { return makeUri(0x10002, 0x8001); }
+
+public:
+	~AllocationBudgetTest() override = default;
+};
+
+TEST_F(AllocationBudgetTest, CallbackInvocation) {  // NOLINT
+	using Connection =
+	    uprotocol::utils::callbacks::Connection<void, const UMessage&>;
+	size_t calls = 0;
+	auto [handle, callable] =
+	    Connection::establish([&calls](const UMessage&) { ++calls; });
+	const UMessage message;
+
+	ScopedAllocationCounter counter;
+	for (size_t i = 0; i < REPETITIONS; ++i) {
+		callable(message);
+	}
+	EXPECT_EQ(counter.thisThread().allocations, 0);
+	EXPECT_EQ(calls, REPETITIONS);
+}
+
+TEST_F(AllocationBudgetTest, PublisherPublish) {  // NOLINT
+	constexpr size_t BUDGET = 5;
+
+	auto transport = std::make_shared<NonAllocatingTransport>(clientUri());
+	Publisher publisher(transport, topicUri(), FORMAT);
+	const std::string text("published");
+	std::vector<Payload> payloads;
+	for (size_t i = 0; i <= REPETITIONS; ++i) {
+		payloads.emplace_back(text, FORMAT);
+	}
+	std::ignore = publisher.publish(std::move(payloads.back()));
+	payloads.pop_back();
+
+	ScopedAllocationCounter counter;
+	for (auto& payload : payloads) {
+		std::ignore = publisher.publish(std::move(payload));
+	}
+	const auto allocations = counter.thisThread().allocations;
+	EXPECT_LE(allocations, BUDGET * REPETITIONS);
+	EXPECT_EQ(transport->sendCount(), REPETITIONS + 1);
+}
+
+TEST_F(AllocationBudgetTest, RpcClientInvokeMethod) {  // NOLINT
+	constexpr size_t BUDGET = 16;
+	// The shared expiry queue grows geometrically, adding an allocation
+	// each time it doubles in size
+	constexpr size_t QUEUE_GROWTH = 8;
+	constexpr std::chrono::seconds TTL(60);
+
+	auto transport = std::make_shared<NonAllocatingTransport>(clientUri());
+	RpcClient client(transport, uprotocol::v1::UPRIORITY_CS4, TTL, FORMAT);
+	const std::string text("request");
+	std::vector<Payload> payloads;
+	for (size_t i = 0; i <= REPETITIONS; ++i) {
+		payloads.emplace_back(text, FORMAT);
+	}
+	std::vector<RpcClient::InvokeHandle> handles;
+	handles.reserve(REPETITIONS + 1);
+	auto callback = [](const RpcClient::MessageOrStatus&) {};
+	handles.push_back(client.invokeMethod(
+	    methodUri(), std::move(payloads.back()), callback));
+	payloads.pop_back();
+
+	ScopedAllocationCounter counter;
+	for (auto& payload : payloads) {
+		handles.push_back(
+		    client.invokeMethod(methodUri(), std::move(payload), callback));
+	}
+	const auto allocations = counter.thisThread().allocations;
+	EXPECT_LE(allocations, (BUDGET * REPETITIONS) + QUEUE_GROWTH);
+	EXPECT_EQ(transport->sendCount(), REPETITIONS + 1);
+}
+
+TEST_F(AllocationBudgetTest, RpcServerRequest) {  // NOLINT
+	constexpr size_t BUDGET = 18;
+
+	auto transport = std::make_shared<NonAllocatingTransport>(serverUri());
+	const std::string text("response");
+	auto server = RpcServer::create(
+	    transport, methodUri(),
+	    [&text](const UMessage&) { return Payload(text, FORMAT); }, FORMAT);
+	ASSERT_TRUE(server);
+
+	std::vector<UMessage> requests;
+	constexpr std::chrono::seconds TTL(60);
+	auto builder = UMessageBuilder::request(
+	    methodUri(), clientUri(), uprotocol::v1::UPRIORITY_CS4, TTL);
+	for (size_t i = 0; i <= REPETITIONS; ++i) {
+		requests.push_back(builder.build(Payload(text, FORMAT)));
+	}
+	transport->deliver(requests.back());
+	requests.pop_back();
+
+	ScopedAllocationCounter counter;
+	for (const auto& request : requests) {
+		transport->deliver(request);
+	}
+	const auto allocations = counter.thisThread().allocations;
+	EXPECT_LE(allocations, BUDGET * REPETITIONS);
+	EXPECT_EQ(transport->sendCount(), REPETITIONS + 1);
+}
+
+}  // namespace
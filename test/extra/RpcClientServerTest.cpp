@@ -123,7 +123,7 @@ TEST_F(RpcClientServerTest, SimpleRoundTrip) {  // NOLINT
 	     &server_response_payload](const UMessage& message) {
 		    server_called = true;
 		    server_capture = message;
-		    return server_response_payload;
+		    return server_response_payload.clone();
 	    },
 	    UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
 	ASSERT_TRUE(server_or_status.has_value());
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/// @brief Heap allocation counting for tests.
+///
+/// Executables that link the up-cpp-allocation-counter object library
+/// (utils/AllocationCounter.cpp) replace the global operator new and
+/// operator delete with versions that count every call, both for the calling
+/// thread and for the whole process. Used by tests and benchmarks alike.
+namespace uprotocol::test {
+
+struct AllocationCounts {
+	/// @brief Calls to any form of operator new
+	size_t allocations{0};
+	/// @brief Calls to any form of operator delete with a non-null pointer
+	size_t deallocations{0};
+	/// @brief Total bytes requested from operator new
+	size_t bytes{0};
+
+	AllocationCounts operator-(const AllocationCounts& other) const {
+		return {allocations - other.allocations,
+		        deallocations - other.deallocations, bytes - other.bytes};
+	}
+};
+
+/// @brief Gets the counts for the calling thread since it started.
+[[nodiscard]] AllocationCounts threadAllocations() noexcept;
+
+/// @brief Gets the counts for all threads since the process started.
+[[nodiscard]] AllocationCounts processAllocations() noexcept;
+
+/// @brief Measures allocations from construction until a count is read.
+///
+///     ScopedAllocationCounter counter;
+///     doSomething();
+///     EXPECT_LE(counter.thisThread().allocations, 2);
+///
+/// @remarks thisThread() is exact. allThreads() also includes anything that
+///          unrelated threads (e.g. other tests' workers still shutting down)
+///          allocated during the measurement.
+class ScopedAllocationCounter {
+public:
+	ScopedAllocationCounter() noexcept
+	    : thread_start_(threadAllocations()),
+	      process_start_(processAllocations()) {}
+
+	/// @brief Gets the counts for the calling thread since construction.
+	///
+	/// @note Must be called from the thread that constructed the counter.
+	[[nodiscard]] AllocationCounts thisThread() const noexcept {
+		return threadAllocations() - thread_start_;
+	}
+
+	/// @brief Gets the counts for all threads since construction.
+	[[nodiscard]] AllocationCounts allThreads() const noexcept {
+		return processAllocations() - process_start_;
+	}
+
+	/// @brief Restarts the measurement.
+	void reset() noexcept {
+		thread_start_ = threadAllocations();
+		process_start_ = processAllocations();
+	}
+
+private:
+	AllocationCounts thread_start_;
+	AllocationCounts process_start_;
+};
+
+}  // namespace uprotocol::test
+
+#endif  // ALLOCATIONCOUNTER_H
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Plain values so that no dynamic initialization or destruction runs for
+// them, as operator new can be called before main() and after exit().
+thread_local uprotocol::test::AllocationCounts thread_counts;
+
+std::atomic<size_t> process_allocations{0};
+std::atomic<size_t> process_deallocations{0};
+std::atomic<size_t> process_bytes{0};
+
+void countAllocation(size_t size) noexcept {
+	++thread_counts.allocations;
+	thread_counts.bytes += size;
+	process_allocations.fetch_add(1, std::memory_order_relaxed);
+	process_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void countDeallocation(const void* ptr) noexcept {
+	if (ptr != nullptr) {
+		++thread_counts.deallocations;
+		process_deallocations.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void* allocate(size_t size) {
+	countAllocation(size);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* allocateAligned(size_t size, std::align_val_t alignment) {
+	countAllocation(size);
+	const auto align = static_cast<size_t>(alignment);
+	// aligned_alloc requires the size to be a multiple of the alignment
+	const size_t rounded = ((size + align - 1) / align) * align;
+	if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void deallocate(void* ptr) noexcept {
+	countDeallocation(ptr);
+	std::free(ptr);
+}
+
+}  // namespace
+
+namespace uprotocol::test {
+
+AllocationCounts threadAllocations() noexcept { return thread_counts; }
+
+AllocationCounts processAllocations() noexcept {
+	return {process_allocations.load(std::memory_order_relaxed),
+	        process_deallocations.load(std::memory_order_relaxed),
+	        process_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace uprotocol::test
+
+// The array and nothrow forms of operator new and operator delete call these
+// by default, so every allocation is counted once.
+
+void* operator new(size_t size) { return allocate(size); }
+
+void* operator new(size_t size, std::align_val_t alignment) {
+	return allocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+
+void operator delete(void* ptr, size_t /*size*/) noexcept { deallocate(ptr); }
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+	deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+	deallocate(ptr);
+}